@@ -1,13 +1,16 @@
 
 #include <chrono>
+#include <string.h>
 #include <sstream>
 #include "benchmark/benchmark.h"
 
 #include "SQLParser.h"
+#include "util/jsonprinter.h"
 #include "parser/bison_parser.h"
 #include "parser/flex_lexer.h"
 
 #include "benchmark_utils.h"
+#include "queries.h"
 
 // Benchmark the influence of increasing size of the query, while
 // the number of tokens remains unchanged.
@@ -85,3 +88,371 @@ BENCHMARK(BM_ConditionalTokens)
 
 
 
+// Short OLTP statement, for which setting up the scanner is a noticeable
+// share of the parse time.
+static const std::string kPointQuery = "SELECT name, balance FROM accounts WHERE id = 42;";
+
+// Parse with the static API, which sets up a new context per query.
+static void BM_StaticParser(benchmark::State& st) {
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    hsql::SQLParser::parse(kPointQuery, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_StaticParser);
+
+// Parse with a context that is reused across queries.
+static void BM_ParserContext(benchmark::State& st) {
+  hsql::SQLParserContext context;
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(kPointQuery, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ParserContext);
+
+// Parse with a context and a result that are both reused across queries.
+static void BM_RecycledResult(benchmark::State& st) {
+  hsql::SQLParserContext context;
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(kPointQuery, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_RecycledResult);
+
+// Fingerprint of the query from its tokens. Compare with BM_ParserContext.
+static void BM_Fingerprint(benchmark::State& st) {
+  hsql::SQLParserContext context;
+  uint64_t digest;
+  while (st.KeepRunning()) {
+    context.fingerprint(kPointQuery, &digest);
+    benchmark::DoNotOptimize(digest);
+  }
+}
+BENCHMARK(BM_Fingerprint);
+
+// Repeated query served from the parse cache. Compare with BM_ParserContext.
+static void BM_CachedResult(benchmark::State& st) {
+  hsql::SQLParserCache cache(1 << 20);
+  while (st.KeepRunning()) {
+    std::shared_ptr<const hsql::SQLParserResult> result = cache.parse(kPointQuery);
+    if (!result->isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_CachedResult);
+
+// Repeated query served from the parse cache as a copy the caller can change.
+static void BM_CachedResultCopy(benchmark::State& st) {
+  hsql::SQLParserCache cache(1 << 20);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    cache.parse(kPointQuery, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_CachedResultCopy);
+
+// Parse and replace the literals by placeholders. Compare with BM_RecycledResult.
+static void BM_ParameterizeLiterals(benchmark::State& st) {
+  hsql::SQLParserContext context;
+  hsql::SQLParserResult result;
+  std::vector<const hsql::Expr*> values;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(kPointQuery, &result);
+    result.parameterizeLiterals(&values);
+    if (values.size() != 1) st.SkipWithError("Parameterizing failed!");
+  }
+}
+BENCHMARK(BM_ParameterizeLiterals);
+
+// Bind values into a prepared point query, in place or into a copy of it.
+// Compare with BM_RecycledResult, which parses the query each time.
+static void BM_BindParameters(benchmark::State& st) {
+  hsql::SQLParserResult prepared;
+  hsql::SQLParser::parse("SELECT name, balance FROM accounts WHERE id = ?;", &prepared);
+  hsql::Expr* id = hsql::Expr::makeLiteral((int64_t) 42);
+  std::vector<const hsql::Expr*> values = {id};
+
+  hsql::SQLParserResult bound;
+  bool copy = st.range(0) == 1;
+  while (st.KeepRunning()) {
+    bool ok = copy ? prepared.bindParameters(values, &bound) : prepared.bindParameters(values);
+    if (!ok) st.SkipWithError("Binding failed!");
+  }
+  delete id;
+}
+BENCHMARK(BM_BindParameters)->Arg(0)->Arg(1);
+
+// Insert with the given number of placeholders. Registering and binding the
+// placeholders should scale linearly with their number.
+static void BM_WideParameterList(benchmark::State& st) {
+  std::stringstream stream;
+  stream << "INSERT INTO t VALUES (?";
+  for (int64_t i = 1; i < st.range(0); ++i) stream << ", ?";
+  stream << ");";
+  const std::string query = stream.str();
+
+  hsql::Expr* value = hsql::Expr::makeLiteral((int64_t) 42);
+  std::vector<const hsql::Expr*> values(st.range(0), value);
+
+  hsql::SQLParserContext context;
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(query, &result);
+    if (!result.bindParameters(values)) st.SkipWithError("Binding failed!");
+  }
+  st.SetComplexityN(st.range(0));
+  delete value;
+}
+BENCHMARK(BM_WideParameterList)->Range(1 << 4, 1 << 14)->Complexity();
+
+// IN list of the given number of ids, as generated by ORMs.
+static void BM_InList(benchmark::State& st) {
+  std::stringstream stream;
+  stream << "SELECT * FROM orders WHERE id IN (0";
+  for (int64_t i = 1; i < st.range(0); ++i) stream << ", " << i * 7;
+  stream << ");";
+  const std::string query = stream.str();
+
+  hsql::SQLParserContext context;
+  size_t bytes = 0;
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(query, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+    bytes = result.arena()->bytesAllocated();
+  }
+  st.counters["arena_bytes"] = bytes;
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_InList)->Range(1 << 4, 1 << 14);
+
+// Chain of UNION ALL selects, which is stored as one flat list of branches.
+static void BM_UnionChain(benchmark::State& st) {
+  std::stringstream stream;
+  stream << "SELECT id, name FROM orders_0";
+  for (int64_t i = 1; i < st.range(0); ++i) {
+    stream << " UNION ALL SELECT id, name FROM orders_" << i;
+  }
+  stream << " ORDER BY id LIMIT 100;";
+  const std::string query = stream.str();
+
+  hsql::SQLParserContext context;
+  st.counters["num_chars"] = query.size();
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(query, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_UnionChain)->Range(1 << 4, 1 << 12);
+
+// Bulk insert of the given number of rows. Used to compare parsing a copy
+// of the query with parsing it in place.
+static std::string makeBulkInsert(size_t numRows) {
+  std::stringstream stream;
+  for (size_t i = 0; i < numRows; ++i) {
+    stream << "INSERT INTO orders VALUES (" << i << ", 'customer " << i << "', 42.5);";
+  }
+  return stream.str();
+}
+
+static void BM_ParseCopy(benchmark::State& st) {
+  const std::string query = makeBulkInsert(st.range(0));
+  hsql::SQLParserContext context;
+  st.counters["num_chars"] = query.size();
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(query.data(), query.size(), &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ParseCopy)->Range(1 << 4, 1 << 12);
+
+static void BM_ParseInPlace(benchmark::State& st) {
+  const std::string query = makeBulkInsert(st.range(0));
+  std::vector<char> buffer(query.begin(), query.end());
+  buffer.resize(query.size() + hsql::SQLParserContext::kScanPadding, '\0');
+
+  hsql::SQLParserContext context;
+  st.counters["num_chars"] = query.size();
+  while (st.KeepRunning()) {
+    // Parsing terminates the strings of the result within the buffer, so
+    // the query is restored for the next parse.
+    memcpy(buffer.data(), query.data(), query.size());
+    hsql::SQLParserResult result;
+    context.parseInPlace(buffer.data(), query.size(), &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ParseInPlace)->Range(1 << 4, 1 << 12);
+
+// The rows of the bulk insert as a single statement with one VALUES list.
+// Compare with BM_ParseCopy, which parses one statement per row.
+static void BM_InsertRows(benchmark::State& st) {
+  std::stringstream stream;
+  stream << "INSERT INTO orders VALUES ";
+  for (int64_t i = 0; i < st.range(0); ++i) {
+    stream << (i > 0 ? ", " : "") << "(" << i << ", 'customer " << i << "', 42.5)";
+  }
+  stream << ";";
+  const std::string query = stream.str();
+
+  hsql::SQLParserContext context;
+  st.counters["num_chars"] = query.size();
+  while (st.KeepRunning()) {
+    hsql::SQLParserResult result;
+    context.parse(query, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_InsertRows)->Range(1 << 4, 1 << 12);
+
+// Finds the statement boundaries in the bulk insert script without parsing
+// it. Compare with BM_ParseCopy for the cost of parsing the whole script.
+static void BM_SplitStatements(benchmark::State& st) {
+  const std::string query = makeBulkInsert(st.range(0));
+  std::vector<hsql::StatementRange> ranges;
+  st.counters["num_chars"] = query.size();
+  while (st.KeepRunning()) {
+    ranges.clear();
+    hsql::splitStatements(query, &ranges);
+    if (ranges.size() != (size_t) st.range(0)) st.SkipWithError("Splitting failed!");
+  }
+  st.SetBytesProcessed(st.iterations() * query.size());
+}
+BENCHMARK(BM_SplitStatements)->Range(1 << 4, 1 << 12);
+
+
+// Query with a left-deep chain of the given number of additions.
+static std::string makeArithmeticChain(size_t numOperands) {
+  std::stringstream stream;
+  stream << "SELECT a0";
+  for (size_t i = 1; i < numOperands; ++i) {
+    stream << " + a" << i;
+  }
+  stream << " FROM test;";
+  return stream.str();
+}
+
+// Deletes released statements, which destroys the tree node by node
+// instead of dropping the arena of the result in bulk. Only the
+// teardown is measured.
+static void BM_TeardownReleased(benchmark::State& st) {
+  const std::string query = makeArithmeticChain(st.range(0));
+  hsql::SQLParserContext context;
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    std::vector<hsql::SQLStatement*> statements;
+    {
+      hsql::SQLParserResult result;
+      context.parse(query, &result);
+      if (!result.isValid()) st.SkipWithError("Parsing failed!");
+      statements = result.releaseStatements();
+    }
+    st.ResumeTiming();
+
+    for (hsql::SQLStatement* stmt : statements) {
+      delete stmt;
+    }
+  }
+}
+BENCHMARK(BM_TeardownReleased)->Range(1 << 4, 1 << 14);
+
+// Parses a batch made of the benchmark queries with the given number
+// of threads. Measured in wall time, so that it shows the scaling.
+static void BM_ParseBatch(benchmark::State& st) {
+  std::vector<std::string> queries;
+  while (queries.size() < 4096) {
+    for (const SQLQuery& query : sql_queries) {
+      queries.push_back(query.second);
+    }
+  }
+
+  std::vector<hsql::SQLParserResult> results;
+  while (st.KeepRunning()) {
+    hsql::SQLParser::parseBatch(queries, &results, st.range(0));
+  }
+  st.SetItemsProcessed(st.iterations() * queries.size());
+}
+BENCHMARK(BM_ParseBatch)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+// Parse results of the TPC-H queries made only of SELECT statements, which
+// the JSON printer supports.
+static std::vector<hsql::SQLParserResult> parseTPCHSelects() {
+  std::vector<hsql::SQLParserResult> results;
+  for (const SQLQuery& query : getTPCHQueries()) {
+    if (query.first.compare(0, 6, "tpc-h-") != 0) continue;
+    hsql::SQLParserResult result;
+    hsql::SQLParser::parse(query.second, &result);
+    bool selectsOnly = result.isValid();
+    for (const hsql::SQLStatement* stmt : result.getStatements()) {
+      selectsOnly = selectsOnly && stmt->isType(hsql::kStmtSelect);
+    }
+    if (selectsOnly) results.push_back(std::move(result));
+  }
+  return results;
+}
+
+// Encodes the results into binary images. Compare with BM_JsonTPCH.
+static void BM_SerializeTPCH(benchmark::State& st) {
+  const std::vector<hsql::SQLParserResult> results = parseTPCHSelects();
+  std::string image;
+  size_t numBytes = 0;
+  while (st.KeepRunning()) {
+    numBytes = 0;
+    for (const hsql::SQLParserResult& result : results) {
+      result.serialize(&image);
+      numBytes += image.size();
+    }
+  }
+  st.counters["num_bytes"] = numBytes;
+  st.SetBytesProcessed(st.iterations() * numBytes);
+}
+BENCHMARK(BM_SerializeTPCH);
+
+// Decodes the binary images into parse results.
+static void BM_DeserializeTPCH(benchmark::State& st) {
+  std::vector<std::string> images;
+  size_t numBytes = 0;
+  for (const hsql::SQLParserResult& result : parseTPCHSelects()) {
+    images.emplace_back();
+    result.serialize(&images.back());
+    numBytes += images.back().size();
+  }
+
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    for (const std::string& image : images) {
+      if (!result.deserialize(image.data(), image.size())) st.SkipWithError("Decoding failed!");
+    }
+  }
+  st.counters["num_bytes"] = numBytes;
+  st.SetBytesProcessed(st.iterations() * numBytes);
+}
+BENCHMARK(BM_DeserializeTPCH);
+
+// Prints the statements of the results as JSON.
+static void BM_JsonTPCH(benchmark::State& st) {
+  const std::vector<hsql::SQLParserResult> results = parseTPCHSelects();
+  size_t numBytes = 0;
+  while (st.KeepRunning()) {
+    numBytes = 0;
+    for (const hsql::SQLParserResult& result : results) {
+      for (const hsql::SQLStatement* stmt : result.getStatements()) {
+        numBytes += hsql::jsonPrintStatementInfo(stmt, false).size();
+      }
+    }
+  }
+  st.counters["num_bytes"] = numBytes;
+  st.SetBytesProcessed(st.iterations() * numBytes);
+}
+BENCHMARK(BM_JsonTPCH);
@@ -1,9 +1,13 @@
 
 #include "SQLParser.h"
-#include "parser/bison_parser.h"
-#include "parser/flex_lexer.h"
+#include "util/work_queue.h"
 #include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace hsql {
 
@@ -13,27 +17,79 @@ namespace hsql {
 
   // static
   bool SQLParser::parse(const std::string& sql, SQLParserResult* result) {
-    yyscan_t scanner;
-    YY_BUFFER_STATE state;
+    SQLParserContext context;
+    return context.parse(sql, result);
+  }
 
-    if (hsql_lex_init(&scanner)) {
-      // Couldn't initialize the lexer.
-      fprintf(stderr, "SQLParser: Error when initializing lexer!\n");
-      return false;
-    }
-    const char* text = sql.c_str();
-    state = hsql__scan_string(text, scanner);
+  // static
+  bool SQLParser::parse(const char* data, size_t length, SQLParserResult* result) {
+    SQLParserContext context;
+    return context.parse(data, length, result);
+  }
 
-    // Parse the tokens.
-    // If parsing fails, the result will contain an error object.
-    int ret = hsql_parse(result, scanner);
-    bool success = (ret == 0);
-    result->setIsValid(success);
+  // static
+  bool SQLParser::parseInPlace(char* data, size_t length, SQLParserResult* result) {
+    SQLParserContext context;
+    return context.parseInPlace(data, length, result);
+  }
 
-    hsql__delete_buffer(state, scanner);
-    hsql_lex_destroy(scanner);
+  // static
+  bool SQLParser::parseBatch(const std::vector<std::string>& queries,
+                             std::vector<SQLParserResult>* results,
+                             size_t numThreads) {
+    results->resize(queries.size());
+    if (queries.empty()) return true;
+
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 1;
+    if (numThreads > queries.size()) numThreads = queries.size();
+
+    // A queue hands out at most WorkQueue::kMaxSize indexes, so larger batches
+    // are parsed in several rounds.
+    std::atomic<bool> success(true);
+
+    // The first exception of a worker, e.g. std::bad_alloc. It is rethrown
+    // on the calling thread once all threads are joined.
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    // The threads of a round are joined before the next one starts.
+    for (size_t offset = 0; offset < queries.size() && !error; offset += WorkQueue::kMaxSize) {
+      size_t size = std::min(queries.size() - offset, WorkQueue::kMaxSize);
+      WorkQueue queue(size, numThreads);
+      auto work = [&](size_t worker) {
+        try {
+          SQLParserContext context;
+          size_t i;
+          while (queue.next(worker, &i)) {
+            SQLParserResult& result = (*results)[offset + i];
+            result.reset();
+            if (!context.parse(queries[offset + i], &result)) {
+              success.store(false, std::memory_order_relaxed);
+            }
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if (!error) error = std::current_exception();
+        }
+      };
+
+      // Joins the threads also if starting one of them throws.
+      struct Threads {
+        std::vector<std::thread> threads;
+        ~Threads() {
+          for (std::thread& thread : threads) thread.join();
+        }
+      } workers;
+      workers.threads.reserve(numThreads - 1);
+      for (size_t worker = 1; worker < numThreads; ++worker) {
+        workers.threads.emplace_back(work, worker);
+      }
+      work(0);
+    }
 
-    return true;
+    if (error) std::rethrow_exception(error);
+    return success.load();
   }
 
   // static
@@ -47,34 +103,14 @@ namespace hsql {
 
   // static
   bool SQLParser::tokenize(const std::string& sql, std::vector<int16_t>* tokens) {
-    // Initialize the scanner.
-    yyscan_t scanner;
-    if (hsql_lex_init(&scanner)) {
-      fprintf(stderr, "SQLParser: Error when initializing lexer!\n");
-      return false;
-    }
-
-    YY_BUFFER_STATE state;
-    state = hsql__scan_string(sql.c_str(), scanner);
-
-    YYSTYPE yylval;
-    YYLTYPE yylloc;
-
-    // Step through the string until EOF is read.
-    // Note: hsql_lex returns int, but we know that its range is within 16 bit.
-    int16_t token = hsql_lex(&yylval, &yylloc, scanner);
-    while (token != 0) {
-      tokens->push_back(token);
-      token = hsql_lex(&yylval, &yylloc, scanner);
-
-      if (token == SQL_IDENTIFIER || token == SQL_STRING) {
-        free(yylval.sval);
-      }
-    }
+    SQLParserContext context;
+    return context.tokenize(sql, tokens);
+  }
 
-    hsql__delete_buffer(state, scanner);
-    hsql_lex_destroy(scanner);
-    return true;
+  // static
+  bool SQLParser::fingerprint(const std::string& sql, uint64_t* fingerprint) {
+    SQLParserContext context;
+    return context.fingerprint(sql, fingerprint);
   }
 
 } // namespace hsql
@@ -1,12 +1,17 @@
 #ifndef __SQLPARSER__SQLPARSER_H__
 #define __SQLPARSER__SQLPARSER_H__
 
+#include "SQLParserCache.h"
+#include "SQLParserContext.h"
 #include "SQLParserResult.h"
 #include "sql/statements.h"
+#include "util/statement_splitter.h"
 
 namespace hsql {
 
   // Static methods used to parse SQL strings.
+  // Each call sets up a new SQLParserContext. Use a context directly to
+  // parse many strings on the same thread.
   class SQLParser {
    public:
 
@@ -16,9 +21,36 @@ namespace hsql {
     // you need to check result->isValid();
     static bool parse(const std::string& sql, SQLParserResult* result);
 
+    // Parses length characters of data, which does not need to be null-terminated.
+    static bool parse(const char* data, size_t length, SQLParserResult* result);
+
+    // Parses length characters of data in place, without copying them.
+    // The data has to be followed by SQLParserContext::kScanPadding null
+    // characters and has to outlive the result, whose strings point into it.
+    // See SQLParserContext::parseInPlace.
+    static bool parseInPlace(char* data, size_t length, SQLParserResult* result);
+
+    // Parses each of the queries into the result at the same position.
+    // results is resized to the number of queries, existing results are reset
+    // and reused. The queries are split between numThreads threads, one of
+    // which is the calling thread. Each thread parses with its own context.
+    // If numThreads is 0, one thread per hardware thread is used.
+    // Returns true if the lexer and parser could run for all queries. If a
+    // thread throws, e.g. std::bad_alloc, the first exception is rethrown
+    // after all threads have finished.
+    static bool parseBatch(const std::vector<std::string>& queries,
+                           std::vector<SQLParserResult>* results,
+                           size_t numThreads = 0);
+
     // Run tokenization on the given string and store the tokens in the output vector.
     static bool tokenize(const std::string& sql, std::vector<int16_t>* tokens);
 
+    // Computes a 64-bit fingerprint of the query from its tokens, without
+    // parsing it. Queries that only differ in their literals, the length of
+    // IN lists of literals, the case of keywords and unquoted identifiers,
+    // whitespace or comments have the same fingerprint. See util/fingerprint.h.
+    static bool fingerprint(const std::string& sql, uint64_t* fingerprint);
+
     // Deprecated.
     // Old method to parse SQL strings. Replaced by parse().
     static bool parseSQLString(const char* sql, SQLParserResult* result);
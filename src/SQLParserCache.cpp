@@ -0,0 +1,111 @@
+#include "SQLParserCache.h"
+#include "SQLParserContext.h"
+
+namespace hsql {
+
+  // Memory of an entry besides the arena of its result and its key.
+  static const size_t kEntryOverhead = sizeof(SQLParserResult) + 128;
+
+  // Key of a query whose result is cached under its exact text.
+  static std::string exactKey(const std::string& sql) {
+    return std::string(1, '\0') + sql;
+  }
+
+  SQLParserCache::SQLParserCache(size_t capacity) :
+    capacity_(capacity),
+    bytes_(0),
+    hits_(0),
+    misses_(0),
+    evictions_(0) {}
+
+  std::shared_ptr<const SQLParserResult> SQLParserCache::parse(const std::string& sql) {
+    // The key of valid queries is their normal form, so that queries that
+    // only differ in whitespace, comments or the case of keywords share a
+    // result. The normal form starts with a token and never with '\0'.
+    static thread_local SQLParserContext context;
+    static thread_local std::string key;
+    if (!context.normalize(sql, &key)) return nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto found = entries_.find(key);
+      if (found == entries_.end()) {
+        // Invalid queries are keyed by their exact text, since the position
+        // of the error depends on it.
+        found = entries_.find(exactKey(sql));
+      }
+      if (found != entries_.end()) {
+        ++hits_;
+        lru_.splice(lru_.begin(), lru_, found->second.position);
+        return found->second.result;
+      }
+      ++misses_;
+    }
+
+    // The query is parsed into a scratch result, whose arena reuses the
+    // spare block of the thread. The cached result is a copy of it in an
+    // arena of just the size that is needed.
+    SQLParserResult scratch;
+    if (!context.parse(sql, &scratch)) return nullptr;
+    if (!scratch.isValid()) key = exactKey(sql);
+
+    std::shared_ptr<SQLParserResult> result = std::make_shared<SQLParserResult>();
+    result->arena()->reserve(scratch.arena()->bytesAllocated());
+    scratch.clone(result.get());
+
+    size_t bytes = result->arena()->bytesReserved() + key.size() + kEntryOverhead +
+                   result->getStatements().capacity() * sizeof(SQLStatement*) +
+                   result->parameters().capacity() * sizeof(Expr*);
+    if (bytes > capacity_) return result;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto inserted = entries_.emplace(key, Entry());
+    Entry& entry = inserted.first->second;
+    if (!inserted.second) {
+      // Another thread parsed the same query in the meantime.
+      lru_.splice(lru_.begin(), lru_, entry.position);
+      return entry.result;
+    }
+
+    entry.result = result;
+    entry.bytes = bytes;
+    lru_.push_front(&inserted.first->first);
+    entry.position = lru_.begin();
+    bytes_ += bytes;
+    evict();
+    return result;
+  }
+
+  bool SQLParserCache::parse(const std::string& sql, SQLParserResult* result) {
+    std::shared_ptr<const SQLParserResult> cached = parse(sql);
+    if (cached == nullptr) {
+      result->reset();
+      return false;
+    }
+    cached->clone(result);
+    return true;
+  }
+
+  SQLParserCache::Stats SQLParserCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, evictions_, entries_.size(), bytes_};
+  }
+
+  void SQLParserCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    entries_.clear();
+    bytes_ = 0;
+  }
+
+  void SQLParserCache::evict() {
+    while (bytes_ > capacity_) {
+      auto victim = entries_.find(*lru_.back());
+      bytes_ -= victim->second.bytes;
+      lru_.pop_back();
+      entries_.erase(victim);
+      ++evictions_;
+    }
+  }
+
+} // namespace hsql
@@ -0,0 +1,87 @@
+#ifndef __SQLPARSER__SQLPARSER_CACHE_H__
+#define __SQLPARSER__SQLPARSER_CACHE_H__
+
+#include "SQLParserResult.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hsql {
+
+  // Cache of parse results in front of the parser, for applications that
+  // parse the same queries over and over again.
+  // Results are shared between all callers of a query. Valid queries are
+  // keyed by their tokens (see SQLParserContext::normalize), so queries that
+  // only differ in whitespace, comments or the case of keywords share a
+  // result. Invalid queries are keyed by their exact text.
+  // Once the memory of the cached results exceeds the capacity, the least
+  // recently used results are evicted.
+  // All methods are thread-safe. Queries are parsed outside of the lock,
+  // with one context per thread.
+  class SQLParserCache {
+   public:
+    struct Stats {
+      size_t hits;
+      size_t misses;
+      size_t evictions;
+
+      // Number of cached results and the memory they use.
+      size_t entries;
+      size_t bytes;
+    };
+
+    // Caches results up to capacity bytes, counting the arenas of the
+    // results and the keys.
+    explicit SQLParserCache(size_t capacity);
+
+    // Returns the result of parsing sql, from the cache if possible.
+    // The result must not be changed, since other callers share it. It stays
+    // valid after it is evicted for as long as it is referenced.
+    // Returns nullptr if the lexer or parser could not run.
+    std::shared_ptr<const SQLParserResult> parse(const std::string& sql);
+
+    // Parses sql into result, which the caller can change. The result is a
+    // copy of the cached result (see SQLParserResult::clone).
+    // Returns true if the lexer and parser could run. See SQLParser::parse.
+    bool parse(const std::string& sql, SQLParserResult* result);
+
+    Stats stats() const;
+
+    // Removes all results from the cache. Results still in use stay valid.
+    void clear();
+
+   private:
+    SQLParserCache(const SQLParserCache&) = delete;
+    SQLParserCache& operator=(const SQLParserCache&) = delete;
+
+    struct Entry {
+      std::shared_ptr<const SQLParserResult> result;
+      size_t bytes;
+
+      // Position of the entry in lru_.
+      std::list<const std::string*>::iterator position;
+    };
+
+    // Evicts the least recently used entries until the cache fits in its capacity.
+    void evict();
+
+    const size_t capacity_;
+
+    mutable std::mutex mutex_;
+
+    std::unordered_map<std::string, Entry> entries_;
+
+    // Keys of entries_ from the most to the least recently used.
+    std::list<const std::string*> lru_;
+
+    size_t bytes_;
+    size_t hits_;
+    size_t misses_;
+    size_t evictions_;
+  };
+
+} // namespace hsql
+
+#endif
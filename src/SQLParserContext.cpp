@@ -0,0 +1,218 @@
+
+#include "SQLParserContext.h"
+#include "parser/bison_parser.h"
+#include "parser/flex_lexer.h"
+#include "sql/PrepareStatement.h"
+#include "util/fingerprint.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace hsql {
+
+  SQLParserContext::SQLParserContext() :
+    bufferState_(nullptr),
+    state_(new HSQL_PARSE_STATE()) {
+    if (hsql_lex_init(&scanner_)) {
+      // Couldn't initialize the lexer.
+      fprintf(stderr, "SQLParser: Error when initializing lexer!\n");
+      scanner_ = nullptr;
+    }
+  }
+
+  SQLParserContext::~SQLParserContext() {
+    if (scanner_ != nullptr) hsql_lex_destroy(scanner_);
+    delete state_;
+  }
+
+  bool SQLParserContext::parse(const std::string& sql, SQLParserResult* result) {
+    return parse(sql.c_str(), sql.size(), result);
+  }
+
+  bool SQLParserContext::parse(const char* data, size_t length, SQLParserResult* result) {
+    if (scanner_ == nullptr) return false;
+
+    // The copy of the query is scanned and identifiers and string literals
+    // point into it, so it is kept in the arena of the result.
+    char* copy = (char*) result->arena()->allocate(length + kScanPadding);
+    memcpy(copy, data, length);
+    memset(copy + length, '\0', kScanPadding);
+    return parseBuffer(copy, length, result);
+  }
+
+  bool SQLParserContext::parseInPlace(char* data, size_t length, SQLParserResult* result) {
+    if (scanner_ == nullptr) return false;
+    return parseBuffer(data, length, result);
+  }
+
+  bool SQLParserContext::tokenize(const std::string& sql, std::vector<int16_t>* tokens) {
+    if (scanner_ == nullptr) return false;
+    copyInput(sql.c_str(), sql.size());
+    beginScan(buffer_.data(), sql.size());
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc;
+    yylloc.first_offset = 0;
+    yylloc.last_offset = 0;
+
+    // Step through the string until EOF is read.
+    // Note: hsql_lex returns int, but we know that its range is within 16 bit.
+    int16_t token = hsql_lex(&yylval, &yylloc, scanner_);
+    while (token != 0) {
+      tokens->push_back(token);
+      token = hsql_lex(&yylval, &yylloc, scanner_);
+    }
+
+    endScan();
+    return true;
+  }
+
+  bool SQLParserContext::fingerprint(const std::string& sql, uint64_t* fingerprint) {
+    if (scanner_ == nullptr) return false;
+    copyInput(sql.c_str(), sql.size());
+    beginScan(buffer_.data(), sql.size());
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc;
+    yylloc.first_offset = 0;
+    yylloc.last_offset = 0;
+
+    // The texts of the tokens are taken from the query, since the scanner
+    // crops quotes and terminates the token in its buffer.
+    Fingerprint digest;
+    int token = hsql_lex(&yylval, &yylloc, scanner_);
+    while (token != 0) {
+      digest.addToken(token, sql.c_str() + yylloc.first_offset, yylloc.last_offset - yylloc.first_offset);
+      token = hsql_lex(&yylval, &yylloc, scanner_);
+    }
+
+    endScan();
+    *fingerprint = digest.digest();
+    return true;
+  }
+
+  bool SQLParserContext::normalize(const std::string& sql, std::string* key) {
+    if (scanner_ == nullptr) return false;
+    copyInput(sql.c_str(), sql.size());
+    beginScan(buffer_.data(), sql.size());
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc;
+    yylloc.first_offset = 0;
+    yylloc.last_offset = 0;
+
+    // Newlines can not be part of a token, so they separate the tokens.
+    key->clear();
+    int previous = 0;
+    int previousEnd = 0;
+    int token = hsql_lex(&yylval, &yylloc, scanner_);
+    while (token != 0) {
+      if (previous != 0) {
+        key->push_back('\n');
+        // A numbered placeholder must not be separated from its number.
+        if (previous == '$' && yylloc.first_offset != previousEnd) key->push_back(' ');
+      }
+
+      const char* text = sql.c_str() + yylloc.first_offset;
+      size_t length = yylloc.last_offset - yylloc.first_offset;
+      if (token == SQL_IDENTIFIER || token == SQL_STRING) {
+        key->append(text, length);
+      } else {
+        for (size_t i = 0; i < length; ++i) {
+          char c = text[i];
+          if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+          key->push_back(c);
+        }
+      }
+
+      previous = token;
+      previousEnd = yylloc.last_offset;
+      token = hsql_lex(&yylval, &yylloc, scanner_);
+    }
+
+    endScan();
+    return true;
+  }
+
+  bool SQLParserContext::parseBuffer(char* data, size_t length, SQLParserResult* result) {
+    if (!beginScan(data, length)) return false;
+    size_t numPrevious = result->size();
+
+    // Parse the tokens.
+    // If parsing fails, the result will contain an error object.
+    // All nodes and strings are allocated from the arena of the result.
+    // Identifiers and string literals point into the scanned buffer, so
+    // they do not need an allocation each.
+    ArenaScope scope(result->arena());
+    int ret = hsql_parse(result, scanner_, state_);
+    bool success = (ret == 0);
+    result->setIsValid(success);
+
+    // Statements of a failed parse are not handed to the result.
+    for (SQLStatement* stmt : state_->statements) {
+      delete stmt;
+    }
+    state_->statements.clear();
+    state_->param_list.clear();
+    state_->numbered_params = false;
+    state_->values_block = nullptr;
+
+    endScan();
+
+    // The queries of PREPARE statements are parsed right away, so that
+    // executing them does not need to parse them again.
+    bool parsedPrepared = true;
+    for (size_t i = numPrevious; i < result->size(); ++i) {
+      SQLStatement* stmt = result->getMutableStatement(i);
+      if (stmt->isType(kStmtPrepare)) {
+        parsedPrepared &= parsePrepared((PrepareStatement*) stmt);
+      }
+    }
+    return parsedPrepared;
+  }
+
+  bool SQLParserContext::parsePrepared(PrepareStatement* prepare) {
+    SQLParserResult* prepared = new SQLParserResult();
+    prepare->setPrepared(prepared);
+    return parse(prepare->query, strlen(prepare->query), prepared);
+  }
+
+  void SQLParserContext::copyInput(const char* data, size_t length) {
+    // Only the first input is allocated, later inputs reuse its memory.
+    buffer_.resize(length + kScanPadding);
+    memcpy(buffer_.data(), data, length);
+    memset(buffer_.data() + length, '\0', kScanPadding);
+  }
+
+  bool SQLParserContext::beginScan(char* data, size_t length) {
+#ifndef HSQL_HAND_LEXER
+    // The previous input might have ended within a comment.
+    hsql_reset_start_condition(scanner_);
+#endif
+
+    // Fails if the input is not followed by the padding.
+    bufferState_ = hsql__scan_buffer(data, length + kScanPadding, scanner_);
+    if (bufferState_ == nullptr) return false;
+
+    terminators_.clear();
+    hsql_set_extra(&terminators_, scanner_);
+    return true;
+  }
+
+  void SQLParserContext::endScan() {
+#ifndef HSQL_HAND_LEXER
+    // Flex terminates the current token in the input. Undo that, since the
+    // buffer might belong to the caller.
+    hsql_restore_input(scanner_);
+#endif
+    hsql__delete_buffer((YY_BUFFER_STATE) bufferState_, scanner_);
+    bufferState_ = nullptr;
+    hsql_set_extra(nullptr, scanner_);
+
+    // Now the texts of the tokens can be terminated (see tokenText).
+    for (char* terminator : terminators_) {
+      *terminator = '\0';
+    }
+    terminators_.clear();
+  }
+
+} // namespace hsql
@@ -0,0 +1,94 @@
+#ifndef __SQLPARSER__SQLPARSER_CONTEXT_H__
+#define __SQLPARSER__SQLPARSER_CONTEXT_H__
+
+#include "SQLParserResult.h"
+#include <string>
+
+// Defined in parser/parser_typedef.h.
+struct HSQL_PARSE_STATE;
+
+namespace hsql {
+  struct PrepareStatement;
+
+  // Reusable state of the lexer and parser.
+  // SQLParser creates a new context for each call. Callers that parse many
+  // queries should keep one context per thread instead, so that the scanner
+  // and its buffers are only set up once.
+  // A context must not be used by multiple threads at the same time.
+  class SQLParserContext {
+   public:
+    // Number of null characters that have to follow a query in order
+    // to parse it in place.
+    static const size_t kScanPadding = 2;
+
+    SQLParserContext();
+    ~SQLParserContext();
+
+    // Parses a given SQL string into the result object.
+    // See SQLParser::parse.
+    bool parse(const std::string& sql, SQLParserResult* result);
+
+    // Parses length characters of data, which does not need to be null-terminated.
+    // The characters are copied once into the arena of the result, which
+    // the identifiers and string literals of the result point into.
+    bool parse(const char* data, size_t length, SQLParserResult* result);
+
+    // Parses length characters of data without copying them.
+    // data[length] up to data[length + kScanPadding - 1] must be null characters,
+    // otherwise false is returned.
+    // The identifiers and string literals of the result point into data,
+    // which therefore has to outlive the result. They are terminated by
+    // overwriting the character that follows each of them, so data no
+    // longer holds the query after parsing.
+    bool parseInPlace(char* data, size_t length, SQLParserResult* result);
+
+    // Run tokenization on the given string and store the tokens in the output vector.
+    bool tokenize(const std::string& sql, std::vector<int16_t>* tokens);
+
+    // Computes the fingerprint of the query from its tokens, without parsing it.
+    // See SQLParser::fingerprint.
+    bool fingerprint(const std::string& sql, uint64_t* fingerprint);
+
+    // Writes the tokens of the query to key, separated by newlines and with
+    // keywords in upper case. Whitespace and comments are dropped, except
+    // where they change the meaning of the query ($ 1 is not $1).
+    // Queries with the same key have the same tokens and therefore the same
+    // parse result, apart from the position of an error.
+    bool normalize(const std::string& sql, std::string* key);
+
+   private:
+    SQLParserContext(const SQLParserContext&) = delete;
+    SQLParserContext& operator=(const SQLParserContext&) = delete;
+
+    bool parseBuffer(char* data, size_t length, SQLParserResult* result);
+
+    // Parses the query of the statement into its prepared result.
+    bool parsePrepared(PrepareStatement* prepare);
+
+    // Copies the input into buffer_ and appends the padding.
+    void copyInput(const char* data, size_t length);
+
+    // Makes the scanner read from the given padded buffer.
+    bool beginScan(char* data, size_t length);
+    void endScan();
+
+    // Reentrant flex scanner (yyscan_t).
+    void* scanner_;
+
+    // Flex buffer state (YY_BUFFER_STATE) of the current input.
+    void* bufferState_;
+
+    // Lists used by the grammar actions while parsing.
+    HSQL_PARSE_STATE* state_;
+
+    // Copy of the input for tokenize and fingerprint.
+    std::vector<char> buffer_;
+
+    // Positions in the scanned buffer where the texts of the tokens end.
+    // See tokenText.
+    std::vector<char*> terminators_;
+  };
+
+} // namespace hsql
+
+#endif
@@ -1,31 +1,52 @@
 
 #include "SQLParserResult.h"
+#include "util/clone.h"
+#include "util/parameterize.h"
+#include "util/serialize.h"
 #include  <algorithm>
+#include <string.h>
 
 namespace hsql {
 
   SQLParserResult::SQLParserResult() :
     isValid_(false),
-    errorMsg_(nullptr) {};
+    errorLine_(-1),
+    errorColumn_(-1),
+    errorOffset_(-1),
+    arena_(nullptr) {};
 
   SQLParserResult::SQLParserResult(SQLStatement* stmt) :
     isValid_(false),
-    errorMsg_(nullptr) {
+    errorLine_(-1),
+    errorColumn_(-1),
+    errorOffset_(-1),
+    arena_(nullptr) {
     addStatement(stmt);
   };
 
   // Move constructor.
   SQLParserResult::SQLParserResult(SQLParserResult&& moved) {
     isValid_ = moved.isValid_;
-    errorMsg_ = moved.errorMsg_;
+    errorMsg_ = std::move(moved.errorMsg_);
+    errorLine_ = moved.errorLine_;
+    errorColumn_ = moved.errorColumn_;
+    errorOffset_ = moved.errorOffset_;
     statements_ = std::move(moved.statements_);
+    parameters_ = std::move(moved.parameters_);
+    parameterSlots_ = std::move(moved.parameterSlots_);
+    heapLiterals_ = std::move(moved.heapLiterals_);
+    arena_ = moved.arena_;
 
-    moved.errorMsg_ = nullptr;
+    // Moved-from containers are only guaranteed to be valid, not empty.
+    moved.heapLiterals_.clear();
+
+    moved.arena_ = nullptr;
     moved.reset();
   }
 
   SQLParserResult::~SQLParserResult() {
     reset();
+    if (arena_ != nullptr) arena_->release();
   }
 
   void SQLParserResult::addStatement(SQLStatement* stmt) {
@@ -49,7 +70,7 @@ namespace hsql {
   }
 
   const char* SQLParserResult::errorMsg() const {
-    return errorMsg_;
+    return errorMsg_.empty() ? nullptr : errorMsg_.c_str();
   }
 
   int SQLParserResult::errorLine() const {
@@ -60,16 +81,42 @@ namespace hsql {
     return errorColumn_;
   }
 
+  int SQLParserResult::errorOffset() const {
+    return errorOffset_;
+  }
+
   void SQLParserResult::setIsValid(bool isValid) {
     isValid_ = isValid;
   }
 
   void SQLParserResult::setErrorDetails(char* errorMsg, int errorLine, int errorColumn) {
-    errorMsg_ = errorMsg;
+    if (errorMsg != nullptr) {
+      errorMsg_.assign(errorMsg);
+      free(errorMsg);
+    } else {
+      errorMsg_.clear();
+    }
     errorLine_ = errorLine;
     errorColumn_ = errorColumn;
   }
 
+  void SQLParserResult::setErrorDetails(const char* errorMsg, const char* query, int errorOffset) {
+    // Lines and columns are counted from 0.
+    const char* error = query + errorOffset;
+    const char* lineStart = query;
+    int line = 0;
+    const char* newline;
+    while ((newline = (const char*) memchr(lineStart, '\n', error - lineStart)) != nullptr) {
+      lineStart = newline + 1;
+      ++line;
+    }
+
+    errorMsg_.assign(errorMsg);
+    errorLine_ = line;
+    errorColumn_ = error - lineStart;
+    errorOffset_ = errorOffset;
+  }
+
   const std::vector<SQLStatement*>& SQLParserResult::getStatements() const {
     return statements_;
   }
@@ -78,35 +125,256 @@ namespace hsql {
     std::vector<SQLStatement*> copy = statements_;
 
     statements_.clear();
+    parameters_.clear();
+    parameterSlots_.clear();
+
+    // The released statements keep the arena alive. The next parse into
+    // this result uses a new arena, so that the released statements can be
+    // deleted on another thread while this result is in use.
+    if (arena_ != nullptr) {
+      arena_->release();
+      arena_ = nullptr;
+    }
 
     return copy;
   }
 
   void SQLParserResult::reset() {
+    // If this result holds the only references on its arena, the statements
+    // in it are dropped without running their destructors. The arena then
+    // reclaims all of their memory at once.
+    size_t arenaStatements = 0;
+    if (arena_ != nullptr) {
+      for (SQLStatement* statement : statements_) {
+        if (statement->arena() == arena_) ++arenaStatements;
+      }
+    }
+    bool releaseInBulk = arenaStatements > 0 && arena_->references() == arenaStatements + 1;
+
     for (SQLStatement* statement : statements_) {
-      delete statement;
+      if (releaseInBulk && statement->arena() == arena_) {
+        arena_->release();
+      } else {
+        delete statement;
+      }
     }
     statements_.clear();
+    parameters_.clear();
+    parameterSlots_.clear();
+
+    for (Expr* literal : heapLiterals_) {
+      delete literal;
+    }
+    heapLiterals_.clear();
+
+    if (arena_ != nullptr) {
+      if (arena_->isShared()) {
+        // Some statements are still in use (i.e. released statements).
+        // They keep the arena alive until they are deleted.
+        arena_->release();
+        arena_ = nullptr;
+      } else {
+        arena_->reset();
+      }
+    }
 
     isValid_ = false;
 
-    free(errorMsg_);
-    errorMsg_ = nullptr;
+    errorMsg_.clear();
     errorLine_ = -1;
     errorColumn_ = -1;
+    errorOffset_ = -1;
   }
 
   // Does NOT take ownership.
   void SQLParserResult::addParameter(Expr* parameter) {
-    parameters_.push_back(parameter);
-    std::sort(parameters_.begin(), parameters_.end(),
+    // The parser adds placeholders in the order of their ids, which
+    // only needs an append.
+    if (parameters_.empty() || parameters_.back()->ival <= parameter->ival) {
+      parameters_.push_back(parameter);
+    } else {
+      auto position = std::upper_bound(parameters_.begin(), parameters_.end(), parameter,
+      [](const Expr * a, const Expr * b) {
+        return a->ival < b->ival;
+      });
+      parameters_.insert(position, parameter);
+    }
+
+    size_t id = parameter->ival;
+    if (id >= parameterSlots_.size()) parameterSlots_.resize(id + 1, nullptr);
+    if (parameterSlots_[id] == nullptr) parameterSlots_[id] = parameter;
+  }
+
+  const std::vector<Expr*>& SQLParserResult::parameters() const {
+    return parameters_;
+  }
+
+  size_t SQLParserResult::parameterCount() const {
+    return parameterSlots_.size();
+  }
+
+  Expr* SQLParserResult::getParameter(size_t id) const {
+    return id < parameterSlots_.size() ? parameterSlots_[id] : nullptr;
+  }
+
+  void SQLParserResult::parameterizeLiterals(std::vector<const Expr*>* values) {
+    size_t firstId = parameterCount();
+    std::vector<Expr*> added;
+    std::vector<Expr*> literals;
+    for (SQLStatement* statement : statements_) {
+      size_t first = literals.size();
+      hsql::parameterizeLiterals(statement, firstId + added.size(), &added, &literals);
+      // Literals in an arena are freed with it.
+      if (statement->arena() == nullptr) {
+        heapLiterals_.insert(heapLiterals_.end(), literals.begin() + first, literals.end());
+      }
+    }
+
+    for (Expr* parameter : added) {
+      addParameter(parameter);
+    }
+
+    if (values != nullptr) {
+      values->clear();
+      values->reserve(parameterSlots_.size());
+      for (size_t id = 0; id < parameterSlots_.size(); ++id) {
+        const Expr* parameter = parameterSlots_[id];
+        if (id >= firstId) {
+          values->push_back(literals[id - firstId]);
+        } else {
+          values->push_back(parameter != nullptr ? parameter->expr : nullptr);
+        }
+      }
+    }
+  }
+
+  static bool isBindable(const Expr* value) {
+    return value != nullptr &&
+           (value->isType(kExprLiteralInt) || value->isType(kExprLiteralFloat) ||
+            value->isType(kExprLiteralString) || value->isType(kExprLiteralNull));
+  }
+
+  // Stores a copy of the value as the operand of the placeholder. A literal
+  // that is already bound is overwritten. Strings of literals in an arena
+  // are reused as long as the new value fits, so binding again does not
+  // grow the arena of the placeholder. The bound literal keeps the size of
+  // its string buffer in ival2.
+  void SQLParserResult::bindValue(Expr* parameter, const Expr* value) {
+    ArenaScope scope(parameter->arena());
+    Expr* bound = parameter->expr;
+    if (bound == nullptr) {
+      bound = new Expr(value->type);
+      parameter->expr = bound;
+    }
+
+    char* previous = bound->name;
+    size_t capacity = bound->ival2;
+    bound->name = nullptr;
+    bound->ival2 = 0;
+    bound->type = value->type;
+    bound->ival = value->ival;
+    bound->fval = value->fval;
+    if (value->name != nullptr) {
+      size_t length = strlen(value->name);
+      if (capacity > length) {
+        memmove(previous, value->name, length + 1);
+        bound->name = previous;
+        bound->ival2 = capacity;
+      } else {
+        bound->name = copyString(value->name, length);
+        // Strings on the heap are freed by the next binding instead.
+        if (bound->arena() != nullptr) bound->ival2 = length + 1;
+      }
+    }
+    if (previous != bound->name) freeString(previous, bound->arena());
+  }
+
+  bool SQLParserResult::bindParameters(const std::vector<const Expr*>& values) {
+    if (values.size() != parameterCount()) return false;
+    for (const Expr* value : values) {
+      if (!isBindable(value)) return false;
+    }
+
+    // Numbered placeholders can occur more than once.
+    for (Expr* parameter : parameters_) {
+      bindValue(parameter, values[parameter->ival]);
+    }
+    return true;
+  }
+
+  bool SQLParserResult::bindParameters(const std::vector<Expr*>& values) {
+    return bindParameters(std::vector<const Expr*>(values.begin(), values.end()));
+  }
+
+  bool SQLParserResult::bindParameters(const std::vector<const Expr*>& values, SQLParserResult* bound) const {
+    if (values.size() != parameterCount()) return false;
+    for (const Expr* value : values) {
+      if (!isBindable(value)) return false;
+    }
+
+    clone(bound);
+    return bound->bindParameters(values);
+  }
+
+  void SQLParserResult::clone(SQLParserResult* copy) const {
+    copy->reset();
+    ArenaScope scope(copy->arena());
+
+    std::vector<Expr*> parameters;
+    copy->statements_.reserve(statements_.size());
+    for (const SQLStatement* statement : statements_) {
+      SQLStatement* statementCopy = cloneStatement(statement, &parameters);
+      if (statementCopy != nullptr) copy->statements_.push_back(statementCopy);
+    }
+    std::stable_sort(parameters.begin(), parameters.end(),
     [](const Expr * a, const Expr * b) {
       return a->ival < b->ival;
     });
+    for (Expr* parameter : parameters) {
+      copy->addParameter(parameter);
+    }
+
+    copy->isValid_ = isValid_;
+    copy->errorMsg_ = errorMsg_;
+    copy->errorLine_ = errorLine_;
+    copy->errorColumn_ = errorColumn_;
+    copy->errorOffset_ = errorOffset_;
   }
 
-  const std::vector<Expr*>& SQLParserResult::parameters() {
-    return parameters_;
+  bool SQLParserResult::serialize(std::string* buffer) const {
+    return serializeResult(*this, buffer);
+  }
+
+  bool SQLParserResult::deserialize(const void* data, size_t size) {
+    const binary::Result* encoded = binary::open(data, size);
+    if (encoded == nullptr) {
+      reset();
+      return false;
+    }
+    deserialize(encoded);
+    return true;
+  }
+
+  void SQLParserResult::deserialize(const binary::Result* encoded) {
+    reset();
+    ArenaScope scope(arena());
+
+    std::vector<Expr*> parameters;
+    decodeResult(encoded, &statements_, &parameters);
+    for (Expr* parameter : parameters) {
+      addParameter(parameter);
+    }
+
+    isValid_ = encoded->isValid;
+    if (encoded->errorMsg) errorMsg_ = encoded->errorMsg.get();
+    errorLine_ = encoded->errorLine;
+    errorColumn_ = encoded->errorColumn;
+    errorOffset_ = encoded->errorOffset;
+  }
+
+  Arena* SQLParserResult::arena() {
+    if (arena_ == nullptr) arena_ = new Arena();
+    return arena_;
   }
 
 } // namespace hsql
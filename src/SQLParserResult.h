@@ -2,12 +2,27 @@
 #define __SQLPARSER__SQLPARSER_RESULT_H__
 
 #include "sql/SQLStatement.h"
+#include "util/arena.h"
+#include <string>
 
 namespace hsql {
+  namespace binary {
+    struct Result;
+  }
+
   // Represents the result of the SQLParser.
   // If parsing was successful it contains a list of SQLStatement.
+  //
+  // The parsed nodes, as well as their strings (char* fields) and vectors,
+  // are allocated from the arena of the result and are freed with it. They
+  // must not be free()d or deleted separately. Strings and vectors that are
+  // assigned to parsed nodes have to be created with copyString and
+  // newVector in the arena of the node (see ArenaScope), or they are leaked.
   class SQLParserResult {
    public:
+    // Highest number of a numbered placeholder ($n).
+    static const int64_t kMaxParameterNumber = 65535;
+
     // Initialize with empty statement list.
     SQLParserResult();
 
@@ -34,6 +49,11 @@ namespace hsql {
     // Takes ownership of errorMsg.
     void setErrorDetails(char* errorMsg, int errorLine, int errorColumn);
 
+    // Set the details of the error from its byte offset in the query.
+    // The line and column are computed from the query text.
+    // The message is copied.
+    void setErrorDetails(const char* errorMsg, const char* query, int errorOffset);
+
     // Returns the error message, if an error occurred.
     const char* errorMsg() const;
 
@@ -43,6 +63,9 @@ namespace hsql {
     // Returns the column number of the occurrance of the error in the query.
     int errorColumn() const;
 
+    // Returns the byte offset of the occurrance of the error in the query.
+    int errorOffset() const;
+
     // Adds a statement to the result list of statements.
     // SQLParserResult takes ownership of the statement.
     void addStatement(SQLStatement* stmt);
@@ -57,26 +80,96 @@ namespace hsql {
     const std::vector<SQLStatement*>& getStatements() const;
 
     // Returns a copy of the list of all statements in this result.
-    // Removes them from this result.
+    // Removes them from this result and hands the arena over to them, the
+    // result starts over with a new arena. Each statement has to be deleted.
     std::vector<SQLStatement*> releaseStatements();
 
     // Deletes all statements and other data within the result.
+    // The memory of the result (statement and parameter lists, arena and
+    // error message) is kept, so a result can be reused for many parses.
     void reset();
 
+    // Adds a placeholder. Placeholders are kept in the order of their ids
+    // (ival), adding them in that order takes constant time.
     // Does NOT take ownership.
     void addParameter(Expr* parameter);
 
-    const std::vector<Expr*>& parameters();
+    // Returns all placeholders in the order of their ids. Numbered
+    // placeholders ($1) can occur more than once.
+    const std::vector<Expr*>& parameters() const;
+
+    // Returns the number of values that are needed to bind all placeholders,
+    // which is the highest id plus one.
+    size_t parameterCount() const;
+
+    // Returns the first placeholder with the given id, or nullptr if there is none.
+    Expr* getParameter(size_t id) const;
+
+    // Replaces the literals in all statements by placeholders, which are
+    // added to parameters(). See util/parameterize.h.
+    // The placeholders do not keep the literals, so queries that only differ
+    // in their literals result in the same statements. If values is given,
+    // it is set to one entry per parameter id: the literal that the
+    // parameter replaced, the bound value of the placeholders that were
+    // already part of the query, or nullptr if they are not bound. The
+    // literals are kept until the result is reset, or with the arena of
+    // their statement (see releaseStatements).
+    void parameterizeLiterals(std::vector<const Expr*>* values = nullptr);
+
+    // Binds one value to each parameter id (see parameterCount).
+    // Values have to be integer, float, string or NULL literals. A copy of
+    // each value is stored as the operand (expr) of its placeholder and
+    // replaces any value bound before.
+    // Placeholders stay in place, so the result can be bound again.
+    // Returns false and binds nothing if the number of values does not match
+    // the number of parameters or if a value is not a literal.
+    bool bindParameters(const std::vector<const Expr*>& values);
+
+    // Binds the arguments of an EXECUTE statement (ExecuteStatement::parameters).
+    bool bindParameters(const std::vector<Expr*>& values);
+
+    // Binds the values into a copy of this result, which is used as a
+    // template. See clone. bound is not changed if the values do not match.
+    bool bindParameters(const std::vector<const Expr*>& values, SQLParserResult* bound) const;
+
+    // Resets copy and fills it with a deep copy of this result.
+    // The copy is allocated from the arena of copy and shares no nodes or
+    // strings with this result, so either can be changed or deleted
+    // independently. See util/clone.h.
+    void clone(SQLParserResult* copy) const;
+
+    // Sets buffer to a compact binary image of this result, including its
+    // parameters and error. The image can be read in place (see
+    // util/serialize.h) or decoded into a result again.
+    // Returns false and clears buffer if the image would exceed the 2 GiB
+    // that its offsets can address.
+    bool serialize(std::string* buffer) const;
+
+    // Resets this result and fills it with the result encoded in an image,
+    // allocated from the arena of this result like a copy (see clone).
+    // Returns false and leaves the result empty if data does not hold a
+    // complete and well-formed image (see binary::open).
+    bool deserialize(const void* data, size_t size);
+
+    // Resets this result and fills it with an encoded result.
+    void deserialize(const binary::Result* encoded);
+
+    // Returns the arena that owns the nodes and strings created by the parser.
+    // The arena is created on first use.
+    Arena* arena();
 
    private:
+    // Binds the value to one placeholder. See bindParameters.
+    void bindValue(Expr* parameter, const Expr* value);
+
     // List of statements within the result.
     std::vector<SQLStatement*> statements_;
 
     // Flag indicating the parsing was successful.
     bool isValid_;
 
-    // Error message, if an error occurred.
-    char* errorMsg_;
+    // Error message, if an error occurred. Empty otherwise.
+    std::string errorMsg_;
 
     // Line number of the occurrance of the error in the query.
     int errorLine_;
@@ -84,8 +177,22 @@ namespace hsql {
     // Column number of the occurrance of the error in the query.
     int errorColumn_;
 
+    // Byte offset of the occurrance of the error in the query.
+    int errorOffset_;
+
     // Does NOT have ownership.
     std::vector<Expr*> parameters_;
+
+    // First placeholder of each id, nullptr for ids without a placeholder.
+    std::vector<Expr*> parameterSlots_;
+
+    // Literals replaced by parameterizeLiterals in statements that are not
+    // allocated from an arena.
+    std::vector<Expr*> heapLiterals_;
+
+    // Memory of all nodes that were parsed into this result.
+    // Shared with nodes that are still alive after they were released.
+    Arena* arena_;
   };
 
 } // namespace hsql
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -68,9 +73,8 @@
 #define yydebug         hsql_debug
 #define yynerrs         hsql_nerrs
 
-
-/* Copy the first part of user declarations.  */
-#line 1 "bison_parser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 1 "bison_parser.y"
 
 /**
  * bison_parser.y
@@ -89,320 +93,419 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 
 using namespace hsql;
 
-int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const char *msg) {
+int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state, const char *msg) {
 	result->setIsValid(false);
-	result->setErrorDetails(strdup(msg), llocp->first_line, llocp->first_column);
+	result->setErrorDetails(msg, hsql_get_input(scanner), llocp->first_offset);
 	return 0;
 }
 
+// Starts a chain of set operations on a select, which the operator type
+// continues. If the select is itself a chain, the new branches
+// are only appended to it when that does not change the result: the chain
+// has no ORDER BY or LIMIT of its own, and INTERSECT, which binds more
+// tightly, only extends chains of INTERSECTs. Otherwise the chain is nested
+// in a new chain on the same first select (see SetOperation::nested).
+static SelectStatement* beginSetOperation(SelectStatement* first, SetType type) {
+	SetOperation* operation = first->setOperation;
+	if (operation == nullptr) return first;
+
+	bool extend = operation->order == nullptr && operation->limit == nullptr;
+	if (extend && type == kSetIntersect) {
+		for (const SetBranch& branch : *operation->branches) {
+			if (branch.type != kSetIntersect) extend = false;
+		}
+	}
+	if (extend) return first;
 
-#line 103 "bison_parser.cpp" /* yacc.c:339  */
+	first->setOperation = new SetOperation();
+	first->setOperation->nested = operation;
+	return first;
+}
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+// Appends a select to the chain of first. INTERSECT binds more tightly than
+// UNION and EXCEPT, so a run of INTERSECTs after one of those continues the
+// select in front of it instead, as if it was parenthesized: in
+// A UNION B INTERSECT C, B holds the chain INTERSECT C. The branches of a
+// chain can then be evaluated from left to right.
+static void addSetBranch(SelectStatement* first, SetType type, bool all, SelectStatement* select) {
+	SetOperation* operation = first->setOperation;
+	if (type == kSetIntersect && operation != nullptr && !operation->branches->empty() &&
+	    operation->branches->back().type != kSetIntersect) {
+		first = beginSetOperation(operation->branches->back().select, type);
+	}
+	first->addSetBranch(type, all, select);
+}
+
+
+#line 145 "bison_parser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
 #  else
-#   define YY_NULLPTR 0
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
 #  endif
 # endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "bison_parser.h".  */
-#ifndef YY_HSQL_BISON_PARSER_H_INCLUDED
-# define YY_HSQL_BISON_PARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef HSQL_DEBUG
-# if defined YYDEBUG
-#if YYDEBUG
-#   define HSQL_DEBUG 1
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define HSQL_DEBUG 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
-# else /* ! defined YYDEBUG */
-#  define HSQL_DEBUG 0
-# endif /* ! defined YYDEBUG */
-#endif  /* ! defined HSQL_DEBUG */
-#if HSQL_DEBUG
-extern int hsql_debug;
-#endif
-/* "%code requires" blocks.  */
-#line 35 "bison_parser.y" /* yacc.c:355  */
-
-// %code requires block
-
-#include "../sql/statements.h"
-#include "../SQLParserResult.h"
-#include "parser_typedef.h"
-
-// Auto update column and line number
-#define YY_USER_ACTION \
-		yylloc->first_line = yylloc->last_line; \
-		yylloc->first_column = yylloc->last_column; \
-		for(int i = 0; yytext[i] != '\0'; i++) { \
-			yylloc->total_column++; \
-				if(yytext[i] == '\n') { \
-						yylloc->last_line++; \
-						yylloc->last_column = 0; \
-				} \
-				else { \
-						yylloc->last_column++; \
-				} \
-		}
-
-#line 164 "bison_parser.cpp" /* yacc.c:355  */
-
-/* Token type.  */
-#ifndef HSQL_TOKENTYPE
-# define HSQL_TOKENTYPE
-  enum hsql_tokentype
-  {
-    SQL_IDENTIFIER = 258,
-    SQL_STRING = 259,
-    SQL_FLOATVAL = 260,
-    SQL_INTVAL = 261,
-    SQL_DEALLOCATE = 262,
-    SQL_PARAMETERS = 263,
-    SQL_INTERSECT = 264,
-    SQL_TEMPORARY = 265,
-    SQL_TIMESTAMP = 266,
-    SQL_DISTINCT = 267,
-    SQL_NVARCHAR = 268,
-    SQL_RESTRICT = 269,
-    SQL_TRUNCATE = 270,
-    SQL_ANALYZE = 271,
-    SQL_BETWEEN = 272,
-    SQL_CASCADE = 273,
-    SQL_COLUMNS = 274,
-    SQL_CONTROL = 275,
-    SQL_DEFAULT = 276,
-    SQL_EXECUTE = 277,
-    SQL_EXPLAIN = 278,
-    SQL_HISTORY = 279,
-    SQL_INTEGER = 280,
-    SQL_NATURAL = 281,
-    SQL_PREPARE = 282,
-    SQL_PRIMARY = 283,
-    SQL_SCHEMAS = 284,
-    SQL_SPATIAL = 285,
-    SQL_VIRTUAL = 286,
-    SQL_BEFORE = 287,
-    SQL_COLUMN = 288,
-    SQL_CREATE = 289,
-    SQL_DELETE = 290,
-    SQL_DIRECT = 291,
-    SQL_DOUBLE = 292,
-    SQL_ESCAPE = 293,
-    SQL_EXCEPT = 294,
-    SQL_EXISTS = 295,
-    SQL_GLOBAL = 296,
-    SQL_HAVING = 297,
-    SQL_IMPORT = 298,
-    SQL_INSERT = 299,
-    SQL_ISNULL = 300,
-    SQL_OFFSET = 301,
-    SQL_RENAME = 302,
-    SQL_SCHEMA = 303,
-    SQL_SELECT = 304,
-    SQL_SORTED = 305,
-    SQL_TABLES = 306,
-    SQL_UNIQUE = 307,
-    SQL_UNLOAD = 308,
-    SQL_UPDATE = 309,
-    SQL_VALUES = 310,
-    SQL_AFTER = 311,
-    SQL_ALTER = 312,
-    SQL_CROSS = 313,
-    SQL_DELTA = 314,
-    SQL_GROUP = 315,
-    SQL_INDEX = 316,
-    SQL_INNER = 317,
-    SQL_LIMIT = 318,
-    SQL_LOCAL = 319,
-    SQL_MERGE = 320,
-    SQL_MINUS = 321,
-    SQL_ORDER = 322,
-    SQL_OUTER = 323,
-    SQL_RIGHT = 324,
-    SQL_TABLE = 325,
-    SQL_UNION = 326,
-    SQL_USING = 327,
-    SQL_WHERE = 328,
-    SQL_CALL = 329,
-    SQL_CASE = 330,
-    SQL_DATE = 331,
-    SQL_DESC = 332,
-    SQL_DROP = 333,
-    SQL_ELSE = 334,
-    SQL_FILE = 335,
-    SQL_FROM = 336,
-    SQL_FULL = 337,
-    SQL_HASH = 338,
-    SQL_HINT = 339,
-    SQL_INTO = 340,
-    SQL_JOIN = 341,
-    SQL_LEFT = 342,
-    SQL_LIKE = 343,
-    SQL_LOAD = 344,
-    SQL_NULL = 345,
-    SQL_PART = 346,
-    SQL_PLAN = 347,
-    SQL_SHOW = 348,
-    SQL_TEXT = 349,
-    SQL_THEN = 350,
-    SQL_TIME = 351,
-    SQL_VIEW = 352,
-    SQL_WHEN = 353,
-    SQL_WITH = 354,
-    SQL_ADD = 355,
-    SQL_ALL = 356,
-    SQL_AND = 357,
-    SQL_ASC = 358,
-    SQL_CSV = 359,
-    SQL_END = 360,
-    SQL_FOR = 361,
-    SQL_INT = 362,
-    SQL_KEY = 363,
-    SQL_NOT = 364,
-    SQL_OFF = 365,
-    SQL_SET = 366,
-    SQL_TBL = 367,
-    SQL_TOP = 368,
-    SQL_AS = 369,
-    SQL_BY = 370,
-    SQL_IF = 371,
-    SQL_IN = 372,
-    SQL_IS = 373,
-    SQL_OF = 374,
-    SQL_ON = 375,
-    SQL_OR = 376,
-    SQL_TO = 377,
-    SQL_ARRAY = 378,
-    SQL_CONCAT = 379,
-    SQL_ILIKE = 380,
-    SQL_EQUALS = 381,
-    SQL_NOTEQUALS = 382,
-    SQL_LESS = 383,
-    SQL_GREATER = 384,
-    SQL_LESSEQ = 385,
-    SQL_GREATEREQ = 386,
-    SQL_NOTNULL = 387,
-    SQL_UMINUS = 388
-  };
-#endif
-
-/* Value type.  */
-#if ! defined HSQL_STYPE && ! defined HSQL_STYPE_IS_DECLARED
+# endif
 
-union HSQL_STYPE
+#include "bison_parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 93 "bison_parser.y" /* yacc.c:355  */
-
-	double fval;
-	int64_t ival;
-	char* sval;
-	uintmax_t uval;
-	bool bval;
-
-	hsql::SQLStatement* statement;
-	hsql::SelectStatement* 	select_stmt;
-	hsql::ImportStatement* 	import_stmt;
-	hsql::CreateStatement* 	create_stmt;
-	hsql::InsertStatement* 	insert_stmt;
-	hsql::DeleteStatement* 	delete_stmt;
-	hsql::UpdateStatement* 	update_stmt;
-	hsql::DropStatement*   	drop_stmt;
-	hsql::PrepareStatement* prep_stmt;
-	hsql::ExecuteStatement* exec_stmt;
-	hsql::ShowStatement*    show_stmt;
-	
-	hsql::TableName table_name;
-	hsql::TableRef* table;
-	hsql::Expr* expr;
-	hsql::OrderDescription* order;
-	hsql::OrderType order_type;
-	hsql::LimitDescription* limit;
-	hsql::ColumnDefinition* column_t;
-	hsql::GroupByDescription* group_t;
-	hsql::UpdateClause* update_t;
-
-	std::vector<hsql::SQLStatement*>* stmt_vec;
-
-	std::vector<char*>* str_vec;
-	std::vector<hsql::TableRef*>* table_vec;
-	std::vector<hsql::ColumnDefinition*>* column_vec;
-	std::vector<hsql::UpdateClause*>* update_vec;
-	std::vector<hsql::Expr*>* expr_vec;
-	std::vector<hsql::OrderDescription*>* order_vec;
-
-#line 349 "bison_parser.cpp" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENTIFIER = 3,                 /* IDENTIFIER  */
+  YYSYMBOL_STRING = 4,                     /* STRING  */
+  YYSYMBOL_FLOATVAL = 5,                   /* FLOATVAL  */
+  YYSYMBOL_INTVAL = 6,                     /* INTVAL  */
+  YYSYMBOL_DEALLOCATE = 7,                 /* DEALLOCATE  */
+  YYSYMBOL_PARAMETERS = 8,                 /* PARAMETERS  */
+  YYSYMBOL_INTERSECT = 9,                  /* INTERSECT  */
+  YYSYMBOL_TEMPORARY = 10,                 /* TEMPORARY  */
+  YYSYMBOL_TIMESTAMP = 11,                 /* TIMESTAMP  */
+  YYSYMBOL_DISTINCT = 12,                  /* DISTINCT  */
+  YYSYMBOL_NVARCHAR = 13,                  /* NVARCHAR  */
+  YYSYMBOL_RESTRICT = 14,                  /* RESTRICT  */
+  YYSYMBOL_TRUNCATE = 15,                  /* TRUNCATE  */
+  YYSYMBOL_ANALYZE = 16,                   /* ANALYZE  */
+  YYSYMBOL_BETWEEN = 17,                   /* BETWEEN  */
+  YYSYMBOL_CASCADE = 18,                   /* CASCADE  */
+  YYSYMBOL_COLUMNS = 19,                   /* COLUMNS  */
+  YYSYMBOL_CONTROL = 20,                   /* CONTROL  */
+  YYSYMBOL_DEFAULT = 21,                   /* DEFAULT  */
+  YYSYMBOL_EXECUTE = 22,                   /* EXECUTE  */
+  YYSYMBOL_EXPLAIN = 23,                   /* EXPLAIN  */
+  YYSYMBOL_HISTORY = 24,                   /* HISTORY  */
+  YYSYMBOL_INTEGER = 25,                   /* INTEGER  */
+  YYSYMBOL_NATURAL = 26,                   /* NATURAL  */
+  YYSYMBOL_PREPARE = 27,                   /* PREPARE  */
+  YYSYMBOL_PRIMARY = 28,                   /* PRIMARY  */
+  YYSYMBOL_SCHEMAS = 29,                   /* SCHEMAS  */
+  YYSYMBOL_SPATIAL = 30,                   /* SPATIAL  */
+  YYSYMBOL_VIRTUAL = 31,                   /* VIRTUAL  */
+  YYSYMBOL_BEFORE = 32,                    /* BEFORE  */
+  YYSYMBOL_COLUMN = 33,                    /* COLUMN  */
+  YYSYMBOL_CREATE = 34,                    /* CREATE  */
+  YYSYMBOL_DELETE = 35,                    /* DELETE  */
+  YYSYMBOL_DIRECT = 36,                    /* DIRECT  */
+  YYSYMBOL_DOUBLE = 37,                    /* DOUBLE  */
+  YYSYMBOL_ESCAPE = 38,                    /* ESCAPE  */
+  YYSYMBOL_EXCEPT = 39,                    /* EXCEPT  */
+  YYSYMBOL_EXISTS = 40,                    /* EXISTS  */
+  YYSYMBOL_GLOBAL = 41,                    /* GLOBAL  */
+  YYSYMBOL_HAVING = 42,                    /* HAVING  */
+  YYSYMBOL_IMPORT = 43,                    /* IMPORT  */
+  YYSYMBOL_INSERT = 44,                    /* INSERT  */
+  YYSYMBOL_ISNULL = 45,                    /* ISNULL  */
+  YYSYMBOL_OFFSET = 46,                    /* OFFSET  */
+  YYSYMBOL_RENAME = 47,                    /* RENAME  */
+  YYSYMBOL_SCHEMA = 48,                    /* SCHEMA  */
+  YYSYMBOL_SELECT = 49,                    /* SELECT  */
+  YYSYMBOL_SORTED = 50,                    /* SORTED  */
+  YYSYMBOL_TABLES = 51,                    /* TABLES  */
+  YYSYMBOL_UNIQUE = 52,                    /* UNIQUE  */
+  YYSYMBOL_UNLOAD = 53,                    /* UNLOAD  */
+  YYSYMBOL_UPDATE = 54,                    /* UPDATE  */
+  YYSYMBOL_VALUES = 55,                    /* VALUES  */
+  YYSYMBOL_AFTER = 56,                     /* AFTER  */
+  YYSYMBOL_ALTER = 57,                     /* ALTER  */
+  YYSYMBOL_CROSS = 58,                     /* CROSS  */
+  YYSYMBOL_DELTA = 59,                     /* DELTA  */
+  YYSYMBOL_GROUP = 60,                     /* GROUP  */
+  YYSYMBOL_INDEX = 61,                     /* INDEX  */
+  YYSYMBOL_INNER = 62,                     /* INNER  */
+  YYSYMBOL_LIMIT = 63,                     /* LIMIT  */
+  YYSYMBOL_LOCAL = 64,                     /* LOCAL  */
+  YYSYMBOL_MERGE = 65,                     /* MERGE  */
+  YYSYMBOL_MINUS = 66,                     /* MINUS  */
+  YYSYMBOL_ORDER = 67,                     /* ORDER  */
+  YYSYMBOL_OUTER = 68,                     /* OUTER  */
+  YYSYMBOL_RIGHT = 69,                     /* RIGHT  */
+  YYSYMBOL_TABLE = 70,                     /* TABLE  */
+  YYSYMBOL_UNION = 71,                     /* UNION  */
+  YYSYMBOL_USING = 72,                     /* USING  */
+  YYSYMBOL_WHERE = 73,                     /* WHERE  */
+  YYSYMBOL_CALL = 74,                      /* CALL  */
+  YYSYMBOL_CASE = 75,                      /* CASE  */
+  YYSYMBOL_DATE = 76,                      /* DATE  */
+  YYSYMBOL_DESC = 77,                      /* DESC  */
+  YYSYMBOL_DROP = 78,                      /* DROP  */
+  YYSYMBOL_ELSE = 79,                      /* ELSE  */
+  YYSYMBOL_FILE = 80,                      /* FILE  */
+  YYSYMBOL_FROM = 81,                      /* FROM  */
+  YYSYMBOL_FULL = 82,                      /* FULL  */
+  YYSYMBOL_HASH = 83,                      /* HASH  */
+  YYSYMBOL_HINT = 84,                      /* HINT  */
+  YYSYMBOL_INTO = 85,                      /* INTO  */
+  YYSYMBOL_JOIN = 86,                      /* JOIN  */
+  YYSYMBOL_LEFT = 87,                      /* LEFT  */
+  YYSYMBOL_LIKE = 88,                      /* LIKE  */
+  YYSYMBOL_LOAD = 89,                      /* LOAD  */
+  YYSYMBOL_NULL = 90,                      /* NULL  */
+  YYSYMBOL_PART = 91,                      /* PART  */
+  YYSYMBOL_PLAN = 92,                      /* PLAN  */
+  YYSYMBOL_SHOW = 93,                      /* SHOW  */
+  YYSYMBOL_TEXT = 94,                      /* TEXT  */
+  YYSYMBOL_THEN = 95,                      /* THEN  */
+  YYSYMBOL_TIME = 96,                      /* TIME  */
+  YYSYMBOL_VIEW = 97,                      /* VIEW  */
+  YYSYMBOL_WHEN = 98,                      /* WHEN  */
+  YYSYMBOL_WITH = 99,                      /* WITH  */
+  YYSYMBOL_ADD = 100,                      /* ADD  */
+  YYSYMBOL_ALL = 101,                      /* ALL  */
+  YYSYMBOL_AND = 102,                      /* AND  */
+  YYSYMBOL_ASC = 103,                      /* ASC  */
+  YYSYMBOL_CSV = 104,                      /* CSV  */
+  YYSYMBOL_END = 105,                      /* END  */
+  YYSYMBOL_FOR = 106,                      /* FOR  */
+  YYSYMBOL_INT = 107,                      /* INT  */
+  YYSYMBOL_KEY = 108,                      /* KEY  */
+  YYSYMBOL_NOT = 109,                      /* NOT  */
+  YYSYMBOL_OFF = 110,                      /* OFF  */
+  YYSYMBOL_SET = 111,                      /* SET  */
+  YYSYMBOL_TBL = 112,                      /* TBL  */
+  YYSYMBOL_TOP = 113,                      /* TOP  */
+  YYSYMBOL_AS = 114,                       /* AS  */
+  YYSYMBOL_BY = 115,                       /* BY  */
+  YYSYMBOL_IF = 116,                       /* IF  */
+  YYSYMBOL_IN = 117,                       /* IN  */
+  YYSYMBOL_IS = 118,                       /* IS  */
+  YYSYMBOL_OF = 119,                       /* OF  */
+  YYSYMBOL_ON = 120,                       /* ON  */
+  YYSYMBOL_OR = 121,                       /* OR  */
+  YYSYMBOL_TO = 122,                       /* TO  */
+  YYSYMBOL_ARRAY = 123,                    /* ARRAY  */
+  YYSYMBOL_CONCAT = 124,                   /* CONCAT  */
+  YYSYMBOL_ILIKE = 125,                    /* ILIKE  */
+  YYSYMBOL_126_ = 126,                     /* '='  */
+  YYSYMBOL_EQUALS = 127,                   /* EQUALS  */
+  YYSYMBOL_NOTEQUALS = 128,                /* NOTEQUALS  */
+  YYSYMBOL_129_ = 129,                     /* '<'  */
+  YYSYMBOL_130_ = 130,                     /* '>'  */
+  YYSYMBOL_LESS = 131,                     /* LESS  */
+  YYSYMBOL_GREATER = 132,                  /* GREATER  */
+  YYSYMBOL_LESSEQ = 133,                   /* LESSEQ  */
+  YYSYMBOL_GREATEREQ = 134,                /* GREATEREQ  */
+  YYSYMBOL_NOTNULL = 135,                  /* NOTNULL  */
+  YYSYMBOL_136_ = 136,                     /* '+'  */
+  YYSYMBOL_137_ = 137,                     /* '-'  */
+  YYSYMBOL_138_ = 138,                     /* '*'  */
+  YYSYMBOL_139_ = 139,                     /* '/'  */
+  YYSYMBOL_140_ = 140,                     /* '%'  */
+  YYSYMBOL_141_ = 141,                     /* '^'  */
+  YYSYMBOL_UMINUS = 142,                   /* UMINUS  */
+  YYSYMBOL_143_ = 143,                     /* '['  */
+  YYSYMBOL_144_ = 144,                     /* ']'  */
+  YYSYMBOL_145_ = 145,                     /* '('  */
+  YYSYMBOL_146_ = 146,                     /* ')'  */
+  YYSYMBOL_147_ = 147,                     /* '.'  */
+  YYSYMBOL_148_ = 148,                     /* ';'  */
+  YYSYMBOL_149_ = 149,                     /* ','  */
+  YYSYMBOL_150_ = 150,                     /* '?'  */
+  YYSYMBOL_151_ = 151,                     /* '$'  */
+  YYSYMBOL_YYACCEPT = 152,                 /* $accept  */
+  YYSYMBOL_input = 153,                    /* input  */
+  YYSYMBOL_statement_list = 154,           /* statement_list  */
+  YYSYMBOL_statement = 155,                /* statement  */
+  YYSYMBOL_preparable_statement = 156,     /* preparable_statement  */
+  YYSYMBOL_opt_hints = 157,                /* opt_hints  */
+  YYSYMBOL_hint_list = 158,                /* hint_list  */
+  YYSYMBOL_hint = 159,                     /* hint  */
+  YYSYMBOL_prepare_statement = 160,        /* prepare_statement  */
+  YYSYMBOL_prepare_target_query = 161,     /* prepare_target_query  */
+  YYSYMBOL_execute_statement = 162,        /* execute_statement  */
+  YYSYMBOL_import_statement = 163,         /* import_statement  */
+  YYSYMBOL_import_file_type = 164,         /* import_file_type  */
+  YYSYMBOL_file_path = 165,                /* file_path  */
+  YYSYMBOL_show_statement = 166,           /* show_statement  */
+  YYSYMBOL_create_statement = 167,         /* create_statement  */
+  YYSYMBOL_opt_not_exists = 168,           /* opt_not_exists  */
+  YYSYMBOL_column_def_commalist = 169,     /* column_def_commalist  */
+  YYSYMBOL_column_def = 170,               /* column_def  */
+  YYSYMBOL_column_type = 171,              /* column_type  */
+  YYSYMBOL_drop_statement = 172,           /* drop_statement  */
+  YYSYMBOL_opt_exists = 173,               /* opt_exists  */
+  YYSYMBOL_delete_statement = 174,         /* delete_statement  */
+  YYSYMBOL_truncate_statement = 175,       /* truncate_statement  */
+  YYSYMBOL_insert_statement = 176,         /* insert_statement  */
+  YYSYMBOL_opt_column_list = 177,          /* opt_column_list  */
+  YYSYMBOL_values_start = 178,             /* values_start  */
+  YYSYMBOL_values_rows = 179,              /* values_rows  */
+  YYSYMBOL_values_row = 180,               /* values_row  */
+  YYSYMBOL_row_values = 181,               /* row_values  */
+  YYSYMBOL_row_value = 182,                /* row_value  */
+  YYSYMBOL_update_statement = 183,         /* update_statement  */
+  YYSYMBOL_update_clause_commalist = 184,  /* update_clause_commalist  */
+  YYSYMBOL_update_clause = 185,            /* update_clause  */
+  YYSYMBOL_select_statement = 186,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 187,        /* select_with_paren  */
+  YYSYMBOL_select_paren_or_clause = 188,   /* select_paren_or_clause  */
+  YYSYMBOL_select_no_paren = 189,          /* select_no_paren  */
+  YYSYMBOL_set_operation = 190,            /* set_operation  */
+  YYSYMBOL_paren_set_operation = 191,      /* paren_set_operation  */
+  YYSYMBOL_set_type = 192,                 /* set_type  */
+  YYSYMBOL_opt_all = 193,                  /* opt_all  */
+  YYSYMBOL_select_clause = 194,            /* select_clause  */
+  YYSYMBOL_opt_distinct = 195,             /* opt_distinct  */
+  YYSYMBOL_select_list = 196,              /* select_list  */
+  YYSYMBOL_from_clause = 197,              /* from_clause  */
+  YYSYMBOL_opt_where = 198,                /* opt_where  */
+  YYSYMBOL_opt_group = 199,                /* opt_group  */
+  YYSYMBOL_opt_having = 200,               /* opt_having  */
+  YYSYMBOL_opt_order = 201,                /* opt_order  */
+  YYSYMBOL_order_list = 202,               /* order_list  */
+  YYSYMBOL_order_desc = 203,               /* order_desc  */
+  YYSYMBOL_opt_order_type = 204,           /* opt_order_type  */
+  YYSYMBOL_opt_top = 205,                  /* opt_top  */
+  YYSYMBOL_opt_limit = 206,                /* opt_limit  */
+  YYSYMBOL_expr_list = 207,                /* expr_list  */
+  YYSYMBOL_literal_list = 208,             /* literal_list  */
+  YYSYMBOL_expr_alias = 209,               /* expr_alias  */
+  YYSYMBOL_expr = 210,                     /* expr  */
+  YYSYMBOL_operand = 211,                  /* operand  */
+  YYSYMBOL_scalar_expr = 212,              /* scalar_expr  */
+  YYSYMBOL_unary_expr = 213,               /* unary_expr  */
+  YYSYMBOL_binary_expr = 214,              /* binary_expr  */
+  YYSYMBOL_logic_expr = 215,               /* logic_expr  */
+  YYSYMBOL_in_expr = 216,                  /* in_expr  */
+  YYSYMBOL_in_list = 217,                  /* in_list  */
+  YYSYMBOL_case_expr = 218,                /* case_expr  */
+  YYSYMBOL_exists_expr = 219,              /* exists_expr  */
+  YYSYMBOL_comp_expr = 220,                /* comp_expr  */
+  YYSYMBOL_function_expr = 221,            /* function_expr  */
+  YYSYMBOL_array_expr = 222,               /* array_expr  */
+  YYSYMBOL_array_index = 223,              /* array_index  */
+  YYSYMBOL_between_expr = 224,             /* between_expr  */
+  YYSYMBOL_column_name = 225,              /* column_name  */
+  YYSYMBOL_literal = 226,                  /* literal  */
+  YYSYMBOL_string_literal = 227,           /* string_literal  */
+  YYSYMBOL_num_literal = 228,              /* num_literal  */
+  YYSYMBOL_int_literal = 229,              /* int_literal  */
+  YYSYMBOL_null_literal = 230,             /* null_literal  */
+  YYSYMBOL_param_expr = 231,               /* param_expr  */
+  YYSYMBOL_table_ref = 232,                /* table_ref  */
+  YYSYMBOL_table_ref_atomic = 233,         /* table_ref_atomic  */
+  YYSYMBOL_nonjoin_table_ref_atomic = 234, /* nonjoin_table_ref_atomic  */
+  YYSYMBOL_table_ref_commalist = 235,      /* table_ref_commalist  */
+  YYSYMBOL_table_ref_name = 236,           /* table_ref_name  */
+  YYSYMBOL_table_ref_name_no_alias = 237,  /* table_ref_name_no_alias  */
+  YYSYMBOL_table_name = 238,               /* table_name  */
+  YYSYMBOL_alias = 239,                    /* alias  */
+  YYSYMBOL_opt_alias = 240,                /* opt_alias  */
+  YYSYMBOL_join_clause = 241,              /* join_clause  */
+  YYSYMBOL_opt_join_type = 242,            /* opt_join_type  */
+  YYSYMBOL_join_condition = 243,           /* join_condition  */
+  YYSYMBOL_opt_semicolon = 244,            /* opt_semicolon  */
+  YYSYMBOL_ident_commalist = 245           /* ident_commalist  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union HSQL_STYPE HSQL_STYPE;
-# define HSQL_STYPE_IS_TRIVIAL 1
-# define HSQL_STYPE_IS_DECLARED 1
-#endif
-
-/* Location type.  */
-#if ! defined HSQL_LTYPE && ! defined HSQL_LTYPE_IS_DECLARED
-typedef struct HSQL_LTYPE HSQL_LTYPE;
-struct HSQL_LTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-};
-# define HSQL_LTYPE_IS_DECLARED 1
-# define HSQL_LTYPE_IS_TRIVIAL 1
-#endif
 
 
 
-int hsql_parse (hsql::SQLParserResult* result, yyscan_t scanner);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_HSQL_BISON_PARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 379 "bison_parser.cpp" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -410,15 +513,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -432,47 +548,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -485,8 +597,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -551,8 +677,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -562,18 +687,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -586,11 +712,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -602,12 +728,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -617,35 +743,38 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  52
+#define YYFINAL  54
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   552
+#define YYLAST   629
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  151
+#define YYNTOKENS  152
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  87
+#define YYNNTS  94
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  201
+#define YYNRULES  218
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  371
+#define YYNSTATES  397
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   388
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,   140,     2,     2,
+       2,     2,     2,     2,     2,     2,   151,   140,     2,     2,
      145,   146,   138,   136,   149,   137,   147,   139,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,   148,
      129,   126,   130,   150,     2,     2,     2,     2,     2,     2,
@@ -684,486 +813,503 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if HSQL_DEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   245,   245,   266,   267,   271,   275,   279,   286,   287,
-     288,   289,   290,   291,   292,   293,   294,   303,   304,   309,
-     310,   314,   318,   330,   337,   340,   344,   356,   365,   369,
-     379,   382,   396,   403,   410,   421,   422,   426,   427,   431,
-     438,   439,   440,   441,   451,   457,   463,   471,   472,   481,
-     490,   503,   510,   521,   522,   532,   541,   542,   546,   558,
-     559,   560,   577,   578,   582,   583,   587,   597,   614,   618,
-     619,   620,   624,   625,   629,   641,   642,   646,   650,   655,
-     656,   660,   665,   669,   670,   673,   674,   678,   679,   683,
-     687,   688,   689,   695,   696,   700,   701,   702,   709,   710,
-     714,   715,   719,   726,   727,   728,   729,   730,   734,   735,
-     736,   737,   738,   739,   740,   741,   742,   746,   747,   751,
-     752,   753,   754,   755,   759,   760,   761,   762,   763,   764,
-     765,   766,   767,   768,   769,   773,   774,   778,   779,   780,
-     781,   786,   788,   792,   793,   797,   798,   799,   800,   801,
-     802,   806,   807,   811,   815,   819,   823,   824,   825,   826,
-     830,   831,   832,   833,   837,   842,   843,   847,   851,   855,
-     867,   868,   878,   879,   883,   884,   893,   894,   899,   910,
-     919,   920,   925,   926,   930,   931,   939,   947,   957,   976,
-     977,   978,   979,   980,   981,   982,   983,   988,   997,   998,
-    1003,  1004
+       0,   293,   293,   319,   320,   324,   328,   332,   339,   340,
+     341,   342,   343,   344,   345,   346,   347,   356,   357,   362,
+     363,   367,   371,   383,   390,   393,   397,   409,   418,   422,
+     432,   435,   449,   456,   463,   474,   475,   479,   480,   484,
+     491,   492,   493,   494,   504,   510,   516,   524,   525,   534,
+     543,   557,   570,   581,   582,   588,   592,   593,   597,   606,
+     607,   611,   612,   613,   614,   615,   625,   634,   635,   639,
+     651,   652,   653,   661,   662,   666,   667,   671,   681,   691,
+     695,   704,   708,   715,   716,   717,   721,   722,   726,   738,
+     739,   743,   747,   752,   753,   757,   762,   766,   767,   770,
+     771,   775,   776,   780,   784,   785,   786,   792,   793,   797,
+     798,   799,   806,   807,   811,   812,   816,   823,   824,   825,
+     826,   827,   831,   832,   833,   834,   835,   836,   837,   838,
+     839,   843,   844,   848,   849,   850,   851,   852,   856,   857,
+     858,   859,   860,   861,   862,   863,   864,   865,   866,   870,
+     871,   875,   876,   877,   878,   884,   885,   890,   892,   896,
+     897,   901,   902,   903,   904,   905,   906,   910,   911,   915,
+     919,   923,   927,   928,   929,   930,   934,   935,   936,   937,
+     941,   946,   947,   951,   955,   959,   968,   989,   990,  1000,
+    1001,  1005,  1006,  1015,  1016,  1021,  1032,  1041,  1042,  1047,
+    1048,  1052,  1053,  1061,  1069,  1079,  1102,  1103,  1104,  1105,
+    1106,  1107,  1108,  1109,  1114,  1123,  1124,  1129,  1130
 };
 #endif
 
-#if HSQL_DEBUG || YYERROR_VERBOSE || 1
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "IDENTIFIER", "STRING", "FLOATVAL",
-  "INTVAL", "DEALLOCATE", "PARAMETERS", "INTERSECT", "TEMPORARY",
-  "TIMESTAMP", "DISTINCT", "NVARCHAR", "RESTRICT", "TRUNCATE", "ANALYZE",
-  "BETWEEN", "CASCADE", "COLUMNS", "CONTROL", "DEFAULT", "EXECUTE",
-  "EXPLAIN", "HISTORY", "INTEGER", "NATURAL", "PREPARE", "PRIMARY",
-  "SCHEMAS", "SPATIAL", "VIRTUAL", "BEFORE", "COLUMN", "CREATE", "DELETE",
-  "DIRECT", "DOUBLE", "ESCAPE", "EXCEPT", "EXISTS", "GLOBAL", "HAVING",
-  "IMPORT", "INSERT", "ISNULL", "OFFSET", "RENAME", "SCHEMA", "SELECT",
-  "SORTED", "TABLES", "UNIQUE", "UNLOAD", "UPDATE", "VALUES", "AFTER",
-  "ALTER", "CROSS", "DELTA", "GROUP", "INDEX", "INNER", "LIMIT", "LOCAL",
-  "MERGE", "MINUS", "ORDER", "OUTER", "RIGHT", "TABLE", "UNION", "USING",
-  "WHERE", "CALL", "CASE", "DATE", "DESC", "DROP", "ELSE", "FILE", "FROM",
-  "FULL", "HASH", "HINT", "INTO", "JOIN", "LEFT", "LIKE", "LOAD", "NULL",
-  "PART", "PLAN", "SHOW", "TEXT", "THEN", "TIME", "VIEW", "WHEN", "WITH",
-  "ADD", "ALL", "AND", "ASC", "CSV", "END", "FOR", "INT", "KEY", "NOT",
-  "OFF", "SET", "TBL", "TOP", "AS", "BY", "IF", "IN", "IS", "OF", "ON",
-  "OR", "TO", "ARRAY", "CONCAT", "ILIKE", "'='", "EQUALS", "NOTEQUALS",
-  "'<'", "'>'", "LESS", "GREATER", "LESSEQ", "GREATEREQ", "NOTNULL", "'+'",
-  "'-'", "'*'", "'/'", "'%'", "'^'", "UMINUS", "'['", "']'", "'('", "')'",
-  "'.'", "';'", "','", "'?'", "$accept", "input", "statement_list",
-  "statement", "preparable_statement", "opt_hints", "hint_list", "hint",
-  "prepare_statement", "prepare_target_query", "execute_statement",
-  "import_statement", "import_file_type", "file_path", "show_statement",
-  "create_statement", "opt_not_exists", "column_def_commalist",
-  "column_def", "column_type", "drop_statement", "opt_exists",
-  "delete_statement", "truncate_statement", "insert_statement",
-  "opt_column_list", "update_statement", "update_clause_commalist",
-  "update_clause", "select_statement", "select_with_paren",
-  "select_paren_or_clause", "select_no_paren", "set_operator", "set_type",
-  "opt_all", "select_clause", "opt_distinct", "select_list", "from_clause",
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER", "STRING",
+  "FLOATVAL", "INTVAL", "DEALLOCATE", "PARAMETERS", "INTERSECT",
+  "TEMPORARY", "TIMESTAMP", "DISTINCT", "NVARCHAR", "RESTRICT", "TRUNCATE",
+  "ANALYZE", "BETWEEN", "CASCADE", "COLUMNS", "CONTROL", "DEFAULT",
+  "EXECUTE", "EXPLAIN", "HISTORY", "INTEGER", "NATURAL", "PREPARE",
+  "PRIMARY", "SCHEMAS", "SPATIAL", "VIRTUAL", "BEFORE", "COLUMN", "CREATE",
+  "DELETE", "DIRECT", "DOUBLE", "ESCAPE", "EXCEPT", "EXISTS", "GLOBAL",
+  "HAVING", "IMPORT", "INSERT", "ISNULL", "OFFSET", "RENAME", "SCHEMA",
+  "SELECT", "SORTED", "TABLES", "UNIQUE", "UNLOAD", "UPDATE", "VALUES",
+  "AFTER", "ALTER", "CROSS", "DELTA", "GROUP", "INDEX", "INNER", "LIMIT",
+  "LOCAL", "MERGE", "MINUS", "ORDER", "OUTER", "RIGHT", "TABLE", "UNION",
+  "USING", "WHERE", "CALL", "CASE", "DATE", "DESC", "DROP", "ELSE", "FILE",
+  "FROM", "FULL", "HASH", "HINT", "INTO", "JOIN", "LEFT", "LIKE", "LOAD",
+  "NULL", "PART", "PLAN", "SHOW", "TEXT", "THEN", "TIME", "VIEW", "WHEN",
+  "WITH", "ADD", "ALL", "AND", "ASC", "CSV", "END", "FOR", "INT", "KEY",
+  "NOT", "OFF", "SET", "TBL", "TOP", "AS", "BY", "IF", "IN", "IS", "OF",
+  "ON", "OR", "TO", "ARRAY", "CONCAT", "ILIKE", "'='", "EQUALS",
+  "NOTEQUALS", "'<'", "'>'", "LESS", "GREATER", "LESSEQ", "GREATEREQ",
+  "NOTNULL", "'+'", "'-'", "'*'", "'/'", "'%'", "'^'", "UMINUS", "'['",
+  "']'", "'('", "')'", "'.'", "';'", "','", "'?'", "'$'", "$accept",
+  "input", "statement_list", "statement", "preparable_statement",
+  "opt_hints", "hint_list", "hint", "prepare_statement",
+  "prepare_target_query", "execute_statement", "import_statement",
+  "import_file_type", "file_path", "show_statement", "create_statement",
+  "opt_not_exists", "column_def_commalist", "column_def", "column_type",
+  "drop_statement", "opt_exists", "delete_statement", "truncate_statement",
+  "insert_statement", "opt_column_list", "values_start", "values_rows",
+  "values_row", "row_values", "row_value", "update_statement",
+  "update_clause_commalist", "update_clause", "select_statement",
+  "select_with_paren", "select_paren_or_clause", "select_no_paren",
+  "set_operation", "paren_set_operation", "set_type", "opt_all",
+  "select_clause", "opt_distinct", "select_list", "from_clause",
   "opt_where", "opt_group", "opt_having", "opt_order", "order_list",
   "order_desc", "opt_order_type", "opt_top", "opt_limit", "expr_list",
   "literal_list", "expr_alias", "expr", "operand", "scalar_expr",
-  "unary_expr", "binary_expr", "logic_expr", "in_expr", "case_expr",
-  "exists_expr", "comp_expr", "function_expr", "array_expr", "array_index",
-  "between_expr", "column_name", "literal", "string_literal",
-  "num_literal", "int_literal", "null_literal", "param_expr", "table_ref",
-  "table_ref_atomic", "nonjoin_table_ref_atomic", "table_ref_commalist",
-  "table_ref_name", "table_ref_name_no_alias", "table_name", "alias",
-  "opt_alias", "join_clause", "opt_join_type", "join_condition",
-  "opt_semicolon", "ident_commalist", YY_NULLPTR
+  "unary_expr", "binary_expr", "logic_expr", "in_expr", "in_list",
+  "case_expr", "exists_expr", "comp_expr", "function_expr", "array_expr",
+  "array_index", "between_expr", "column_name", "literal",
+  "string_literal", "num_literal", "int_literal", "null_literal",
+  "param_expr", "table_ref", "table_ref_atomic",
+  "nonjoin_table_ref_atomic", "table_ref_commalist", "table_ref_name",
+  "table_ref_name_no_alias", "table_name", "alias", "opt_alias",
+  "join_clause", "opt_join_type", "join_condition", "opt_semicolon",
+  "ident_commalist", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,    61,   381,   382,    60,
-      62,   383,   384,   385,   386,   387,    43,    45,    42,    47,
-      37,    94,   388,    91,    93,    40,    41,    46,    59,    44,
-      63
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -232
+#define YYPACT_NINF (-253)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-232)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -197
+#define YYTABLE_NINF (-214)
 
-#define yytable_value_is_error(Yytable_value) \
-  (!!((Yytable_value) == (-197)))
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     268,    42,    35,    73,   110,   -43,   -30,    39,    41,    32,
-      35,    30,    11,   -39,   147,     3,  -232,    82,    82,  -232,
-    -232,  -232,  -232,  -232,  -232,  -232,  -232,  -232,  -232,    28,
-    -232,    27,   169,    49,  -232,    56,   126,   100,   100,    35,
-     117,    35,   226,   205,   123,  -232,   128,   128,    35,  -232,
-     101,   103,  -232,   268,  -232,   170,  -232,  -232,  -232,  -232,
-    -232,   -39,   152,   144,   -39,   194,  -232,   258,    14,   261,
-     159,    35,    35,   196,  -232,   190,   127,  -232,  -232,  -232,
-     151,   270,   231,    35,    35,  -232,  -232,  -232,  -232,   131,
-    -232,   212,  -232,  -232,  -232,   151,   212,   226,  -232,  -232,
-    -232,  -232,  -232,  -232,   -44,  -232,  -232,  -232,  -232,  -232,
-    -232,  -232,  -232,   241,   -56,   127,   151,  -232,   280,   279,
-     -16,   -84,   140,   188,   155,   161,    75,  -232,   113,   213,
-     157,  -232,    65,   211,  -232,  -232,  -232,  -232,  -232,  -232,
-    -232,  -232,  -232,  -232,  -232,  -232,  -232,  -232,   181,   -61,
-    -232,  -232,  -232,  -232,   306,   194,   164,  -232,   -46,   194,
-     264,  -232,    14,  -232,   202,   315,   207,   -78,   234,  -232,
-    -232,   -37,   179,  -232,     2,     5,   276,   151,   185,    75,
-     381,   151,    99,   180,   -86,     4,   196,   151,  -232,   151,
-     324,   151,  -232,  -232,    75,  -232,    75,   -47,   186,   -62,
-      75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
-      75,    75,    75,    75,   226,   151,   270,  -232,   187,    34,
-    -232,  -232,   151,  -232,  -232,  -232,  -232,   226,  -232,   253,
-       7,    48,  -232,   -39,    35,  -232,   331,    14,  -232,   151,
-    -232,  -232,   192,   -50,   276,   254,    26,  -232,  -232,   -39,
-    -232,    24,  -232,  -232,    10,  -232,   283,  -232,  -232,  -232,
-     256,   322,   409,    75,   210,   113,  -232,   266,   217,   409,
-     409,   409,   235,   235,   235,   235,    99,    99,   -95,   -95,
-     -95,    50,   218,   -78,  -232,    14,  -232,   306,  -232,  -232,
-     280,  -232,  -232,  -232,  -232,  -232,  -232,   315,  -232,  -232,
-    -232,    53,    59,  -232,    75,   224,  -232,   233,   277,  -232,
-    -232,  -232,   309,   312,     4,   295,  -232,   267,  -232,    75,
-     409,   113,   238,    60,  -232,  -232,    69,  -232,  -232,  -232,
-    -232,  -232,   278,  -232,    10,     4,  -232,  -232,   229,   236,
-       4,   151,   381,   240,    78,  -232,  -232,  -232,    75,  -232,
-    -232,  -232,     4,   142,   -27,  -232,  -232,   348,   229,   243,
-     151,   151,  -232,  -232,     6,   -78,  -232,   -78,   242,   244,
-    -232
+     308,     4,    44,    54,    65,   -26,    12,    29,    32,    78,
+      44,   -16,    27,   -33,   197,    53,  -253,   107,   107,  -253,
+    -253,  -253,  -253,  -253,  -253,  -253,  -253,  -253,  -253,    25,
+    -253,    24,    24,    24,   208,    69,  -253,    85,   156,   127,
+     127,    44,   144,    44,   255,   250,   161,  -253,   157,   157,
+      44,  -253,   128,   129,  -253,   308,  -253,   192,  -253,  -253,
+    -253,  -253,  -253,   176,   163,   176,   217,   176,   217,   176,
+     217,  -253,   278,     7,   279,   177,    44,    44,   212,  -253,
+     207,   143,  -253,  -253,  -253,   159,   289,   249,    44,    44,
+    -253,  -253,  -253,  -253,   148,  -253,   -33,   159,   -33,   255,
+    -253,   -33,  -253,   -33,  -253,  -253,  -253,  -253,  -253,  -253,
+     288,    26,  -253,  -253,  -253,  -253,  -253,  -253,  -253,  -253,
+     261,   -63,   143,   159,  -253,   291,   299,   -19,   -22,   160,
+     210,   189,   164,   209,  -253,    81,   225,   162,  -253,    59,
+     286,  -253,  -253,  -253,  -253,  -253,  -253,  -253,  -253,  -253,
+    -253,  -253,  -253,  -253,  -253,   187,   -49,  -253,  -253,  -253,
+    -253,   311,  -253,  -253,  -253,   167,  -253,   -51,  -253,   271,
+    -253,  -253,  -253,  -253,     7,  -253,   213,   316,   206,   -46,
+     236,  -253,  -253,    33,  -253,   179,  -253,    20,    16,   273,
+     159,   188,   209,   433,   159,    84,   183,   -47,    14,   212,
+     159,  -253,   159,   333,   159,  -253,  -253,   209,  -253,   209,
+     -27,   193,    80,   209,   209,   209,   209,   209,   209,   209,
+     209,   209,   209,   209,   209,   209,   209,   255,   159,   289,
+    -253,   196,    56,  -253,   159,  -253,  -253,  -253,   255,  -253,
+     257,   102,    71,  -253,   -33,    44,  -253,   341,    17,   200,
+    -253,  -253,   159,  -253,  -253,   202,    79,   273,   262,  -104,
+    -253,  -253,   -33,  -253,   -20,  -253,  -253,     6,  -253,   285,
+    -253,  -253,  -253,   251,   363,   460,   209,   211,    81,  -253,
+     265,   215,   460,   460,   460,   486,   486,   486,   486,    84,
+      84,   -15,   -15,   -15,    45,   219,   -46,  -253,     7,  -253,
+     311,  -253,  -253,   291,  -253,  -253,  -253,  -253,  -253,  -253,
+     316,  -253,  -253,  -253,  -253,  -253,  -253,  -253,   101,  -253,
+    -253,   179,   108,  -253,   209,   218,  -253,   220,   275,  -253,
+    -253,  -253,   297,   300,    14,   281,  -253,   254,  -253,   209,
+     460,    81,   224,  -253,   109,  -253,  -253,   110,  -253,  -253,
+    -253,  -253,    17,  -253,  -253,   330,  -253,     6,    14,  -253,
+    -253,   184,   222,    14,   159,   433,   226,   114,  -253,  -253,
+     159,  -253,  -253,   209,  -253,  -253,  -253,    14,    11,   -34,
+    -253,  -253,  -253,   389,   184,   228,   159,   159,  -253,  -253,
+      22,   -46,  -253,   -46,   229,   231,  -253
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    94,
-       0,     0,     0,     0,     0,   199,     3,    18,    18,    16,
-       9,     7,    10,    15,    12,    13,    11,    14,     8,    59,
-      60,    86,     0,   180,    50,    25,     0,    36,    36,     0,
-       0,     0,     0,    76,     0,   179,    48,    48,     0,    30,
-       0,     0,     1,   198,     2,     0,     6,     5,    70,    71,
-      69,     0,    73,     0,     0,    97,    46,     0,     0,     0,
-       0,     0,     0,    80,    28,     0,    54,   167,    93,    75,
-       0,     0,     0,     0,     0,    31,    63,    62,     4,     0,
-      64,    86,    65,    72,    68,     0,    86,     0,    66,   181,
-     164,   165,   168,   169,     0,   100,   160,   161,   166,   162,
-     163,    24,    23,     0,     0,    54,     0,    49,     0,     0,
-       0,   156,     0,     0,     0,     0,     0,   158,     0,     0,
-      77,    98,   185,   103,   110,   111,   112,   105,   107,   113,
-     106,   124,   114,   115,   109,   104,   117,   118,     0,    80,
-      56,    47,    44,    45,     0,    97,    85,    87,    92,    97,
-      95,    26,     0,    35,     0,     0,     0,    79,     0,    29,
-     200,     0,     0,    52,    76,     0,     0,     0,     0,     0,
-     120,     0,   119,     0,     0,     0,    80,     0,   183,     0,
-       0,     0,   184,   102,     0,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   108,
+       0,     0,     0,     0,     0,   216,     3,    18,    18,    16,
+       9,     7,    10,    15,    12,    13,    11,    14,     8,    70,
+      71,   100,   100,   100,     0,   197,    50,    25,     0,    36,
+      36,     0,     0,     0,     0,    90,     0,   196,    48,    48,
+       0,    30,     0,     0,     1,   215,     2,     0,     6,     5,
+      84,    85,    83,    87,     0,    87,   111,    87,   111,    87,
+     111,    46,     0,     0,     0,     0,     0,     0,    94,    28,
+       0,    54,   183,   107,    89,     0,     0,     0,     0,     0,
+      31,    74,    73,     4,     0,    86,     0,     0,     0,     0,
+      78,     0,    72,     0,    77,   198,   180,   181,   184,   185,
+       0,     0,   114,   176,   177,   182,   178,   179,    24,    23,
+       0,     0,    54,     0,    49,     0,     0,     0,   172,     0,
+       0,     0,     0,     0,   174,     0,     0,    91,   112,   202,
+     117,   124,   125,   126,   119,   121,   127,   120,   138,   128,
+     129,   123,   118,   131,   132,     0,    94,    67,    47,    44,
+      45,     0,    75,    81,    76,    99,   101,   106,    80,   109,
+      82,    79,   186,    26,     0,    35,     0,     0,     0,    93,
+       0,    29,   217,     0,    55,     0,    52,    90,     0,     0,
+       0,     0,     0,   134,     0,   133,     0,     0,     0,    94,
+       0,   200,     0,     0,     0,   201,   116,     0,   135,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    55,    21,     0,
-      19,    61,     0,    91,    90,    89,    67,     0,   101,     0,
-       0,     0,    37,     0,     0,    53,     0,     0,   151,     0,
-     157,   159,     0,     0,     0,     0,     0,   116,   108,     0,
-      78,   170,   172,   174,   185,   173,    82,    99,   135,   182,
-     136,     0,   131,     0,     0,     0,   122,     0,   134,   133,
-     145,   146,   147,   148,   149,   150,   126,   125,   128,   127,
-     129,   130,     0,    58,    57,     0,    17,     0,    88,    96,
-       0,    41,    42,    43,    40,    39,    33,     0,    34,    27,
-     201,     0,     0,   143,     0,     0,   153,     0,     0,   195,
-     189,   190,   194,   193,     0,     0,   178,     0,    74,     0,
-     132,     0,     0,     0,   123,   154,     0,    20,    32,    38,
-      51,   152,     0,   144,   185,     0,   192,   191,   176,   171,
-       0,     0,   155,     0,     0,   139,   137,    22,     0,   141,
-     175,   186,     0,   196,    84,   140,   138,     0,   177,     0,
-       0,     0,    81,   142,     0,   197,   187,    83,   156,     0,
-     188
+      66,    21,     0,    19,     0,   105,   104,   103,     0,   115,
+       0,     0,     0,    37,     0,     0,    53,     0,     0,    51,
+      56,   167,     0,   173,   175,     0,     0,     0,     0,     0,
+     130,   122,     0,    92,   187,   189,   191,   202,   190,    96,
+     113,   149,   199,   150,     0,   145,     0,     0,     0,   136,
+       0,   148,   147,   161,   162,   163,   164,   165,   166,   140,
+     139,   142,   141,   143,   144,     0,    69,    68,     0,    17,
+       0,   102,   110,     0,    41,    42,    43,    40,    39,    33,
+       0,    34,    27,   218,    61,    62,    63,    64,     0,    59,
+      65,     0,     0,   159,     0,     0,   169,     0,     0,   212,
+     206,   207,   211,   210,     0,     0,   195,     0,    88,     0,
+     146,     0,     0,   155,     0,   137,   170,     0,    20,    32,
+      38,    58,     0,    57,   168,     0,   160,   202,     0,   209,
+     208,   193,   188,     0,     0,   171,     0,     0,   153,   151,
+       0,    22,    60,     0,   157,   192,   203,     0,   213,    98,
+     154,   152,   156,     0,   194,     0,     0,     0,    95,   158,
+       0,   214,   204,    97,   172,     0,   205
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -232,  -232,  -232,   338,  -232,   374,  -232,   107,  -232,  -232,
-    -232,  -232,  -232,   105,  -232,  -232,   359,  -232,   102,  -232,
-    -232,   351,  -232,  -232,  -232,   285,  -232,  -232,   189,   -64,
-      13,   337,   -13,   378,  -232,  -232,   182,   246,  -232,  -232,
-    -128,  -232,  -232,    91,  -232,   200,  -232,  -232,   -68,  -175,
-    -220,   245,   -94,   -71,  -232,  -232,  -232,  -232,  -232,  -232,
-    -232,  -232,  -232,  -232,  -232,  -232,    61,   -66,  -113,  -232,
-     -38,  -232,  -232,  -232,  -162,    88,  -232,  -232,  -232,     1,
-    -232,  -231,  -232,  -232,  -232,  -232,  -232
+    -253,  -253,  -253,   323,  -253,   361,  -253,    82,  -253,  -253,
+    -253,  -253,  -253,    77,  -253,  -253,   343,  -253,    74,  -253,
+    -253,   332,  -253,  -253,  -253,   263,  -253,  -253,    66,  -253,
+      36,  -253,  -253,   165,  -209,    15,   138,   -13,  -253,  -253,
+      70,    68,   137,   203,  -253,  -253,  -127,  -253,  -253,   153,
+    -253,   155,  -253,  -253,   199,  -187,    93,  -186,   -96,   -73,
+    -253,  -253,  -253,  -253,  -253,    51,  -253,  -253,  -253,  -253,
+    -253,  -253,  -253,     3,   -70,  -120,  -253,   -40,  -253,  -228,
+    -253,  -156,    38,  -253,  -253,  -253,     0,  -253,  -252,  -253,
+    -253,  -253,  -253,  -253
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    14,    15,    16,    17,    56,   219,   220,    18,   112,
-      19,    20,    75,   168,    21,    22,    71,   231,   232,   295,
-      23,    83,    24,    25,    26,   120,    27,   149,   150,    28,
-      29,    91,    30,    61,    62,    94,    31,    80,   129,   186,
-     117,   318,   362,    65,   156,   157,   225,    43,    98,   130,
-     104,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   106,   107,
-     108,   109,   110,   250,   251,   252,   339,   253,    44,   254,
-     192,   193,   255,   315,   366,    54,   171
+       0,    14,    15,    16,    17,    58,   232,   233,    18,   119,
+      19,    20,    80,   180,    21,    22,    76,   242,   243,   308,
+      23,    88,    24,    25,    26,   127,   185,   249,   250,   318,
+     319,    27,   156,   157,    28,    29,   163,    30,    31,    32,
+      63,    96,    33,    85,   136,   199,   124,   338,   388,    66,
+     165,   166,   237,    45,   100,   137,   111,   138,   139,   140,
+     141,   142,   143,   144,   145,   344,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   113,   114,   115,   116,   117,
+     263,   264,   265,   362,   266,    46,   267,   205,   206,   268,
+     335,   392,    56,   183
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      51,   158,   105,    34,    78,   169,   246,    33,   240,   368,
-       9,    45,   116,   188,    79,   361,   189,   301,   100,   101,
-      77,   217,   167,   316,   189,   164,    50,    37,   266,   200,
-      48,   223,   291,     9,   184,   191,    58,    58,    33,   172,
-      73,   263,    76,   191,   292,   304,   213,   267,   214,    85,
-     308,    39,   189,   180,    38,   182,   189,   224,   256,   160,
-     248,   174,    49,   175,   302,   326,    59,    59,   188,    32,
-     264,   191,   114,   115,    90,   191,    35,    90,   121,   100,
-     101,    77,   309,   243,   152,   153,   310,   221,   216,   165,
-     323,   226,   311,   312,    63,   258,   228,   260,    60,    60,
-      46,   293,   161,   350,   102,   162,    13,   173,   180,   235,
-    -196,   313,   236,    36,   294,   183,   121,   100,   101,    77,
-      40,   283,   187,   261,   190,   262,    41,    47,   158,   268,
-     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
-     279,   280,   281,   241,   127,    42,   344,    52,   238,   249,
-     123,    53,   338,   122,   121,   100,   101,    77,   121,   100,
-     101,    77,     9,   242,   103,   102,   354,   189,   308,   298,
-     306,   105,    66,   314,   200,   187,   282,   169,   353,   190,
-     286,    55,   155,   287,   179,   307,   191,   159,   123,   289,
-     358,   122,   320,   214,   296,   178,    67,   297,   125,   330,
-     309,    68,   162,   102,   310,   331,   346,    69,   187,   187,
-     311,   312,   126,   127,   359,   347,    70,    79,   162,   105,
-     128,    74,   124,   200,   356,   103,   123,   187,   194,   313,
-     123,   305,    77,   332,    81,   299,   125,   210,   211,   212,
-     213,   102,   214,    92,    82,   102,    92,    86,   342,    87,
-     126,   127,   322,    93,    89,   308,   195,    97,   128,    95,
-     124,    99,   360,   103,   179,   111,   365,   367,   113,   116,
-     118,   151,   119,   148,   125,     1,   154,   357,   125,    63,
-     195,   163,   170,     2,   100,   176,   177,   309,   126,   127,
-       3,   310,   126,   127,   185,     4,   128,   311,   312,   196,
-     128,   103,     5,     6,   181,   103,   187,   215,   343,   218,
-     227,     7,     8,   222,   229,  -196,   313,     9,   230,   234,
-     197,   233,    10,   195,   237,     9,   247,   259,   198,   199,
-     244,   265,   285,   290,   300,   200,   201,   202,   303,   203,
-     204,   205,   263,   317,   206,   207,    11,   208,   209,   210,
-     211,   212,   213,   199,   214,   321,   324,   348,   189,   200,
-     214,    12,   325,   335,  -197,  -197,   196,   195,  -197,  -197,
-     333,   208,   209,   210,   211,   212,   213,   336,   214,   334,
-     337,   340,   341,   349,   345,   352,   355,   245,   364,   175,
-     370,    88,    57,   195,   327,   328,   199,    72,    84,   329,
-     166,    96,   200,   201,   202,   284,   203,   204,   205,    64,
-     196,   206,   207,    13,   208,   209,   210,   211,   212,   213,
-     239,   214,   288,   351,   319,   369,   195,     0,     0,     0,
-       0,   245,   257,     0,     0,     0,   196,     0,     0,     0,
-     199,     0,     0,     0,     0,     0,   200,   201,   202,     0,
-     203,   204,   205,   363,   195,   206,   207,   245,   208,   209,
-     210,   211,   212,   213,     0,   214,   199,     0,     0,   196,
-       0,     0,   200,   201,   202,     0,   203,   204,   205,     0,
-       0,   206,   207,     0,   208,   209,   210,   211,   212,   213,
-     245,   214,     0,     0,     0,     0,     0,  -197,     0,   199,
-       0,     0,     0,     0,     0,   200,   201,   202,     0,   203,
-     204,   205,     0,     0,   206,   207,     0,   208,   209,   210,
-     211,   212,   213,     0,   214,     0,     0,   199,     0,     0,
-       0,     0,     0,   200,  -197,  -197,     0,  -197,   204,   205,
-       0,     0,   206,   207,     0,   208,   209,   210,   211,   212,
-     213,     0,   214
+      53,   167,    36,   112,    83,   181,   328,   259,   387,   201,
+      47,   106,   107,    82,   270,   336,     9,    35,   176,   253,
+     320,   314,   315,   316,   123,   394,   235,   179,    52,   230,
+       9,    34,    84,    60,    60,   311,   184,   328,   329,   197,
+     326,    78,   330,    81,    39,   200,    50,    35,   331,   332,
+      90,   202,   236,   327,    48,   202,   202,    37,   193,   169,
+     195,   276,   201,    61,    61,   322,  -213,   333,    38,   329,
+     204,    40,   269,   330,   204,   204,   121,   122,    51,   331,
+     332,    49,   177,   385,   128,   106,   107,    82,   159,   160,
+     277,    64,   343,    41,   256,    62,    62,   108,   333,   261,
+     229,    65,    67,    69,   239,   375,   271,   317,   273,   213,
+      42,   162,    13,   162,   186,   200,   162,    43,   162,   193,
+     203,   129,   196,   187,   320,   188,   226,   304,   227,   334,
+       9,   386,   296,    98,   274,   101,   275,   103,   167,   305,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
+     291,   292,   293,   294,   254,   343,   130,   109,   110,   262,
+     134,   202,   128,   106,   107,    82,   251,   109,   110,   213,
+     279,   108,   173,   203,   324,   174,   255,   379,   361,   246,
+     204,   202,   247,   181,   382,    68,    70,   295,   227,   280,
+     131,    44,   128,   106,   107,    82,   306,    54,   302,   129,
+     204,    55,   299,   340,   132,   300,    57,   378,   213,   307,
+     328,    71,   128,   106,   107,    82,    72,   309,   133,   134,
+     310,   384,   223,   224,   225,   226,   135,   227,   112,   191,
+      73,   109,   110,   164,   130,   164,   168,    74,   164,   170,
+     164,   171,   329,    75,   325,   312,   330,   351,    79,   108,
+     352,   355,   331,   332,   354,   369,   371,   200,   370,   174,
+     381,    82,    84,   370,   130,   342,   365,   102,   131,   104,
+    -213,   333,    86,    87,    91,    92,    94,    95,    97,   108,
+      99,   105,   132,   118,   130,   123,   120,   125,   126,   158,
+     391,   393,   155,   161,   172,   106,   133,   134,   192,   108,
+     383,   175,   182,   207,   135,   189,   198,   194,   190,   109,
+     110,   200,   132,   228,   231,     1,   234,   238,   192,   241,
+     244,   245,     9,     2,   248,   240,   133,   134,   366,   260,
+       3,   208,   132,   257,   135,     4,   272,   303,   278,   109,
+     110,   298,     5,     6,   313,   337,   133,   134,   323,   321,
+     276,     7,     8,   202,   135,   345,   341,     9,   227,   109,
+     110,   358,    10,   346,   356,   359,   357,   363,   360,   364,
+     368,   377,   380,   390,   209,   208,   188,   396,    93,    59,
+     349,    89,   348,    77,   350,   178,    11,   353,   372,   301,
+     252,   347,   367,   395,   297,   210,   376,     0,     0,     0,
+       0,    12,     0,   211,   212,     0,     0,     0,   208,   373,
+     213,   214,   215,     0,   216,   217,   218,     0,   209,   219,
+     220,     0,   221,   222,   223,   224,   225,   226,     0,   227,
+       0,     0,     0,     0,   208,   374,     0,     0,     0,   258,
+       0,     0,     0,     0,     0,     0,     0,     0,   212,     0,
+       0,   209,     0,    13,   213,   214,   215,     0,   216,   217,
+     218,     0,     0,   219,   220,   339,   221,   222,   223,   224,
+     225,   226,   258,   227,     0,     0,     0,   209,   208,     0,
+       0,   212,     0,     0,     0,     0,     0,   213,   214,   215,
+       0,   216,   217,   218,   389,     0,   219,   220,   258,   221,
+     222,   223,   224,   225,   226,   208,   227,   212,     0,     0,
+       0,     0,     0,   213,   214,   215,     0,   216,   217,   218,
+       0,   209,   219,   220,     0,   221,   222,   223,   224,   225,
+     226,   208,   227,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   258,     0,     0,     0,     0,     0,  -214,     0,
+       0,   212,     0,     0,     0,     0,     0,   213,   214,   215,
+       0,   216,   217,   218,     0,     0,   219,   220,     0,   221,
+     222,   223,   224,   225,   226,     0,   227,     0,   212,     0,
+       0,     0,     0,     0,   213,  -214,  -214,     0,  -214,   217,
+     218,     0,     0,   219,   220,     0,   221,   222,   223,   224,
+     225,   226,     0,   227,   212,     0,     0,     0,     0,     0,
+     213,     0,     0,     0,     0,  -214,  -214,     0,     0,  -214,
+    -214,     0,   221,   222,   223,   224,   225,   226,     0,   227
 };
 
 static const yytype_int16 yycheck[] =
 {
-      13,    95,    68,     2,    42,   118,   181,     3,     3,     3,
-      49,    10,    73,     3,    12,    42,   102,   237,     4,     5,
-       6,   149,   116,   254,   102,    81,    13,    70,    90,   124,
-      19,    77,    25,    49,   128,   121,     9,     9,     3,    55,
-      39,    88,    41,   121,    37,    95,   141,   109,   143,    48,
-      26,    81,   102,   124,    97,   126,   102,   103,   186,    97,
-     146,   145,    51,   147,   239,   285,    39,    39,     3,    27,
-     117,   121,    71,    72,    61,   121,     3,    64,     3,     4,
-       5,     6,    58,   177,    83,    84,    62,   155,   149,   145,
-     265,   159,    68,    69,    67,   189,   162,   191,    71,    71,
-      70,    94,   146,   334,    90,   149,   145,   120,   179,   146,
-      86,    87,   149,     3,   107,   128,     3,     4,     5,     6,
-      81,   215,   149,   194,   114,   196,    85,    97,   222,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   138,   138,   113,   321,     0,   146,   145,
-      75,   148,   314,    40,     3,     4,     5,     6,     3,     4,
-       5,     6,    49,   176,   150,    90,   341,   102,    26,   233,
-     144,   237,     3,   149,   124,   149,   214,   290,   340,   114,
-     146,    99,    91,   149,   109,   249,   121,    96,    75,   227,
-     352,    40,   263,   143,   146,    40,   147,   149,   123,   146,
-      58,   145,   149,    90,    62,   146,   146,    81,   149,   149,
-      68,    69,   137,   138,    72,   146,   116,    12,   149,   285,
-     145,   104,   109,   124,   146,   150,    75,   149,    17,    87,
-      75,   244,     6,   304,   111,   234,   123,   138,   139,   140,
-     141,    90,   143,    61,   116,    90,    64,   146,   319,   146,
-     137,   138,   265,   101,    84,    26,    45,    63,   145,   115,
-     109,     3,   120,   150,   109,     4,   360,   361,   109,    73,
-      80,    40,   145,     3,   123,     7,   145,   348,   123,    67,
-      45,    40,     3,    15,     4,   145,    98,    58,   137,   138,
-      22,    62,   137,   138,    81,    27,   145,    68,    69,    88,
-     145,   150,    34,    35,   143,   150,   149,   126,   321,     3,
-      46,    43,    44,   149,   112,    86,    87,    49,     3,    85,
-     109,   114,    54,    45,   145,    49,   146,     3,   117,   118,
-     145,   145,   145,    80,     3,   124,   125,   126,   146,   128,
-     129,   130,    88,    60,   133,   134,    78,   136,   137,   138,
-     139,   140,   141,   118,   143,   145,    90,    79,   102,   124,
-     143,    93,   144,    86,   129,   130,    88,    45,   133,   134,
-     146,   136,   137,   138,   139,   140,   141,    68,   143,   146,
-      68,    86,   115,   105,   146,   149,   146,   109,   145,   147,
-     146,    53,    18,    45,   287,   290,   118,    38,    47,   297,
-     115,    64,   124,   125,   126,   216,   128,   129,   130,    31,
-      88,   133,   134,   145,   136,   137,   138,   139,   140,   141,
-     174,   143,   222,   335,   102,   364,    45,    -1,    -1,    -1,
-      -1,   109,   187,    -1,    -1,    -1,    88,    -1,    -1,    -1,
-     118,    -1,    -1,    -1,    -1,    -1,   124,   125,   126,    -1,
-     128,   129,   130,   105,    45,   133,   134,   109,   136,   137,
-     138,   139,   140,   141,    -1,   143,   118,    -1,    -1,    88,
-      -1,    -1,   124,   125,   126,    -1,   128,   129,   130,    -1,
-      -1,   133,   134,    -1,   136,   137,   138,   139,   140,   141,
-     109,   143,    -1,    -1,    -1,    -1,    -1,    88,    -1,   118,
-      -1,    -1,    -1,    -1,    -1,   124,   125,   126,    -1,   128,
-     129,   130,    -1,    -1,   133,   134,    -1,   136,   137,   138,
-     139,   140,   141,    -1,   143,    -1,    -1,   118,    -1,    -1,
+      13,    97,     2,    73,    44,   125,    26,   194,    42,     3,
+      10,     4,     5,     6,   200,   267,    49,     3,    81,     3,
+     248,     4,     5,     6,    73,     3,    77,   123,    13,   156,
+      49,    27,    12,     9,     9,   244,    55,    26,    58,   135,
+     144,    41,    62,    43,    70,   149,    19,     3,    68,    69,
+      50,   102,   103,   262,    70,   102,   102,     3,   131,    99,
+     133,    88,     3,    39,    39,   252,    86,    87,     3,    58,
+     121,    97,   199,    62,   121,   121,    76,    77,    51,    68,
+      69,    97,   145,    72,     3,     4,     5,     6,    88,    89,
+     117,    67,   278,    81,   190,    71,    71,    90,    87,   146,
+     149,    31,    32,    33,   174,   357,   202,    90,   204,   124,
+      81,    96,   145,    98,   127,   149,   101,    85,   103,   192,
+     114,    40,   135,   145,   352,   147,   141,    25,   143,   149,
+      49,   120,   228,    65,   207,    67,   209,    69,   234,    37,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   138,   341,    75,   150,   151,   145,
+     138,   102,     3,     4,     5,     6,   146,   150,   151,   124,
+      90,    90,   146,   114,    95,   149,   189,   364,   334,   146,
+     121,   102,   149,   303,   370,    32,    33,   227,   143,   109,
+     109,   113,     3,     4,     5,     6,    94,     0,   238,    40,
+     121,   148,   146,   276,   123,   149,    99,   363,   124,   107,
+      26,     3,     3,     4,     5,     6,   147,   146,   137,   138,
+     149,   377,   138,   139,   140,   141,   145,   143,   298,    40,
+     145,   150,   151,    96,    75,    98,    98,    81,   101,   101,
+     103,   103,    58,   116,   257,   245,    62,   146,   104,    90,
+     149,   324,    68,    69,   146,   146,   146,   149,   149,   149,
+     146,     6,    12,   149,    75,   278,   339,    68,   109,    70,
+      86,    87,   111,   116,   146,   146,    84,   101,   115,    90,
+      63,     3,   123,     4,    75,    73,   109,    80,   145,    40,
+     386,   387,     3,   145,     6,     4,   137,   138,   109,    90,
+     373,    40,     3,    17,   145,   145,    81,   143,    98,   150,
+     151,   149,   123,   126,     3,     7,   149,    46,   109,     3,
+     114,    85,    49,    15,   145,   112,   137,   138,   341,   146,
+      22,    45,   123,   145,   145,    27,     3,    80,   145,   150,
+     151,   145,    34,    35,     3,    60,   137,   138,   146,   149,
+      88,    43,    44,   102,   145,    90,   145,    49,   143,   150,
+     151,    86,    54,   144,   146,    68,   146,    86,    68,   115,
+     146,   149,   146,   145,    88,    45,   147,   146,    55,    18,
+     303,    49,   300,    40,   310,   122,    78,   321,   352,   234,
+     187,   298,   341,   390,   229,   109,   358,    -1,    -1,    -1,
+      -1,    93,    -1,   117,   118,    -1,    -1,    -1,    45,    79,
+     124,   125,   126,    -1,   128,   129,   130,    -1,    88,   133,
+     134,    -1,   136,   137,   138,   139,   140,   141,    -1,   143,
+      -1,    -1,    -1,    -1,    45,   105,    -1,    -1,    -1,   109,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    88,    -1,   145,   124,   125,   126,    -1,   128,   129,
+     130,    -1,    -1,   133,   134,   102,   136,   137,   138,   139,
+     140,   141,   109,   143,    -1,    -1,    -1,    88,    45,    -1,
+      -1,   118,    -1,    -1,    -1,    -1,    -1,   124,   125,   126,
+      -1,   128,   129,   130,   105,    -1,   133,   134,   109,   136,
+     137,   138,   139,   140,   141,    45,   143,   118,    -1,    -1,
       -1,    -1,    -1,   124,   125,   126,    -1,   128,   129,   130,
-      -1,    -1,   133,   134,    -1,   136,   137,   138,   139,   140,
-     141,    -1,   143
+      -1,    88,   133,   134,    -1,   136,   137,   138,   139,   140,
+     141,    45,   143,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    88,    -1,
+      -1,   118,    -1,    -1,    -1,    -1,    -1,   124,   125,   126,
+      -1,   128,   129,   130,    -1,    -1,   133,   134,    -1,   136,
+     137,   138,   139,   140,   141,    -1,   143,    -1,   118,    -1,
+      -1,    -1,    -1,    -1,   124,   125,   126,    -1,   128,   129,
+     130,    -1,    -1,   133,   134,    -1,   136,   137,   138,   139,
+     140,   141,    -1,   143,   118,    -1,    -1,    -1,    -1,    -1,
+     124,    -1,    -1,    -1,    -1,   129,   130,    -1,    -1,   133,
+     134,    -1,   136,   137,   138,   139,   140,   141,    -1,   143
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,     7,    15,    22,    27,    34,    35,    43,    44,    49,
-      54,    78,    93,   145,   152,   153,   154,   155,   159,   161,
-     162,   165,   166,   171,   173,   174,   175,   177,   180,   181,
-     183,   187,    27,     3,   230,     3,     3,    70,    97,    81,
-      81,    85,   113,   198,   229,   230,    70,    97,    19,    51,
-     181,   183,     0,   148,   236,    99,   156,   156,     9,    39,
-      71,   184,   185,    67,   184,   194,     3,   147,   145,    81,
-     116,   167,   167,   230,   104,   163,   230,     6,   221,    12,
-     188,   111,   116,   172,   172,   230,   146,   146,   154,    84,
-     181,   182,   187,   101,   186,   115,   182,    63,   199,     3,
-       4,     5,    90,   150,   201,   218,   219,   220,   221,   222,
-     223,     4,   160,   109,   230,   230,    73,   191,    80,   145,
-     176,     3,    40,    75,   109,   123,   137,   138,   145,   189,
-     200,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,     3,   178,
-     179,    40,   230,   230,   145,   194,   195,   196,   203,   194,
-     221,   146,   149,    40,    81,   145,   176,   203,   164,   219,
-       3,   237,    55,   183,   145,   147,   145,    98,    40,   109,
-     204,   143,   204,   183,   203,    81,   190,   149,     3,   102,
-     114,   121,   231,   232,    17,    45,    88,   109,   117,   118,
-     124,   125,   126,   128,   129,   130,   133,   134,   136,   137,
-     138,   139,   140,   141,   143,   126,   149,   191,     3,   157,
-     158,   199,   149,    77,   103,   197,   199,    46,   218,   112,
-       3,   168,   169,   114,    85,   146,   149,   145,   146,   188,
-       3,   138,   183,   203,   145,   109,   200,   146,   146,   145,
-     224,   225,   226,   228,   230,   233,   191,   202,   203,     3,
-     203,   204,   204,    88,   117,   145,    90,   109,   204,   204,
-     204,   204,   204,   204,   204,   204,   204,   204,   204,   204,
-     204,   204,   221,   203,   179,   145,   146,   149,   196,   221,
-      80,    25,    37,    94,   107,   170,   146,   149,   180,   230,
-       3,   201,   200,   146,    95,   183,   144,   180,    26,    58,
-      62,    68,    69,    87,   149,   234,   232,    60,   192,   102,
-     204,   145,   183,   200,    90,   144,   201,   158,   164,   169,
-     146,   146,   204,   146,   146,    86,    68,    68,   225,   227,
-      86,   115,   204,   183,   200,   146,   146,   146,    79,   105,
-     232,   226,   149,   225,   200,   146,   146,   204,   225,    72,
-     120,    42,   193,   105,   145,   203,   235,   203,     3,   217,
-     146
+      54,    78,    93,   145,   153,   154,   155,   156,   160,   162,
+     163,   166,   167,   172,   174,   175,   176,   183,   186,   187,
+     189,   190,   191,   194,    27,     3,   238,     3,     3,    70,
+      97,    81,    81,    85,   113,   205,   237,   238,    70,    97,
+      19,    51,   187,   189,     0,   148,   244,    99,   157,   157,
+       9,    39,    71,   192,    67,   192,   201,   192,   201,   192,
+     201,     3,   147,   145,    81,   116,   168,   168,   238,   104,
+     164,   238,     6,   229,    12,   195,   111,   116,   173,   173,
+     238,   146,   146,   155,    84,   101,   193,   115,   193,    63,
+     206,   193,   206,   193,   206,     3,     4,     5,    90,   150,
+     151,   208,   226,   227,   228,   229,   230,   231,     4,   161,
+     109,   238,   238,    73,   198,    80,   145,   177,     3,    40,
+      75,   109,   123,   137,   138,   145,   196,   207,   209,   210,
+     211,   212,   213,   214,   215,   216,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,     3,   184,   185,    40,   238,
+     238,   145,   187,   188,   194,   202,   203,   210,   188,   229,
+     188,   188,     6,   146,   149,    40,    81,   145,   177,   210,
+     165,   227,     3,   245,    55,   178,   189,   145,   147,   145,
+      98,    40,   109,   211,   143,   211,   189,   210,    81,   197,
+     149,     3,   102,   114,   121,   239,   240,    17,    45,    88,
+     109,   117,   118,   124,   125,   126,   128,   129,   130,   133,
+     134,   136,   137,   138,   139,   140,   141,   143,   126,   149,
+     198,     3,   158,   159,   149,    77,   103,   204,    46,   226,
+     112,     3,   169,   170,   114,    85,   146,   149,   145,   179,
+     180,   146,   195,     3,   138,   189,   210,   145,   109,   207,
+     146,   146,   145,   232,   233,   234,   236,   238,   241,   198,
+     209,   210,     3,   210,   211,   211,    88,   117,   145,    90,
+     109,   211,   211,   211,   211,   211,   211,   211,   211,   211,
+     211,   211,   211,   211,   211,   229,   210,   185,   145,   146,
+     149,   203,   229,    80,    25,    37,    94,   107,   171,   146,
+     149,   186,   238,     3,     4,     5,     6,    90,   181,   182,
+     231,   149,   207,   146,    95,   189,   144,   186,    26,    58,
+      62,    68,    69,    87,   149,   242,   240,    60,   199,   102,
+     211,   145,   189,   209,   217,    90,   144,   208,   159,   165,
+     170,   146,   149,   180,   146,   211,   146,   146,    86,    68,
+      68,   233,   235,    86,   115,   211,   189,   217,   146,   146,
+     149,   146,   182,    79,   105,   240,   234,   149,   233,   207,
+     146,   146,   209,   211,   233,    72,   120,    42,   200,   105,
+     145,   210,   243,   210,     3,   225,   146
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   151,   152,   153,   153,   154,   154,   154,   155,   155,
-     155,   155,   155,   155,   155,   155,   155,   156,   156,   157,
-     157,   158,   158,   159,   160,   161,   161,   162,   163,   164,
-     165,   165,   166,   166,   166,   167,   167,   168,   168,   169,
-     170,   170,   170,   170,   171,   171,   171,   172,   172,   173,
-     174,   175,   175,   176,   176,   177,   178,   178,   179,   180,
-     180,   180,   181,   181,   182,   182,   183,   183,   184,   185,
-     185,   185,   186,   186,   187,   188,   188,   189,   190,   191,
-     191,   192,   192,   193,   193,   194,   194,   195,   195,   196,
-     197,   197,   197,   198,   198,   199,   199,   199,   200,   200,
-     201,   201,   202,   203,   203,   203,   203,   203,   204,   204,
-     204,   204,   204,   204,   204,   204,   204,   205,   205,   206,
-     206,   206,   206,   206,   207,   207,   207,   207,   207,   207,
-     207,   207,   207,   207,   207,   208,   208,   209,   209,   209,
-     209,   210,   210,   211,   211,   212,   212,   212,   212,   212,
-     212,   213,   213,   214,   215,   216,   217,   217,   217,   217,
-     218,   218,   218,   218,   219,   220,   220,   221,   222,   223,
-     224,   224,   225,   225,   226,   226,   227,   227,   228,   229,
-     230,   230,   231,   231,   232,   232,   233,   233,   233,   234,
-     234,   234,   234,   234,   234,   234,   234,   235,   236,   236,
-     237,   237
+       0,   152,   153,   154,   154,   155,   155,   155,   156,   156,
+     156,   156,   156,   156,   156,   156,   156,   157,   157,   158,
+     158,   159,   159,   160,   161,   162,   162,   163,   164,   165,
+     166,   166,   167,   167,   167,   168,   168,   169,   169,   170,
+     171,   171,   171,   171,   172,   172,   172,   173,   173,   174,
+     175,   176,   176,   177,   177,   178,   179,   179,   180,   181,
+     181,   182,   182,   182,   182,   182,   183,   184,   184,   185,
+     186,   186,   186,   187,   187,   188,   188,   189,   189,   190,
+     190,   191,   191,   192,   192,   192,   193,   193,   194,   195,
+     195,   196,   197,   198,   198,   199,   199,   200,   200,   201,
+     201,   202,   202,   203,   204,   204,   204,   205,   205,   206,
+     206,   206,   207,   207,   208,   208,   209,   210,   210,   210,
+     210,   210,   211,   211,   211,   211,   211,   211,   211,   211,
+     211,   212,   212,   213,   213,   213,   213,   213,   214,   214,
+     214,   214,   214,   214,   214,   214,   214,   214,   214,   215,
+     215,   216,   216,   216,   216,   217,   217,   218,   218,   219,
+     219,   220,   220,   220,   220,   220,   220,   221,   221,   222,
+     223,   224,   225,   225,   225,   225,   226,   226,   226,   226,
+     227,   228,   228,   229,   230,   231,   231,   232,   232,   233,
+     233,   234,   234,   235,   235,   236,   237,   238,   238,   239,
+     239,   240,   240,   241,   241,   241,   242,   242,   242,   242,
+     242,   242,   242,   242,   243,   244,   244,   245,   245
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     2,     1,     3,     2,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     5,     0,     1,
        3,     1,     4,     4,     1,     2,     5,     7,     1,     1,
        2,     3,     8,     7,     7,     3,     0,     1,     3,     2,
        1,     1,     1,     1,     4,     4,     3,     2,     0,     4,
-       2,     8,     5,     3,     0,     5,     1,     3,     3,     1,
-       1,     5,     3,     3,     1,     1,     3,     5,     2,     1,
-       1,     1,     1,     0,     7,     1,     0,     1,     2,     2,
-       0,     4,     0,     2,     0,     3,     0,     1,     3,     2,
-       1,     1,     0,     2,     0,     2,     4,     0,     1,     3,
-       1,     3,     2,     1,     1,     1,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     3,     1,     1,     2,
-       2,     2,     3,     4,     1,     3,     3,     3,     3,     3,
-       3,     3,     4,     3,     3,     3,     3,     5,     6,     5,
-       6,     6,     8,     4,     5,     3,     3,     3,     3,     3,
-       3,     3,     5,     4,     4,     5,     1,     3,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     1,     1,     1,     4,     1,     3,     2,     1,
-       1,     3,     2,     1,     1,     0,     4,     6,     8,     1,
-       1,     2,     2,     1,     1,     1,     0,     1,     1,     0,
-       1,     3
+       2,     6,     5,     3,     0,     1,     1,     3,     3,     1,
+       3,     1,     1,     1,     1,     1,     5,     1,     3,     3,
+       1,     1,     3,     3,     3,     1,     1,     3,     3,     4,
+       4,     4,     4,     1,     1,     1,     1,     0,     7,     1,
+       0,     1,     2,     2,     0,     4,     0,     2,     0,     3,
+       0,     1,     3,     2,     1,     1,     0,     2,     0,     2,
+       4,     0,     1,     3,     1,     3,     2,     1,     1,     1,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     1,     2,     2,     2,     3,     4,     1,     3,
+       3,     3,     3,     3,     3,     3,     4,     3,     3,     3,
+       3,     5,     6,     5,     6,     1,     3,     6,     8,     4,
+       5,     3,     3,     3,     3,     3,     3,     3,     5,     4,
+       4,     5,     1,     3,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     1,     3,     1,
+       1,     1,     4,     1,     3,     2,     1,     1,     3,     2,
+       1,     1,     0,     4,     6,     8,     1,     1,     2,     2,
+       1,     1,     1,     0,     1,     1,     0,     1,     3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
+#define yyclearin       (yychar = SQL_HSQL_EMPTY)
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (&yylloc, result, scanner, YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == SQL_HSQL_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, result, scanner, state, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use SQL_HSQL_error or SQL_HSQL_UNDEF. */
+#define YYERRCODE SQL_HSQL_UNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1207,20 +1353,27 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined HSQL_LTYPE_IS_TRIVIAL && HSQL_LTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined HSQL_LTYPE_IS_TRIVIAL && HSQL_LTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
 YY_ATTRIBUTE_UNUSED
-static unsigned
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
@@ -1240,65 +1393,74 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
 
+#  else
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, result, scanner); \
+                  Kind, Value, Location, result, scanner, state); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, hsql::SQLParserResult* result, yyscan_t scanner)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (yylocationp);
-  YYUSE (result);
-  YYUSE (scanner);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (result);
+  YY_USE (scanner);
+  YY_USE (state);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, hsql::SQLParserResult* result, yyscan_t scanner)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, result, scanner);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, result, scanner, state);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1307,7 +1469,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYL
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1330,21 +1492,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, hsql::SQLParserResult* result, yyscan_t scanner)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , result, scanner);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), result, scanner, state);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1352,15 +1515,15 @@ yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, result, scanner); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, result, scanner, state); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !HSQL_DEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !HSQL_DEBUG */
@@ -1383,28 +1546,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+  YYLTYPE *yylloc;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1418,10 +1630,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1429,14 +1641,13 @@ yystpcpy (char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1447,7 +1658,10 @@ yytnamerr (char *yyres, const char *yystr)
           case '\\':
             if (*++yyp != '\\')
               goto do_not_strip_quotes;
-            /* Fall through.  */
+            else
+              goto append;
+
+          append:
           default:
             if (yyres)
               yyres[yyn] = *yyp;
@@ -1462,36 +1676,20 @@ yytnamerr (char *yyres, const char *yystr)
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1515,63 +1713,78 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1580,7 +1793,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1592,639 +1805,663 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, hsql::SQLParserResult* result, yyscan_t scanner)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-  YYUSE (result);
-  YYUSE (scanner);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (result);
+  YY_USE (scanner);
+  YY_USE (state);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  switch (yytype)
+  switch (yykind)
     {
-          case 3: /* IDENTIFIER  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 1630 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_IDENTIFIER: /* IDENTIFIER  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 1845 "bison_parser.cpp"
         break;
 
-    case 4: /* STRING  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 1636 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_STRING: /* STRING  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 1851 "bison_parser.cpp"
         break;
 
-    case 5: /* FLOATVAL  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1642 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_FLOATVAL: /* FLOATVAL  */
+#line 174 "bison_parser.y"
+            { }
+#line 1857 "bison_parser.cpp"
         break;
 
-    case 6: /* INTVAL  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1648 "bison_parser.cpp" /* yacc.c:1257  */
-        break;
-
-    case 153: /* statement_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
-	if ((((*yyvaluep).stmt_vec)) != nullptr) {
-		for (auto ptr : *(((*yyvaluep).stmt_vec))) {
-			delete ptr;
-		}
-	}
-	delete (((*yyvaluep).stmt_vec));
-}
-#line 1661 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_INTVAL: /* INTVAL  */
+#line 174 "bison_parser.y"
+            { }
+#line 1863 "bison_parser.cpp"
         break;
 
-    case 154: /* statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).statement)); }
-#line 1667 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_statement: /* statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).statement)); }
+#line 1869 "bison_parser.cpp"
         break;
 
-    case 155: /* preparable_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).statement)); }
-#line 1673 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_preparable_statement: /* preparable_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).statement)); }
+#line 1875 "bison_parser.cpp"
         break;
 
-    case 156: /* opt_hints  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_opt_hints: /* opt_hints  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).expr_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).expr_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).expr_vec));
+	deleteVector((((*yyvaluep).expr_vec)), Arena::current());
 }
-#line 1686 "bison_parser.cpp" /* yacc.c:1257  */
+#line 1888 "bison_parser.cpp"
         break;
 
-    case 157: /* hint_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_hint_list: /* hint_list  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).expr_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).expr_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).expr_vec));
+	deleteVector((((*yyvaluep).expr_vec)), Arena::current());
 }
-#line 1699 "bison_parser.cpp" /* yacc.c:1257  */
+#line 1901 "bison_parser.cpp"
         break;
 
-    case 158: /* hint  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 1705 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_hint: /* hint  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 1907 "bison_parser.cpp"
         break;
 
-    case 159: /* prepare_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).prep_stmt)); }
-#line 1711 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_prepare_statement: /* prepare_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).prep_stmt)); }
+#line 1913 "bison_parser.cpp"
         break;
 
-    case 160: /* prepare_target_query  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 1717 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_prepare_target_query: /* prepare_target_query  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 1919 "bison_parser.cpp"
         break;
 
-    case 161: /* execute_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).exec_stmt)); }
-#line 1723 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_execute_statement: /* execute_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).exec_stmt)); }
+#line 1925 "bison_parser.cpp"
         break;
 
-    case 162: /* import_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).import_stmt)); }
-#line 1729 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_import_statement: /* import_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).import_stmt)); }
+#line 1931 "bison_parser.cpp"
         break;
 
-    case 163: /* import_file_type  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1735 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_import_file_type: /* import_file_type  */
+#line 174 "bison_parser.y"
+            { }
+#line 1937 "bison_parser.cpp"
         break;
 
-    case 164: /* file_path  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 1741 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_file_path: /* file_path  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 1943 "bison_parser.cpp"
         break;
 
-    case 165: /* show_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).show_stmt)); }
-#line 1747 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_show_statement: /* show_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).show_stmt)); }
+#line 1949 "bison_parser.cpp"
         break;
 
-    case 166: /* create_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).create_stmt)); }
-#line 1753 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_create_statement: /* create_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).create_stmt)); }
+#line 1955 "bison_parser.cpp"
         break;
 
-    case 167: /* opt_not_exists  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1759 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_not_exists: /* opt_not_exists  */
+#line 174 "bison_parser.y"
+            { }
+#line 1961 "bison_parser.cpp"
         break;
 
-    case 168: /* column_def_commalist  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_column_def_commalist: /* column_def_commalist  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).column_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).column_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).column_vec));
+	deleteVector((((*yyvaluep).column_vec)), Arena::current());
 }
-#line 1772 "bison_parser.cpp" /* yacc.c:1257  */
+#line 1974 "bison_parser.cpp"
         break;
 
-    case 169: /* column_def  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).column_t)); }
-#line 1778 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_column_def: /* column_def  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).column_t)); }
+#line 1980 "bison_parser.cpp"
         break;
 
-    case 170: /* column_type  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1784 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_column_type: /* column_type  */
+#line 174 "bison_parser.y"
+            { }
+#line 1986 "bison_parser.cpp"
         break;
 
-    case 171: /* drop_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).drop_stmt)); }
-#line 1790 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_drop_statement: /* drop_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).drop_stmt)); }
+#line 1992 "bison_parser.cpp"
         break;
 
-    case 172: /* opt_exists  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1796 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_exists: /* opt_exists  */
+#line 174 "bison_parser.y"
+            { }
+#line 1998 "bison_parser.cpp"
         break;
 
-    case 173: /* delete_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).delete_stmt)); }
-#line 1802 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_delete_statement: /* delete_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).delete_stmt)); }
+#line 2004 "bison_parser.cpp"
         break;
 
-    case 174: /* truncate_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).delete_stmt)); }
-#line 1808 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_truncate_statement: /* truncate_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).delete_stmt)); }
+#line 2010 "bison_parser.cpp"
         break;
 
-    case 175: /* insert_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).insert_stmt)); }
-#line 1814 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_insert_statement: /* insert_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).insert_stmt)); }
+#line 2016 "bison_parser.cpp"
         break;
 
-    case 176: /* opt_column_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_opt_column_list: /* opt_column_list  */
+#line 177 "bison_parser.y"
+            {
 	if ((((*yyvaluep).str_vec)) != nullptr) {
-		for (auto ptr : *(((*yyvaluep).str_vec))) {
-			delete ptr;
+		for (char* ptr : *(((*yyvaluep).str_vec))) {
+			freeString(ptr, Arena::current());
 		}
 	}
-	delete (((*yyvaluep).str_vec));
+	deleteVector((((*yyvaluep).str_vec)), Arena::current());
 }
-#line 1827 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2029 "bison_parser.cpp"
         break;
 
-    case 177: /* update_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).update_stmt)); }
-#line 1833 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_values_start: /* values_start  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).values_block)); }
+#line 2035 "bison_parser.cpp"
         break;
 
-    case 178: /* update_clause_commalist  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_update_statement: /* update_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).update_stmt)); }
+#line 2041 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_update_clause_commalist: /* update_clause_commalist  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).update_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).update_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).update_vec));
+	deleteVector((((*yyvaluep).update_vec)), Arena::current());
 }
-#line 1846 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2054 "bison_parser.cpp"
         break;
 
-    case 179: /* update_clause  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).update_t)); }
-#line 1852 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_update_clause: /* update_clause  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).update_t)); }
+#line 2060 "bison_parser.cpp"
         break;
 
-    case 180: /* select_statement  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).select_stmt)); }
-#line 1858 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_select_statement: /* select_statement  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2066 "bison_parser.cpp"
         break;
 
-    case 181: /* select_with_paren  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).select_stmt)); }
-#line 1864 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_select_with_paren: /* select_with_paren  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2072 "bison_parser.cpp"
         break;
 
-    case 182: /* select_paren_or_clause  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).select_stmt)); }
-#line 1870 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_select_paren_or_clause: /* select_paren_or_clause  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2078 "bison_parser.cpp"
         break;
 
-    case 183: /* select_no_paren  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).select_stmt)); }
-#line 1876 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_select_no_paren: /* select_no_paren  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2084 "bison_parser.cpp"
         break;
 
-    case 187: /* select_clause  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).select_stmt)); }
-#line 1882 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_set_operation: /* set_operation  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2090 "bison_parser.cpp"
         break;
 
-    case 188: /* opt_distinct  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1888 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_paren_set_operation: /* paren_set_operation  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2096 "bison_parser.cpp"
         break;
 
-    case 189: /* select_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_set_type: /* set_type  */
+#line 174 "bison_parser.y"
+            { }
+#line 2102 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_opt_all: /* opt_all  */
+#line 174 "bison_parser.y"
+            { }
+#line 2108 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_select_clause: /* select_clause  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).select_stmt)); }
+#line 2114 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_opt_distinct: /* opt_distinct  */
+#line 174 "bison_parser.y"
+            { }
+#line 2120 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_select_list: /* select_list  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).expr_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).expr_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).expr_vec));
+	deleteVector((((*yyvaluep).expr_vec)), Arena::current());
 }
-#line 1901 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2133 "bison_parser.cpp"
         break;
 
-    case 190: /* from_clause  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 1907 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_from_clause: /* from_clause  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2139 "bison_parser.cpp"
         break;
 
-    case 191: /* opt_where  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 1913 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_where: /* opt_where  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2145 "bison_parser.cpp"
         break;
 
-    case 192: /* opt_group  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).group_t)); }
-#line 1919 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_group: /* opt_group  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).group_t)); }
+#line 2151 "bison_parser.cpp"
         break;
 
-    case 193: /* opt_having  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 1925 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_having: /* opt_having  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2157 "bison_parser.cpp"
         break;
 
-    case 194: /* opt_order  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_opt_order: /* opt_order  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).order_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).order_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).order_vec));
+	deleteVector((((*yyvaluep).order_vec)), Arena::current());
 }
-#line 1938 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2170 "bison_parser.cpp"
         break;
 
-    case 195: /* order_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_order_list: /* order_list  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).order_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).order_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).order_vec));
+	deleteVector((((*yyvaluep).order_vec)), Arena::current());
 }
-#line 1951 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2183 "bison_parser.cpp"
         break;
 
-    case 196: /* order_desc  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).order)); }
-#line 1957 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_order_desc: /* order_desc  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).order)); }
+#line 2189 "bison_parser.cpp"
         break;
 
-    case 197: /* opt_order_type  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 1963 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_order_type: /* opt_order_type  */
+#line 174 "bison_parser.y"
+            { }
+#line 2195 "bison_parser.cpp"
         break;
 
-    case 198: /* opt_top  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).limit)); }
-#line 1969 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_top: /* opt_top  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).limit)); }
+#line 2201 "bison_parser.cpp"
         break;
 
-    case 199: /* opt_limit  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).limit)); }
-#line 1975 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_limit: /* opt_limit  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).limit)); }
+#line 2207 "bison_parser.cpp"
         break;
 
-    case 200: /* expr_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_expr_list: /* expr_list  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).expr_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).expr_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).expr_vec));
+	deleteVector((((*yyvaluep).expr_vec)), Arena::current());
 }
-#line 1988 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2220 "bison_parser.cpp"
         break;
 
-    case 201: /* literal_list  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_literal_list: /* literal_list  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).expr_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).expr_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).expr_vec));
+	deleteVector((((*yyvaluep).expr_vec)), Arena::current());
 }
-#line 2001 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2233 "bison_parser.cpp"
         break;
 
-    case 202: /* expr_alias  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2007 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_expr_alias: /* expr_alias  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2239 "bison_parser.cpp"
         break;
 
-    case 203: /* expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2013 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_expr: /* expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2245 "bison_parser.cpp"
         break;
 
-    case 204: /* operand  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2019 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_operand: /* operand  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2251 "bison_parser.cpp"
         break;
 
-    case 205: /* scalar_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2025 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_scalar_expr: /* scalar_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2257 "bison_parser.cpp"
         break;
 
-    case 206: /* unary_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2031 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_unary_expr: /* unary_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2263 "bison_parser.cpp"
         break;
 
-    case 207: /* binary_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2037 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_binary_expr: /* binary_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2269 "bison_parser.cpp"
         break;
 
-    case 208: /* logic_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2043 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_logic_expr: /* logic_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2275 "bison_parser.cpp"
         break;
 
-    case 209: /* in_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2049 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_in_expr: /* in_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2281 "bison_parser.cpp"
         break;
 
-    case 210: /* case_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2055 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_in_list: /* in_list  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2287 "bison_parser.cpp"
         break;
 
-    case 211: /* exists_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2061 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_case_expr: /* case_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2293 "bison_parser.cpp"
         break;
 
-    case 212: /* comp_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2067 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_exists_expr: /* exists_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2299 "bison_parser.cpp"
         break;
 
-    case 213: /* function_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2073 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_comp_expr: /* comp_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2305 "bison_parser.cpp"
         break;
 
-    case 214: /* array_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2079 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_function_expr: /* function_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2311 "bison_parser.cpp"
         break;
 
-    case 215: /* array_index  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2085 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_array_expr: /* array_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2317 "bison_parser.cpp"
         break;
 
-    case 216: /* between_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2091 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_array_index: /* array_index  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2323 "bison_parser.cpp"
         break;
 
-    case 217: /* column_name  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2097 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_between_expr: /* between_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2329 "bison_parser.cpp"
         break;
 
-    case 218: /* literal  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2103 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_column_name: /* column_name  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2335 "bison_parser.cpp"
         break;
 
-    case 219: /* string_literal  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2109 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_literal: /* literal  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2341 "bison_parser.cpp"
         break;
 
-    case 220: /* num_literal  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2115 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_string_literal: /* string_literal  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2347 "bison_parser.cpp"
         break;
 
-    case 221: /* int_literal  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2121 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_num_literal: /* num_literal  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2353 "bison_parser.cpp"
         break;
 
-    case 222: /* null_literal  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2127 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_int_literal: /* int_literal  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2359 "bison_parser.cpp"
         break;
 
-    case 223: /* param_expr  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2133 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_null_literal: /* null_literal  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2365 "bison_parser.cpp"
         break;
 
-    case 224: /* table_ref  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2139 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_param_expr: /* param_expr  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2371 "bison_parser.cpp"
         break;
 
-    case 225: /* table_ref_atomic  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2145 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_table_ref: /* table_ref  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2377 "bison_parser.cpp"
         break;
 
-    case 226: /* nonjoin_table_ref_atomic  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2151 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_table_ref_atomic: /* table_ref_atomic  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2383 "bison_parser.cpp"
         break;
 
-    case 227: /* table_ref_commalist  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_nonjoin_table_ref_atomic: /* nonjoin_table_ref_atomic  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2389 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_table_ref_commalist: /* table_ref_commalist  */
+#line 185 "bison_parser.y"
+            {
 	if ((((*yyvaluep).table_vec)) != nullptr) {
 		for (auto ptr : *(((*yyvaluep).table_vec))) {
 			delete ptr;
 		}
 	}
-	delete (((*yyvaluep).table_vec));
+	deleteVector((((*yyvaluep).table_vec)), Arena::current());
 }
-#line 2164 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2402 "bison_parser.cpp"
         break;
 
-    case 228: /* table_ref_name  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2170 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_table_ref_name: /* table_ref_name  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2408 "bison_parser.cpp"
         break;
 
-    case 229: /* table_ref_name_no_alias  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2176 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_table_ref_name_no_alias: /* table_ref_name_no_alias  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2414 "bison_parser.cpp"
         break;
 
-    case 230: /* table_name  */
-#line 137 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).table_name).name) ); free( (((*yyvaluep).table_name).schema) ); }
-#line 2182 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_table_name: /* table_name  */
+#line 175 "bison_parser.y"
+            { freeString( (((*yyvaluep).table_name).name), Arena::current() ); freeString( (((*yyvaluep).table_name).schema), Arena::current() ); }
+#line 2420 "bison_parser.cpp"
         break;
 
-    case 231: /* alias  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 2188 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_alias: /* alias  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 2426 "bison_parser.cpp"
         break;
 
-    case 232: /* opt_alias  */
-#line 138 "bison_parser.y" /* yacc.c:1257  */
-      { free( (((*yyvaluep).sval)) ); }
-#line 2194 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_alias: /* opt_alias  */
+#line 176 "bison_parser.y"
+            { freeString( (((*yyvaluep).sval)), Arena::current() ); }
+#line 2432 "bison_parser.cpp"
         break;
 
-    case 233: /* join_clause  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).table)); }
-#line 2200 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_join_clause: /* join_clause  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).table)); }
+#line 2438 "bison_parser.cpp"
         break;
 
-    case 234: /* opt_join_type  */
-#line 136 "bison_parser.y" /* yacc.c:1257  */
-      { }
-#line 2206 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_opt_join_type: /* opt_join_type  */
+#line 174 "bison_parser.y"
+            { }
+#line 2444 "bison_parser.cpp"
         break;
 
-    case 235: /* join_condition  */
-#line 147 "bison_parser.y" /* yacc.c:1257  */
-      { delete (((*yyvaluep).expr)); }
-#line 2212 "bison_parser.cpp" /* yacc.c:1257  */
+    case YYSYMBOL_join_condition: /* join_condition  */
+#line 193 "bison_parser.y"
+            { delete (((*yyvaluep).expr)); }
+#line 2450 "bison_parser.cpp"
         break;
 
-    case 237: /* ident_commalist  */
-#line 139 "bison_parser.y" /* yacc.c:1257  */
-      {
+    case YYSYMBOL_ident_commalist: /* ident_commalist  */
+#line 177 "bison_parser.y"
+            {
 	if ((((*yyvaluep).str_vec)) != nullptr) {
-		for (auto ptr : *(((*yyvaluep).str_vec))) {
-			delete ptr;
+		for (char* ptr : *(((*yyvaluep).str_vec))) {
+			freeString(ptr, Arena::current());
 		}
 	}
-	delete (((*yyvaluep).str_vec));
+	deleteVector((((*yyvaluep).str_vec)), Arena::current());
 }
-#line 2225 "bison_parser.cpp" /* yacc.c:1257  */
+#line 2463 "bison_parser.cpp"
         break;
 
-
       default:
         break;
     }
@@ -2234,14 +2471,16 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
 int
-yyparse (hsql::SQLParserResult* result, yyscan_t scanner)
+yyparse (hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -2260,55 +2499,50 @@ static YYLTYPE yyloc_default
 YYLTYPE yylloc = yyloc_default;
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -2316,56 +2550,60 @@ YYLTYPE yylloc = yyloc_default;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+  yychar = SQL_HSQL_EMPTY; /* Cause a token to be read.  */
+
 
 /* User initialization code.  */
-#line 72 "bison_parser.y" /* yacc.c:1429  */
+#line 111 "bison_parser.y"
 {
 	// Initialize
-	yylloc.first_column = 0;
-	yylloc.last_column = 0;
-	yylloc.first_line = 0;
-	yylloc.last_line = 0;
-	yylloc.total_column = 0;
+	yylloc.first_offset = 0;
+	yylloc.last_offset = 0;
 }
 
-#line 2343 "bison_parser.cpp" /* yacc.c:1429  */
+#line 2567 "bison_parser.cpp"
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -2373,32 +2611,29 @@ YYLTYPE yylloc = yyloc_default;
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
-
-        yyls = yyls1;
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -2407,31 +2642,32 @@ YYLTYPE yylloc = yyloc_default;
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2442,18 +2678,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == SQL_HSQL_EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, &yylloc, scanner);
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= SQL_YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = SQL_YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == SQL_HSQL_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = SQL_HSQL_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2481,15 +2729,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = SQL_HSQL_EMPTY;
   goto yynewstate;
 
 
@@ -2504,7 +2751,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2520,265 +2767,271 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 245 "bison_parser.y" /* yacc.c:1646  */
-    {
-			for (SQLStatement* stmt : *(yyvsp[-1].stmt_vec)) {
+  case 2: /* input: statement_list opt_semicolon  */
+#line 293 "bison_parser.y"
+                                             {
+			for (SQLStatement* stmt : state->statements) {
 				// Transfers ownership of the statement.
 				result->addStatement(stmt);
 			}
-
-			unsigned param_id = 0;
-			for (void* param : yyloc.param_list) {
-				if (param != nullptr) {
-					Expr* expr = (Expr*) param;
-					expr->ival = param_id;
-					result->addParameter(expr);
-					++param_id;
+			state->statements.clear();
+
+			// Placeholders ('?') are numbered in the order they were read.
+			// Numbered placeholders ($1) already have their id, but might
+			// not be in order.
+			if (state->numbered_params) {
+				std::stable_sort(state->param_list.begin(), state->param_list.end(),
+				[](const Expr* a, const Expr* b) { return a->ival < b->ival; });
+			} else {
+				for (size_t i = 0; i < state->param_list.size(); ++i) {
+					state->param_list[i]->ival = i;
 				}
 			}
-			delete (yyvsp[-1].stmt_vec);
+			for (Expr* param : state->param_list) {
+				result->addParameter(param);
+			}
 		}
-#line 2548 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2801 "bison_parser.cpp"
     break;
 
-  case 3:
-#line 266 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.stmt_vec) = new std::vector<SQLStatement*>(); (yyval.stmt_vec)->push_back((yyvsp[0].statement)); }
-#line 2554 "bison_parser.cpp" /* yacc.c:1646  */
+  case 3: /* statement_list: statement  */
+#line 319 "bison_parser.y"
+                          { state->statements.push_back((yyvsp[0].statement)); }
+#line 2807 "bison_parser.cpp"
     break;
 
-  case 4:
-#line 267 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].stmt_vec)->push_back((yyvsp[0].statement)); (yyval.stmt_vec) = (yyvsp[-2].stmt_vec); }
-#line 2560 "bison_parser.cpp" /* yacc.c:1646  */
+  case 4: /* statement_list: statement_list ';' statement  */
+#line 320 "bison_parser.y"
+                                             { state->statements.push_back((yyvsp[0].statement)); }
+#line 2813 "bison_parser.cpp"
     break;
 
-  case 5:
-#line 271 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 5: /* statement: prepare_statement opt_hints  */
+#line 324 "bison_parser.y"
+                                            {
 			(yyval.statement) = (yyvsp[-1].prep_stmt);
 			(yyval.statement)->hints = (yyvsp[0].expr_vec);
 		}
-#line 2569 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2822 "bison_parser.cpp"
     break;
 
-  case 6:
-#line 275 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 6: /* statement: preparable_statement opt_hints  */
+#line 328 "bison_parser.y"
+                                               {
 			(yyval.statement) = (yyvsp[-1].statement);
 			(yyval.statement)->hints = (yyvsp[0].expr_vec);
 		}
-#line 2578 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2831 "bison_parser.cpp"
     break;
 
-  case 7:
-#line 279 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 7: /* statement: show_statement  */
+#line 332 "bison_parser.y"
+                               {
 			(yyval.statement) = (yyvsp[0].show_stmt);
 		}
-#line 2586 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2839 "bison_parser.cpp"
     break;
 
-  case 8:
-#line 286 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].select_stmt); }
-#line 2592 "bison_parser.cpp" /* yacc.c:1646  */
+  case 8: /* preparable_statement: select_statement  */
+#line 339 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].select_stmt); }
+#line 2845 "bison_parser.cpp"
     break;
 
-  case 9:
-#line 287 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].import_stmt); }
-#line 2598 "bison_parser.cpp" /* yacc.c:1646  */
+  case 9: /* preparable_statement: import_statement  */
+#line 340 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].import_stmt); }
+#line 2851 "bison_parser.cpp"
     break;
 
-  case 10:
-#line 288 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].create_stmt); }
-#line 2604 "bison_parser.cpp" /* yacc.c:1646  */
+  case 10: /* preparable_statement: create_statement  */
+#line 341 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].create_stmt); }
+#line 2857 "bison_parser.cpp"
     break;
 
-  case 11:
-#line 289 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].insert_stmt); }
-#line 2610 "bison_parser.cpp" /* yacc.c:1646  */
+  case 11: /* preparable_statement: insert_statement  */
+#line 342 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].insert_stmt); }
+#line 2863 "bison_parser.cpp"
     break;
 
-  case 12:
-#line 290 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 2616 "bison_parser.cpp" /* yacc.c:1646  */
+  case 12: /* preparable_statement: delete_statement  */
+#line 343 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].delete_stmt); }
+#line 2869 "bison_parser.cpp"
     break;
 
-  case 13:
-#line 291 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 2622 "bison_parser.cpp" /* yacc.c:1646  */
+  case 13: /* preparable_statement: truncate_statement  */
+#line 344 "bison_parser.y"
+                                   { (yyval.statement) = (yyvsp[0].delete_stmt); }
+#line 2875 "bison_parser.cpp"
     break;
 
-  case 14:
-#line 292 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].update_stmt); }
-#line 2628 "bison_parser.cpp" /* yacc.c:1646  */
+  case 14: /* preparable_statement: update_statement  */
+#line 345 "bison_parser.y"
+                                 { (yyval.statement) = (yyvsp[0].update_stmt); }
+#line 2881 "bison_parser.cpp"
     break;
 
-  case 15:
-#line 293 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].drop_stmt); }
-#line 2634 "bison_parser.cpp" /* yacc.c:1646  */
+  case 15: /* preparable_statement: drop_statement  */
+#line 346 "bison_parser.y"
+                               { (yyval.statement) = (yyvsp[0].drop_stmt); }
+#line 2887 "bison_parser.cpp"
     break;
 
-  case 16:
-#line 294 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.statement) = (yyvsp[0].exec_stmt); }
-#line 2640 "bison_parser.cpp" /* yacc.c:1646  */
+  case 16: /* preparable_statement: execute_statement  */
+#line 347 "bison_parser.y"
+                                  { (yyval.statement) = (yyvsp[0].exec_stmt); }
+#line 2893 "bison_parser.cpp"
     break;
 
-  case 17:
-#line 303 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr_vec) = (yyvsp[-1].expr_vec); }
-#line 2646 "bison_parser.cpp" /* yacc.c:1646  */
+  case 17: /* opt_hints: WITH HINT '(' hint_list ')'  */
+#line 356 "bison_parser.y"
+                                { (yyval.expr_vec) = (yyvsp[-1].expr_vec); }
+#line 2899 "bison_parser.cpp"
     break;
 
-  case 18:
-#line 304 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr_vec) = nullptr; }
-#line 2652 "bison_parser.cpp" /* yacc.c:1646  */
+  case 18: /* opt_hints: %empty  */
+#line 357 "bison_parser.y"
+                { (yyval.expr_vec) = nullptr; }
+#line 2905 "bison_parser.cpp"
     break;
 
-  case 19:
-#line 309 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr_vec) = new std::vector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
-#line 2658 "bison_parser.cpp" /* yacc.c:1646  */
+  case 19: /* hint_list: hint  */
+#line 362 "bison_parser.y"
+               { (yyval.expr_vec) = newVector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
+#line 2911 "bison_parser.cpp"
     break;
 
-  case 20:
-#line 310 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
-#line 2664 "bison_parser.cpp" /* yacc.c:1646  */
+  case 20: /* hint_list: hint_list ',' hint  */
+#line 363 "bison_parser.y"
+                             { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
+#line 2917 "bison_parser.cpp"
     break;
 
-  case 21:
-#line 314 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 21: /* hint: IDENTIFIER  */
+#line 367 "bison_parser.y"
+                           {
 			(yyval.expr) = Expr::make(kExprHint);
 			(yyval.expr)->name = (yyvsp[0].sval);
 		}
-#line 2673 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2926 "bison_parser.cpp"
     break;
 
-  case 22:
-#line 318 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 22: /* hint: IDENTIFIER '(' literal_list ')'  */
+#line 371 "bison_parser.y"
+                                          {
 			(yyval.expr) = Expr::make(kExprHint);
 			(yyval.expr)->name = (yyvsp[-3].sval);
 			(yyval.expr)->exprList = (yyvsp[-1].expr_vec);
 		}
-#line 2683 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2936 "bison_parser.cpp"
     break;
 
-  case 23:
-#line 330 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 23: /* prepare_statement: PREPARE IDENTIFIER FROM prepare_target_query  */
+#line 383 "bison_parser.y"
+                                                             {
 			(yyval.prep_stmt) = new PrepareStatement();
 			(yyval.prep_stmt)->name = (yyvsp[-2].sval);
 			(yyval.prep_stmt)->query = (yyvsp[0].sval);
 		}
-#line 2693 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2946 "bison_parser.cpp"
     break;
 
-  case 25:
-#line 340 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 25: /* execute_statement: EXECUTE IDENTIFIER  */
+#line 393 "bison_parser.y"
+                                   {
 			(yyval.exec_stmt) = new ExecuteStatement();
 			(yyval.exec_stmt)->name = (yyvsp[0].sval);
 		}
-#line 2702 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2955 "bison_parser.cpp"
     break;
 
-  case 26:
-#line 344 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 26: /* execute_statement: EXECUTE IDENTIFIER '(' literal_list ')'  */
+#line 397 "bison_parser.y"
+                                                        {
 			(yyval.exec_stmt) = new ExecuteStatement();
 			(yyval.exec_stmt)->name = (yyvsp[-3].sval);
 			(yyval.exec_stmt)->parameters = (yyvsp[-1].expr_vec);
 		}
-#line 2712 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2965 "bison_parser.cpp"
     break;
 
-  case 27:
-#line 356 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 27: /* import_statement: IMPORT FROM import_file_type FILE file_path INTO table_name  */
+#line 409 "bison_parser.y"
+                                                                            {
 			(yyval.import_stmt) = new ImportStatement((ImportType) (yyvsp[-4].uval));
 			(yyval.import_stmt)->filePath = (yyvsp[-2].sval);
 			(yyval.import_stmt)->schema = (yyvsp[0].table_name).schema;
 			(yyval.import_stmt)->tableName = (yyvsp[0].table_name).name;
 		}
-#line 2723 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2976 "bison_parser.cpp"
     break;
 
-  case 28:
-#line 365 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kImportCSV; }
-#line 2729 "bison_parser.cpp" /* yacc.c:1646  */
+  case 28: /* import_file_type: CSV  */
+#line 418 "bison_parser.y"
+                    { (yyval.uval) = kImportCSV; }
+#line 2982 "bison_parser.cpp"
     break;
 
-  case 29:
-#line 369 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.sval) = strdup((yyvsp[0].expr)->name); delete (yyvsp[0].expr); }
-#line 2735 "bison_parser.cpp" /* yacc.c:1646  */
+  case 29: /* file_path: string_literal  */
+#line 422 "bison_parser.y"
+                               { (yyval.sval) = (yyvsp[0].expr)->name; (yyvsp[0].expr)->name = nullptr; delete (yyvsp[0].expr); }
+#line 2988 "bison_parser.cpp"
     break;
 
-  case 30:
-#line 379 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 30: /* show_statement: SHOW TABLES  */
+#line 432 "bison_parser.y"
+                            {
 			(yyval.show_stmt) = new ShowStatement(kShowTables);
 		}
-#line 2743 "bison_parser.cpp" /* yacc.c:1646  */
+#line 2996 "bison_parser.cpp"
     break;
 
-  case 31:
-#line 382 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 31: /* show_statement: SHOW COLUMNS table_name  */
+#line 435 "bison_parser.y"
+                                        {
 			(yyval.show_stmt) = new ShowStatement(kShowColumns);
 			(yyval.show_stmt)->schema = (yyvsp[0].table_name).schema;
 			(yyval.show_stmt)->name = (yyvsp[0].table_name).name;
 		}
-#line 2753 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3006 "bison_parser.cpp"
     break;
 
-  case 32:
-#line 396 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 32: /* create_statement: CREATE TABLE opt_not_exists table_name FROM TBL FILE file_path  */
+#line 449 "bison_parser.y"
+                                                                               {
 			(yyval.create_stmt) = new CreateStatement(kCreateTableFromTbl);
 			(yyval.create_stmt)->ifNotExists = (yyvsp[-5].bval);
 			(yyval.create_stmt)->schema = (yyvsp[-4].table_name).schema;
 			(yyval.create_stmt)->tableName = (yyvsp[-4].table_name).name;
 			(yyval.create_stmt)->filePath = (yyvsp[0].sval);
 		}
-#line 2765 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3018 "bison_parser.cpp"
     break;
 
-  case 33:
-#line 403 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 33: /* create_statement: CREATE TABLE opt_not_exists table_name '(' column_def_commalist ')'  */
+#line 456 "bison_parser.y"
+                                                                                    {
 			(yyval.create_stmt) = new CreateStatement(kCreateTable);
 			(yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
 			(yyval.create_stmt)->schema = (yyvsp[-3].table_name).schema;
 			(yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
 			(yyval.create_stmt)->columns = (yyvsp[-1].column_vec);
 		}
-#line 2777 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3030 "bison_parser.cpp"
     break;
 
-  case 34:
-#line 410 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 34: /* create_statement: CREATE VIEW opt_not_exists table_name opt_column_list AS select_statement  */
+#line 463 "bison_parser.y"
+                                                                                          {
 			(yyval.create_stmt) = new CreateStatement(kCreateView);
 			(yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
 			(yyval.create_stmt)->schema = (yyvsp[-3].table_name).schema;
@@ -2786,233 +3039,277 @@ yyreduce:
 			(yyval.create_stmt)->viewColumns = (yyvsp[-2].str_vec);
 			(yyval.create_stmt)->select = (yyvsp[0].select_stmt);
 		}
-#line 2790 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3043 "bison_parser.cpp"
     break;
 
-  case 35:
-#line 421 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = true; }
-#line 2796 "bison_parser.cpp" /* yacc.c:1646  */
+  case 35: /* opt_not_exists: IF NOT EXISTS  */
+#line 474 "bison_parser.y"
+                              { (yyval.bval) = true; }
+#line 3049 "bison_parser.cpp"
     break;
 
-  case 36:
-#line 422 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = false; }
-#line 2802 "bison_parser.cpp" /* yacc.c:1646  */
+  case 36: /* opt_not_exists: %empty  */
+#line 475 "bison_parser.y"
+                            { (yyval.bval) = false; }
+#line 3055 "bison_parser.cpp"
     break;
 
-  case 37:
-#line 426 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.column_vec) = new std::vector<ColumnDefinition*>(); (yyval.column_vec)->push_back((yyvsp[0].column_t)); }
-#line 2808 "bison_parser.cpp" /* yacc.c:1646  */
+  case 37: /* column_def_commalist: column_def  */
+#line 479 "bison_parser.y"
+                           { (yyval.column_vec) = newVector<ColumnDefinition*>(); (yyval.column_vec)->push_back((yyvsp[0].column_t)); }
+#line 3061 "bison_parser.cpp"
     break;
 
-  case 38:
-#line 427 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].column_vec)->push_back((yyvsp[0].column_t)); (yyval.column_vec) = (yyvsp[-2].column_vec); }
-#line 2814 "bison_parser.cpp" /* yacc.c:1646  */
+  case 38: /* column_def_commalist: column_def_commalist ',' column_def  */
+#line 480 "bison_parser.y"
+                                                    { (yyvsp[-2].column_vec)->push_back((yyvsp[0].column_t)); (yyval.column_vec) = (yyvsp[-2].column_vec); }
+#line 3067 "bison_parser.cpp"
     break;
 
-  case 39:
-#line 431 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 39: /* column_def: IDENTIFIER column_type  */
+#line 484 "bison_parser.y"
+                                       {
 			(yyval.column_t) = new ColumnDefinition((yyvsp[-1].sval), (ColumnDefinition::DataType) (yyvsp[0].uval));
 		}
-#line 2822 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3075 "bison_parser.cpp"
     break;
 
-  case 40:
-#line 438 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = ColumnDefinition::INT; }
-#line 2828 "bison_parser.cpp" /* yacc.c:1646  */
+  case 40: /* column_type: INT  */
+#line 491 "bison_parser.y"
+                    { (yyval.uval) = ColumnDefinition::INT; }
+#line 3081 "bison_parser.cpp"
     break;
 
-  case 41:
-#line 439 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = ColumnDefinition::INT; }
-#line 2834 "bison_parser.cpp" /* yacc.c:1646  */
+  case 41: /* column_type: INTEGER  */
+#line 492 "bison_parser.y"
+                        { (yyval.uval) = ColumnDefinition::INT; }
+#line 3087 "bison_parser.cpp"
     break;
 
-  case 42:
-#line 440 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = ColumnDefinition::DOUBLE; }
-#line 2840 "bison_parser.cpp" /* yacc.c:1646  */
+  case 42: /* column_type: DOUBLE  */
+#line 493 "bison_parser.y"
+                       { (yyval.uval) = ColumnDefinition::DOUBLE; }
+#line 3093 "bison_parser.cpp"
     break;
 
-  case 43:
-#line 441 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = ColumnDefinition::TEXT; }
-#line 2846 "bison_parser.cpp" /* yacc.c:1646  */
+  case 43: /* column_type: TEXT  */
+#line 494 "bison_parser.y"
+                     { (yyval.uval) = ColumnDefinition::TEXT; }
+#line 3099 "bison_parser.cpp"
     break;
 
-  case 44:
-#line 451 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 44: /* drop_statement: DROP TABLE opt_exists table_name  */
+#line 504 "bison_parser.y"
+                                                 {
 			(yyval.drop_stmt) = new DropStatement(kDropTable);
 			(yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
 			(yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
 			(yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 		}
-#line 2857 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3110 "bison_parser.cpp"
     break;
 
-  case 45:
-#line 457 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 45: /* drop_statement: DROP VIEW opt_exists table_name  */
+#line 510 "bison_parser.y"
+                                                {
 			(yyval.drop_stmt) = new DropStatement(kDropView);
 			(yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
 			(yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
 			(yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 		}
-#line 2868 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3121 "bison_parser.cpp"
     break;
 
-  case 46:
-#line 463 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 46: /* drop_statement: DEALLOCATE PREPARE IDENTIFIER  */
+#line 516 "bison_parser.y"
+                                              {
 			(yyval.drop_stmt) = new DropStatement(kDropPreparedStatement);
 			(yyval.drop_stmt)->ifExists = false;
 			(yyval.drop_stmt)->name = (yyvsp[0].sval);
 		}
-#line 2878 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3131 "bison_parser.cpp"
     break;
 
-  case 47:
-#line 471 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = true; }
-#line 2884 "bison_parser.cpp" /* yacc.c:1646  */
+  case 47: /* opt_exists: IF EXISTS  */
+#line 524 "bison_parser.y"
+                            { (yyval.bval) = true; }
+#line 3137 "bison_parser.cpp"
     break;
 
-  case 48:
-#line 472 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = false; }
-#line 2890 "bison_parser.cpp" /* yacc.c:1646  */
+  case 48: /* opt_exists: %empty  */
+#line 525 "bison_parser.y"
+                            { (yyval.bval) = false; }
+#line 3143 "bison_parser.cpp"
     break;
 
-  case 49:
-#line 481 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 49: /* delete_statement: DELETE FROM table_name opt_where  */
+#line 534 "bison_parser.y"
+                                                 {
 			(yyval.delete_stmt) = new DeleteStatement();
 			(yyval.delete_stmt)->schema = (yyvsp[-1].table_name).schema;
 			(yyval.delete_stmt)->tableName = (yyvsp[-1].table_name).name;
 			(yyval.delete_stmt)->expr = (yyvsp[0].expr);
 		}
-#line 2901 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3154 "bison_parser.cpp"
     break;
 
-  case 50:
-#line 490 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 50: /* truncate_statement: TRUNCATE table_name  */
+#line 543 "bison_parser.y"
+                                    {
 			(yyval.delete_stmt) = new DeleteStatement();
 			(yyval.delete_stmt)->schema = (yyvsp[0].table_name).schema;
 			(yyval.delete_stmt)->tableName = (yyvsp[0].table_name).name;
 		}
-#line 2911 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3164 "bison_parser.cpp"
     break;
 
-  case 51:
-#line 503 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 51: /* insert_statement: INSERT INTO table_name opt_column_list values_start values_rows  */
+#line 557 "bison_parser.y"
+                                                                                {
 			(yyval.insert_stmt) = new InsertStatement(kInsertValues);
-			(yyval.insert_stmt)->schema = (yyvsp[-5].table_name).schema;
-			(yyval.insert_stmt)->tableName = (yyvsp[-5].table_name).name;
-			(yyval.insert_stmt)->columns = (yyvsp[-4].str_vec);
-			(yyval.insert_stmt)->values = (yyvsp[-1].expr_vec);
+			(yyval.insert_stmt)->schema = (yyvsp[-3].table_name).schema;
+			(yyval.insert_stmt)->tableName = (yyvsp[-3].table_name).name;
+			(yyval.insert_stmt)->columns = (yyvsp[-2].str_vec);
+			if ((yyvsp[-1].values_block)->numRows == 1) {
+				(yyval.insert_stmt)->values = (yyvsp[-1].values_block)->releaseRow(0);
+				delete (yyvsp[-1].values_block);
+			} else {
+				(yyval.insert_stmt)->rows = (yyvsp[-1].values_block);
+			}
+			state->values_block = nullptr;
 		}
-#line 2923 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3182 "bison_parser.cpp"
     break;
 
-  case 52:
-#line 510 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 52: /* insert_statement: INSERT INTO table_name opt_column_list select_no_paren  */
+#line 570 "bison_parser.y"
+                                                                       {
 			(yyval.insert_stmt) = new InsertStatement(kInsertSelect);
 			(yyval.insert_stmt)->schema = (yyvsp[-2].table_name).schema;
 			(yyval.insert_stmt)->tableName = (yyvsp[-2].table_name).name;
 			(yyval.insert_stmt)->columns = (yyvsp[-1].str_vec);
 			(yyval.insert_stmt)->select = (yyvsp[0].select_stmt);
 		}
-#line 2935 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3194 "bison_parser.cpp"
     break;
 
-  case 53:
-#line 521 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.str_vec) = (yyvsp[-1].str_vec); }
-#line 2941 "bison_parser.cpp" /* yacc.c:1646  */
+  case 53: /* opt_column_list: '(' ident_commalist ')'  */
+#line 581 "bison_parser.y"
+                                        { (yyval.str_vec) = (yyvsp[-1].str_vec); }
+#line 3200 "bison_parser.cpp"
     break;
 
-  case 54:
-#line 522 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.str_vec) = nullptr; }
-#line 2947 "bison_parser.cpp" /* yacc.c:1646  */
+  case 54: /* opt_column_list: %empty  */
+#line 582 "bison_parser.y"
+                            { (yyval.str_vec) = nullptr; }
+#line 3206 "bison_parser.cpp"
     break;
 
-  case 55:
-#line 532 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 55: /* values_start: VALUES  */
+#line 588 "bison_parser.y"
+                       { (yyval.values_block) = new ValuesBlock(); state->values_block = (yyval.values_block); }
+#line 3212 "bison_parser.cpp"
+    break;
+
+  case 58: /* values_row: '(' row_values ')'  */
+#line 597 "bison_parser.y"
+                                   {
+			if (!state->values_block->endRow()) {
+				yyerror(&(yyloc), result, scanner, state, "All rows of VALUES must have the same number of values");
+				YYERROR;
+			}
+		}
+#line 3223 "bison_parser.cpp"
+    break;
+
+  case 61: /* row_value: STRING  */
+#line 611 "bison_parser.y"
+                       { state->values_block->addString((yyvsp[0].sval)); }
+#line 3229 "bison_parser.cpp"
+    break;
+
+  case 62: /* row_value: FLOATVAL  */
+#line 612 "bison_parser.y"
+                         { state->values_block->addFloat((yyvsp[0].fval)); }
+#line 3235 "bison_parser.cpp"
+    break;
+
+  case 63: /* row_value: INTVAL  */
+#line 613 "bison_parser.y"
+                       { state->values_block->addInt((yyvsp[0].ival)); }
+#line 3241 "bison_parser.cpp"
+    break;
+
+  case 64: /* row_value: NULL  */
+#line 614 "bison_parser.y"
+                     { state->values_block->addNull(); }
+#line 3247 "bison_parser.cpp"
+    break;
+
+  case 65: /* row_value: param_expr  */
+#line 615 "bison_parser.y"
+                           { state->values_block->addExpr((yyvsp[0].expr)); }
+#line 3253 "bison_parser.cpp"
+    break;
+
+  case 66: /* update_statement: UPDATE table_ref_name_no_alias SET update_clause_commalist opt_where  */
+#line 625 "bison_parser.y"
+                                                                             {
 		(yyval.update_stmt) = new UpdateStatement();
 		(yyval.update_stmt)->table = (yyvsp[-3].table);
 		(yyval.update_stmt)->updates = (yyvsp[-1].update_vec);
 		(yyval.update_stmt)->where = (yyvsp[0].expr);
 	}
-#line 2958 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3264 "bison_parser.cpp"
     break;
 
-  case 56:
-#line 541 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.update_vec) = new std::vector<UpdateClause*>(); (yyval.update_vec)->push_back((yyvsp[0].update_t)); }
-#line 2964 "bison_parser.cpp" /* yacc.c:1646  */
+  case 67: /* update_clause_commalist: update_clause  */
+#line 634 "bison_parser.y"
+                              { (yyval.update_vec) = newVector<UpdateClause*>(); (yyval.update_vec)->push_back((yyvsp[0].update_t)); }
+#line 3270 "bison_parser.cpp"
     break;
 
-  case 57:
-#line 542 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].update_vec)->push_back((yyvsp[0].update_t)); (yyval.update_vec) = (yyvsp[-2].update_vec); }
-#line 2970 "bison_parser.cpp" /* yacc.c:1646  */
+  case 68: /* update_clause_commalist: update_clause_commalist ',' update_clause  */
+#line 635 "bison_parser.y"
+                                                          { (yyvsp[-2].update_vec)->push_back((yyvsp[0].update_t)); (yyval.update_vec) = (yyvsp[-2].update_vec); }
+#line 3276 "bison_parser.cpp"
     break;
 
-  case 58:
-#line 546 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 69: /* update_clause: IDENTIFIER '=' expr  */
+#line 639 "bison_parser.y"
+                                    {
 			(yyval.update_t) = new UpdateClause();
 			(yyval.update_t)->column = (yyvsp[-2].sval);
 			(yyval.update_t)->value = (yyvsp[0].expr);
 		}
-#line 2980 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3286 "bison_parser.cpp"
     break;
 
-  case 61:
-#line 560 "bison_parser.y" /* yacc.c:1646  */
-    {
-			// TODO: allow multiple unions (through linked list)
-			// TODO: capture type of set_operator
-			// TODO: might overwrite order and limit of first select here
-			(yyval.select_stmt) = (yyvsp[-4].select_stmt);
-			(yyval.select_stmt)->unionSelect = (yyvsp[-2].select_stmt);
-			(yyval.select_stmt)->order = (yyvsp[-1].order_vec);
-
-			// Limit could have been set by TOP.
-			if ((yyvsp[0].limit) != nullptr) {
-				delete (yyval.select_stmt)->limit;
-				(yyval.select_stmt)->limit = (yyvsp[0].limit);
-			}
+  case 72: /* select_statement: paren_set_operation opt_order opt_limit  */
+#line 653 "bison_parser.y"
+                                                        {
+			(yyval.select_stmt) = (yyvsp[-2].select_stmt);
+			(yyval.select_stmt)->setOperation->order = (yyvsp[-1].order_vec);
+			(yyval.select_stmt)->setOperation->limit = (yyvsp[0].limit);
 		}
-#line 2999 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3296 "bison_parser.cpp"
     break;
 
-  case 62:
-#line 577 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 3005 "bison_parser.cpp" /* yacc.c:1646  */
+  case 73: /* select_with_paren: '(' select_no_paren ')'  */
+#line 661 "bison_parser.y"
+                                        { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
+#line 3302 "bison_parser.cpp"
     break;
 
-  case 63:
-#line 578 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 3011 "bison_parser.cpp" /* yacc.c:1646  */
+  case 74: /* select_with_paren: '(' select_with_paren ')'  */
+#line 662 "bison_parser.y"
+                                          { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
+#line 3308 "bison_parser.cpp"
     break;
 
-  case 66:
-#line 587 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 77: /* select_no_paren: select_clause opt_order opt_limit  */
+#line 671 "bison_parser.y"
+                                                  {
 			(yyval.select_stmt) = (yyvsp[-2].select_stmt);
 			(yyval.select_stmt)->order = (yyvsp[-1].order_vec);
 
@@ -3022,31 +3319,88 @@ yyreduce:
 				(yyval.select_stmt)->limit = (yyvsp[0].limit);
 			}
 		}
-#line 3026 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3323 "bison_parser.cpp"
     break;
 
-  case 67:
-#line 597 "bison_parser.y" /* yacc.c:1646  */
-    {
-			// TODO: allow multiple unions (through linked list)
-			// TODO: capture type of set_operator
-			// TODO: might overwrite order and limit of first select here
-			(yyval.select_stmt) = (yyvsp[-4].select_stmt);
-			(yyval.select_stmt)->unionSelect = (yyvsp[-2].select_stmt);
-			(yyval.select_stmt)->order = (yyvsp[-1].order_vec);
+  case 78: /* select_no_paren: set_operation opt_order opt_limit  */
+#line 681 "bison_parser.y"
+                                                  {
+			(yyval.select_stmt) = (yyvsp[-2].select_stmt);
+			(yyval.select_stmt)->setOperation->order = (yyvsp[-1].order_vec);
+			(yyval.select_stmt)->setOperation->limit = (yyvsp[0].limit);
+		}
+#line 3333 "bison_parser.cpp"
+    break;
 
-			// Limit could have been set by TOP.
-			if ((yyvsp[0].limit) != nullptr) {
-				delete (yyval.select_stmt)->limit;
-				(yyval.select_stmt)->limit = (yyvsp[0].limit);
-			}
+  case 79: /* set_operation: select_clause set_type opt_all select_paren_or_clause  */
+#line 691 "bison_parser.y"
+                                                                      {
+			(yyval.select_stmt) = (yyvsp[-3].select_stmt);
+			addSetBranch((yyval.select_stmt), (yyvsp[-2].set_type_t), (yyvsp[-1].bval), (yyvsp[0].select_stmt));
 		}
-#line 3045 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3342 "bison_parser.cpp"
     break;
 
-  case 74:
-#line 629 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 80: /* set_operation: set_operation set_type opt_all select_paren_or_clause  */
+#line 695 "bison_parser.y"
+                                                                      {
+			(yyval.select_stmt) = (yyvsp[-3].select_stmt);
+			addSetBranch((yyval.select_stmt), (yyvsp[-2].set_type_t), (yyvsp[-1].bval), (yyvsp[0].select_stmt));
+		}
+#line 3351 "bison_parser.cpp"
+    break;
+
+  case 81: /* paren_set_operation: select_with_paren set_type opt_all select_paren_or_clause  */
+#line 704 "bison_parser.y"
+                                                                          {
+			(yyval.select_stmt) = beginSetOperation((yyvsp[-3].select_stmt), (yyvsp[-2].set_type_t));
+			addSetBranch((yyval.select_stmt), (yyvsp[-2].set_type_t), (yyvsp[-1].bval), (yyvsp[0].select_stmt));
+		}
+#line 3360 "bison_parser.cpp"
+    break;
+
+  case 82: /* paren_set_operation: paren_set_operation set_type opt_all select_paren_or_clause  */
+#line 708 "bison_parser.y"
+                                                                            {
+			(yyval.select_stmt) = (yyvsp[-3].select_stmt);
+			addSetBranch((yyval.select_stmt), (yyvsp[-2].set_type_t), (yyvsp[-1].bval), (yyvsp[0].select_stmt));
+		}
+#line 3369 "bison_parser.cpp"
+    break;
+
+  case 83: /* set_type: UNION  */
+#line 715 "bison_parser.y"
+                      { (yyval.set_type_t) = kSetUnion; }
+#line 3375 "bison_parser.cpp"
+    break;
+
+  case 84: /* set_type: INTERSECT  */
+#line 716 "bison_parser.y"
+                          { (yyval.set_type_t) = kSetIntersect; }
+#line 3381 "bison_parser.cpp"
+    break;
+
+  case 85: /* set_type: EXCEPT  */
+#line 717 "bison_parser.y"
+                       { (yyval.set_type_t) = kSetExcept; }
+#line 3387 "bison_parser.cpp"
+    break;
+
+  case 86: /* opt_all: ALL  */
+#line 721 "bison_parser.y"
+                    { (yyval.bval) = true; }
+#line 3393 "bison_parser.cpp"
+    break;
+
+  case 87: /* opt_all: %empty  */
+#line 722 "bison_parser.y"
+                            { (yyval.bval) = false; }
+#line 3399 "bison_parser.cpp"
+    break;
+
+  case 88: /* select_clause: SELECT opt_top opt_distinct select_list from_clause opt_where opt_group  */
+#line 726 "bison_parser.y"
+                                                                                        {
 			(yyval.select_stmt) = new SelectStatement();
 			(yyval.select_stmt)->limit = (yyvsp[-5].limit);
 			(yyval.select_stmt)->selectDistinct = (yyvsp[-4].bval);
@@ -3055,559 +3409,594 @@ yyreduce:
 			(yyval.select_stmt)->whereClause = (yyvsp[-1].expr);
 			(yyval.select_stmt)->groupBy = (yyvsp[0].group_t);
 		}
-#line 3059 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3413 "bison_parser.cpp"
     break;
 
-  case 75:
-#line 641 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = true; }
-#line 3065 "bison_parser.cpp" /* yacc.c:1646  */
+  case 89: /* opt_distinct: DISTINCT  */
+#line 738 "bison_parser.y"
+                         { (yyval.bval) = true; }
+#line 3419 "bison_parser.cpp"
     break;
 
-  case 76:
-#line 642 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.bval) = false; }
-#line 3071 "bison_parser.cpp" /* yacc.c:1646  */
+  case 90: /* opt_distinct: %empty  */
+#line 739 "bison_parser.y"
+                            { (yyval.bval) = false; }
+#line 3425 "bison_parser.cpp"
     break;
 
-  case 78:
-#line 650 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.table) = (yyvsp[0].table); }
-#line 3077 "bison_parser.cpp" /* yacc.c:1646  */
+  case 92: /* from_clause: FROM table_ref  */
+#line 747 "bison_parser.y"
+                               { (yyval.table) = (yyvsp[0].table); }
+#line 3431 "bison_parser.cpp"
     break;
 
-  case 79:
-#line 655 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[0].expr); }
-#line 3083 "bison_parser.cpp" /* yacc.c:1646  */
+  case 93: /* opt_where: WHERE expr  */
+#line 752 "bison_parser.y"
+                           { (yyval.expr) = (yyvsp[0].expr); }
+#line 3437 "bison_parser.cpp"
     break;
 
-  case 80:
-#line 656 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = nullptr; }
-#line 3089 "bison_parser.cpp" /* yacc.c:1646  */
+  case 94: /* opt_where: %empty  */
+#line 753 "bison_parser.y"
+                            { (yyval.expr) = nullptr; }
+#line 3443 "bison_parser.cpp"
     break;
 
-  case 81:
-#line 660 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 95: /* opt_group: GROUP BY expr_list opt_having  */
+#line 757 "bison_parser.y"
+                                              {
 			(yyval.group_t) = new GroupByDescription();
 			(yyval.group_t)->columns = (yyvsp[-1].expr_vec);
 			(yyval.group_t)->having = (yyvsp[0].expr);
 		}
-#line 3099 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3453 "bison_parser.cpp"
     break;
 
-  case 82:
-#line 665 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.group_t) = nullptr; }
-#line 3105 "bison_parser.cpp" /* yacc.c:1646  */
+  case 96: /* opt_group: %empty  */
+#line 762 "bison_parser.y"
+                            { (yyval.group_t) = nullptr; }
+#line 3459 "bison_parser.cpp"
     break;
 
-  case 83:
-#line 669 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[0].expr); }
-#line 3111 "bison_parser.cpp" /* yacc.c:1646  */
+  case 97: /* opt_having: HAVING expr  */
+#line 766 "bison_parser.y"
+                            { (yyval.expr) = (yyvsp[0].expr); }
+#line 3465 "bison_parser.cpp"
     break;
 
-  case 84:
-#line 670 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = nullptr; }
-#line 3117 "bison_parser.cpp" /* yacc.c:1646  */
+  case 98: /* opt_having: %empty  */
+#line 767 "bison_parser.y"
+                            { (yyval.expr) = nullptr; }
+#line 3471 "bison_parser.cpp"
     break;
 
-  case 85:
-#line 673 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_vec) = (yyvsp[0].order_vec); }
-#line 3123 "bison_parser.cpp" /* yacc.c:1646  */
+  case 99: /* opt_order: ORDER BY order_list  */
+#line 770 "bison_parser.y"
+                                    { (yyval.order_vec) = (yyvsp[0].order_vec); }
+#line 3477 "bison_parser.cpp"
     break;
 
-  case 86:
-#line 674 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_vec) = nullptr; }
-#line 3129 "bison_parser.cpp" /* yacc.c:1646  */
+  case 100: /* opt_order: %empty  */
+#line 771 "bison_parser.y"
+                            { (yyval.order_vec) = nullptr; }
+#line 3483 "bison_parser.cpp"
     break;
 
-  case 87:
-#line 678 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_vec) = new std::vector<OrderDescription*>(); (yyval.order_vec)->push_back((yyvsp[0].order)); }
-#line 3135 "bison_parser.cpp" /* yacc.c:1646  */
+  case 101: /* order_list: order_desc  */
+#line 775 "bison_parser.y"
+                           { (yyval.order_vec) = newVector<OrderDescription*>(); (yyval.order_vec)->push_back((yyvsp[0].order)); }
+#line 3489 "bison_parser.cpp"
     break;
 
-  case 88:
-#line 679 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].order_vec)->push_back((yyvsp[0].order)); (yyval.order_vec) = (yyvsp[-2].order_vec); }
-#line 3141 "bison_parser.cpp" /* yacc.c:1646  */
+  case 102: /* order_list: order_list ',' order_desc  */
+#line 776 "bison_parser.y"
+                                          { (yyvsp[-2].order_vec)->push_back((yyvsp[0].order)); (yyval.order_vec) = (yyvsp[-2].order_vec); }
+#line 3495 "bison_parser.cpp"
     break;
 
-  case 89:
-#line 683 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order) = new OrderDescription((yyvsp[0].order_type), (yyvsp[-1].expr)); }
-#line 3147 "bison_parser.cpp" /* yacc.c:1646  */
+  case 103: /* order_desc: expr opt_order_type  */
+#line 780 "bison_parser.y"
+                                    { (yyval.order) = new OrderDescription((yyvsp[0].order_type), (yyvsp[-1].expr)); }
+#line 3501 "bison_parser.cpp"
     break;
 
-  case 90:
-#line 687 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_type) = kOrderAsc; }
-#line 3153 "bison_parser.cpp" /* yacc.c:1646  */
+  case 104: /* opt_order_type: ASC  */
+#line 784 "bison_parser.y"
+                    { (yyval.order_type) = kOrderAsc; }
+#line 3507 "bison_parser.cpp"
     break;
 
-  case 91:
-#line 688 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_type) = kOrderDesc; }
-#line 3159 "bison_parser.cpp" /* yacc.c:1646  */
+  case 105: /* opt_order_type: DESC  */
+#line 785 "bison_parser.y"
+                     { (yyval.order_type) = kOrderDesc; }
+#line 3513 "bison_parser.cpp"
     break;
 
-  case 92:
-#line 689 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.order_type) = kOrderAsc; }
-#line 3165 "bison_parser.cpp" /* yacc.c:1646  */
+  case 106: /* opt_order_type: %empty  */
+#line 786 "bison_parser.y"
+                            { (yyval.order_type) = kOrderAsc; }
+#line 3519 "bison_parser.cpp"
     break;
 
-  case 93:
-#line 695 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.limit) = new LimitDescription((yyvsp[0].expr)->ival, kNoOffset); delete (yyvsp[0].expr); }
-#line 3171 "bison_parser.cpp" /* yacc.c:1646  */
+  case 107: /* opt_top: TOP int_literal  */
+#line 792 "bison_parser.y"
+                                { (yyval.limit) = new LimitDescription((yyvsp[0].expr)->ival, kNoOffset); delete (yyvsp[0].expr); }
+#line 3525 "bison_parser.cpp"
     break;
 
-  case 94:
-#line 696 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.limit) = nullptr; }
-#line 3177 "bison_parser.cpp" /* yacc.c:1646  */
+  case 108: /* opt_top: %empty  */
+#line 793 "bison_parser.y"
+                            { (yyval.limit) = nullptr; }
+#line 3531 "bison_parser.cpp"
     break;
 
-  case 95:
-#line 700 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.limit) = new LimitDescription((yyvsp[0].expr)->ival, kNoOffset); delete (yyvsp[0].expr); }
-#line 3183 "bison_parser.cpp" /* yacc.c:1646  */
+  case 109: /* opt_limit: LIMIT int_literal  */
+#line 797 "bison_parser.y"
+                                  { (yyval.limit) = new LimitDescription((yyvsp[0].expr)->ival, kNoOffset); delete (yyvsp[0].expr); }
+#line 3537 "bison_parser.cpp"
     break;
 
-  case 96:
-#line 701 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.limit) = new LimitDescription((yyvsp[-2].expr)->ival, (yyvsp[0].expr)->ival); delete (yyvsp[-2].expr); delete (yyvsp[0].expr); }
-#line 3189 "bison_parser.cpp" /* yacc.c:1646  */
+  case 110: /* opt_limit: LIMIT int_literal OFFSET int_literal  */
+#line 798 "bison_parser.y"
+                                                     { (yyval.limit) = new LimitDescription((yyvsp[-2].expr)->ival, (yyvsp[0].expr)->ival); delete (yyvsp[-2].expr); delete (yyvsp[0].expr); }
+#line 3543 "bison_parser.cpp"
     break;
 
-  case 97:
-#line 702 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.limit) = nullptr; }
-#line 3195 "bison_parser.cpp" /* yacc.c:1646  */
+  case 111: /* opt_limit: %empty  */
+#line 799 "bison_parser.y"
+                            { (yyval.limit) = nullptr; }
+#line 3549 "bison_parser.cpp"
     break;
 
-  case 98:
-#line 709 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr_vec) = new std::vector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
-#line 3201 "bison_parser.cpp" /* yacc.c:1646  */
+  case 112: /* expr_list: expr_alias  */
+#line 806 "bison_parser.y"
+                           { (yyval.expr_vec) = newVector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
+#line 3555 "bison_parser.cpp"
     break;
 
-  case 99:
-#line 710 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
-#line 3207 "bison_parser.cpp" /* yacc.c:1646  */
+  case 113: /* expr_list: expr_list ',' expr_alias  */
+#line 807 "bison_parser.y"
+                                         { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
+#line 3561 "bison_parser.cpp"
     break;
 
-  case 100:
-#line 714 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr_vec) = new std::vector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
-#line 3213 "bison_parser.cpp" /* yacc.c:1646  */
+  case 114: /* literal_list: literal  */
+#line 811 "bison_parser.y"
+                        { (yyval.expr_vec) = newVector<Expr*>(); (yyval.expr_vec)->push_back((yyvsp[0].expr)); }
+#line 3567 "bison_parser.cpp"
     break;
 
-  case 101:
-#line 715 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
-#line 3219 "bison_parser.cpp" /* yacc.c:1646  */
+  case 115: /* literal_list: literal_list ',' literal  */
+#line 812 "bison_parser.y"
+                                         { (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr)); (yyval.expr_vec) = (yyvsp[-2].expr_vec); }
+#line 3573 "bison_parser.cpp"
     break;
 
-  case 102:
-#line 719 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 116: /* expr_alias: expr opt_alias  */
+#line 816 "bison_parser.y"
+                               {
 			(yyval.expr) = (yyvsp[-1].expr);
 			(yyval.expr)->alias = (yyvsp[0].sval);
 		}
-#line 3228 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3582 "bison_parser.cpp"
     break;
 
-  case 108:
-#line 734 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[-1].expr); }
-#line 3234 "bison_parser.cpp" /* yacc.c:1646  */
+  case 122: /* operand: '(' expr ')'  */
+#line 831 "bison_parser.y"
+                             { (yyval.expr) = (yyvsp[-1].expr); }
+#line 3588 "bison_parser.cpp"
     break;
 
-  case 116:
-#line 742 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeSelect((yyvsp[-1].select_stmt)); }
-#line 3240 "bison_parser.cpp" /* yacc.c:1646  */
+  case 130: /* operand: '(' select_no_paren ')'  */
+#line 839 "bison_parser.y"
+                                        { (yyval.expr) = Expr::makeSelect((yyvsp[-1].select_stmt)); }
+#line 3594 "bison_parser.cpp"
     break;
 
-  case 119:
-#line 751 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpUnaryMinus, (yyvsp[0].expr)); }
-#line 3246 "bison_parser.cpp" /* yacc.c:1646  */
+  case 133: /* unary_expr: '-' operand  */
+#line 848 "bison_parser.y"
+                            { (yyval.expr) = Expr::makeOpUnary(kOpUnaryMinus, (yyvsp[0].expr)); }
+#line 3600 "bison_parser.cpp"
     break;
 
-  case 120:
-#line 752 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpNot, (yyvsp[0].expr)); }
-#line 3252 "bison_parser.cpp" /* yacc.c:1646  */
+  case 134: /* unary_expr: NOT operand  */
+#line 849 "bison_parser.y"
+                            { (yyval.expr) = Expr::makeOpUnary(kOpNot, (yyvsp[0].expr)); }
+#line 3606 "bison_parser.cpp"
     break;
 
-  case 121:
-#line 753 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-1].expr)); }
-#line 3258 "bison_parser.cpp" /* yacc.c:1646  */
+  case 135: /* unary_expr: operand ISNULL  */
+#line 850 "bison_parser.y"
+                               { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-1].expr)); }
+#line 3612 "bison_parser.cpp"
     break;
 
-  case 122:
-#line 754 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-2].expr)); }
-#line 3264 "bison_parser.cpp" /* yacc.c:1646  */
+  case 136: /* unary_expr: operand IS NULL  */
+#line 851 "bison_parser.y"
+                                { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-2].expr)); }
+#line 3618 "bison_parser.cpp"
     break;
 
-  case 123:
-#line 755 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeOpUnary(kOpIsNull, (yyvsp[-3].expr))); }
-#line 3270 "bison_parser.cpp" /* yacc.c:1646  */
+  case 137: /* unary_expr: operand IS NOT NULL  */
+#line 852 "bison_parser.y"
+                                    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeOpUnary(kOpIsNull, (yyvsp[-3].expr))); }
+#line 3624 "bison_parser.cpp"
     break;
 
-  case 125:
-#line 760 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpMinus, (yyvsp[0].expr)); }
-#line 3276 "bison_parser.cpp" /* yacc.c:1646  */
+  case 139: /* binary_expr: operand '-' operand  */
+#line 857 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpMinus, (yyvsp[0].expr)); }
+#line 3630 "bison_parser.cpp"
     break;
 
-  case 126:
-#line 761 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPlus, (yyvsp[0].expr)); }
-#line 3282 "bison_parser.cpp" /* yacc.c:1646  */
+  case 140: /* binary_expr: operand '+' operand  */
+#line 858 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPlus, (yyvsp[0].expr)); }
+#line 3636 "bison_parser.cpp"
     break;
 
-  case 127:
-#line 762 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpSlash, (yyvsp[0].expr)); }
-#line 3288 "bison_parser.cpp" /* yacc.c:1646  */
+  case 141: /* binary_expr: operand '/' operand  */
+#line 859 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpSlash, (yyvsp[0].expr)); }
+#line 3642 "bison_parser.cpp"
     break;
 
-  case 128:
-#line 763 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAsterisk, (yyvsp[0].expr)); }
-#line 3294 "bison_parser.cpp" /* yacc.c:1646  */
+  case 142: /* binary_expr: operand '*' operand  */
+#line 860 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAsterisk, (yyvsp[0].expr)); }
+#line 3648 "bison_parser.cpp"
     break;
 
-  case 129:
-#line 764 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPercentage, (yyvsp[0].expr)); }
-#line 3300 "bison_parser.cpp" /* yacc.c:1646  */
+  case 143: /* binary_expr: operand '%' operand  */
+#line 861 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPercentage, (yyvsp[0].expr)); }
+#line 3654 "bison_parser.cpp"
     break;
 
-  case 130:
-#line 765 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpCaret, (yyvsp[0].expr)); }
-#line 3306 "bison_parser.cpp" /* yacc.c:1646  */
+  case 144: /* binary_expr: operand '^' operand  */
+#line 862 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpCaret, (yyvsp[0].expr)); }
+#line 3660 "bison_parser.cpp"
     break;
 
-  case 131:
-#line 766 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLike, (yyvsp[0].expr)); }
-#line 3312 "bison_parser.cpp" /* yacc.c:1646  */
+  case 145: /* binary_expr: operand LIKE operand  */
+#line 863 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLike, (yyvsp[0].expr)); }
+#line 3666 "bison_parser.cpp"
     break;
 
-  case 132:
-#line 767 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-3].expr), kOpNotLike, (yyvsp[0].expr)); }
-#line 3318 "bison_parser.cpp" /* yacc.c:1646  */
+  case 146: /* binary_expr: operand NOT LIKE operand  */
+#line 864 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-3].expr), kOpNotLike, (yyvsp[0].expr)); }
+#line 3672 "bison_parser.cpp"
     break;
 
-  case 133:
-#line 768 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpILike, (yyvsp[0].expr)); }
-#line 3324 "bison_parser.cpp" /* yacc.c:1646  */
+  case 147: /* binary_expr: operand ILIKE operand  */
+#line 865 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpILike, (yyvsp[0].expr)); }
+#line 3678 "bison_parser.cpp"
     break;
 
-  case 134:
-#line 769 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpConcat, (yyvsp[0].expr)); }
-#line 3330 "bison_parser.cpp" /* yacc.c:1646  */
+  case 148: /* binary_expr: operand CONCAT operand  */
+#line 866 "bison_parser.y"
+                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpConcat, (yyvsp[0].expr)); }
+#line 3684 "bison_parser.cpp"
     break;
 
-  case 135:
-#line 773 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAnd, (yyvsp[0].expr)); }
-#line 3336 "bison_parser.cpp" /* yacc.c:1646  */
+  case 149: /* logic_expr: expr AND expr  */
+#line 870 "bison_parser.y"
+                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAnd, (yyvsp[0].expr)); }
+#line 3690 "bison_parser.cpp"
     break;
 
-  case 136:
-#line 774 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpOr, (yyvsp[0].expr)); }
-#line 3342 "bison_parser.cpp" /* yacc.c:1646  */
+  case 150: /* logic_expr: expr OR expr  */
+#line 871 "bison_parser.y"
+                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpOr, (yyvsp[0].expr)); }
+#line 3696 "bison_parser.cpp"
     break;
 
-  case 137:
-#line 778 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].expr_vec)); }
-#line 3348 "bison_parser.cpp" /* yacc.c:1646  */
+  case 151: /* in_expr: operand IN '(' in_list ')'  */
+#line 875 "bison_parser.y"
+                                                                { (yyval.expr) = (yyvsp[-1].expr); (yyval.expr)->expr = (yyvsp[-4].expr); }
+#line 3702 "bison_parser.cpp"
     break;
 
-  case 138:
-#line 779 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].expr_vec))); }
-#line 3354 "bison_parser.cpp" /* yacc.c:1646  */
+  case 152: /* in_expr: operand NOT IN '(' in_list ')'  */
+#line 876 "bison_parser.y"
+                                                        { (yyvsp[-1].expr)->expr = (yyvsp[-5].expr); (yyval.expr) = Expr::makeOpUnary(kOpNot, (yyvsp[-1].expr)); }
+#line 3708 "bison_parser.cpp"
     break;
 
-  case 139:
-#line 780 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].select_stmt)); }
-#line 3360 "bison_parser.cpp" /* yacc.c:1646  */
+  case 153: /* in_expr: operand IN '(' select_no_paren ')'  */
+#line 877 "bison_parser.y"
+                                                                { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].select_stmt)); }
+#line 3714 "bison_parser.cpp"
     break;
 
-  case 140:
-#line 781 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].select_stmt))); }
-#line 3366 "bison_parser.cpp" /* yacc.c:1646  */
+  case 154: /* in_expr: operand NOT IN '(' select_no_paren ')'  */
+#line 878 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].select_stmt))); }
+#line 3720 "bison_parser.cpp"
     break;
 
-  case 141:
-#line 786 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeCase((yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 3372 "bison_parser.cpp" /* yacc.c:1646  */
+  case 155: /* in_list: expr_alias  */
+#line 884 "bison_parser.y"
+                           { (yyval.expr) = Expr::makeInOperator(nullptr); (yyval.expr)->addInValue((yyvsp[0].expr)); }
+#line 3726 "bison_parser.cpp"
     break;
 
-  case 142:
-#line 788 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeCase((yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 3378 "bison_parser.cpp" /* yacc.c:1646  */
+  case 156: /* in_list: in_list ',' expr_alias  */
+#line 885 "bison_parser.y"
+                                       { (yyval.expr) = (yyvsp[-2].expr); (yyval.expr)->addInValue((yyvsp[0].expr)); }
+#line 3732 "bison_parser.cpp"
     break;
 
-  case 143:
-#line 792 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeExists((yyvsp[-1].select_stmt)); }
-#line 3384 "bison_parser.cpp" /* yacc.c:1646  */
+  case 157: /* case_expr: CASE WHEN expr THEN operand END  */
+#line 890 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeCase((yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 3738 "bison_parser.cpp"
     break;
 
-  case 144:
-#line 793 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeExists((yyvsp[-1].select_stmt))); }
-#line 3390 "bison_parser.cpp" /* yacc.c:1646  */
+  case 158: /* case_expr: CASE WHEN expr THEN operand ELSE operand END  */
+#line 892 "bison_parser.y"
+                                                             { (yyval.expr) = Expr::makeCase((yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 3744 "bison_parser.cpp"
     break;
 
-  case 145:
-#line 797 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
-#line 3396 "bison_parser.cpp" /* yacc.c:1646  */
+  case 159: /* exists_expr: EXISTS '(' select_no_paren ')'  */
+#line 896 "bison_parser.y"
+                                               { (yyval.expr) = Expr::makeExists((yyvsp[-1].select_stmt)); }
+#line 3750 "bison_parser.cpp"
     break;
 
-  case 146:
-#line 798 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpNotEquals, (yyvsp[0].expr)); }
-#line 3402 "bison_parser.cpp" /* yacc.c:1646  */
+  case 160: /* exists_expr: NOT EXISTS '(' select_no_paren ')'  */
+#line 897 "bison_parser.y"
+                                                   { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeExists((yyvsp[-1].select_stmt))); }
+#line 3756 "bison_parser.cpp"
     break;
 
-  case 147:
-#line 799 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLess, (yyvsp[0].expr)); }
-#line 3408 "bison_parser.cpp" /* yacc.c:1646  */
+  case 161: /* comp_expr: operand '=' operand  */
+#line 901 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
+#line 3762 "bison_parser.cpp"
     break;
 
-  case 148:
-#line 800 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreater, (yyvsp[0].expr)); }
-#line 3414 "bison_parser.cpp" /* yacc.c:1646  */
+  case 162: /* comp_expr: operand NOTEQUALS operand  */
+#line 902 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpNotEquals, (yyvsp[0].expr)); }
+#line 3768 "bison_parser.cpp"
     break;
 
-  case 149:
-#line 801 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLessEq, (yyvsp[0].expr)); }
-#line 3420 "bison_parser.cpp" /* yacc.c:1646  */
+  case 163: /* comp_expr: operand '<' operand  */
+#line 903 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLess, (yyvsp[0].expr)); }
+#line 3774 "bison_parser.cpp"
     break;
 
-  case 150:
-#line 802 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreaterEq, (yyvsp[0].expr)); }
-#line 3426 "bison_parser.cpp" /* yacc.c:1646  */
+  case 164: /* comp_expr: operand '>' operand  */
+#line 904 "bison_parser.y"
+                                                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreater, (yyvsp[0].expr)); }
+#line 3780 "bison_parser.cpp"
     break;
 
-  case 151:
-#line 806 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-2].sval), new std::vector<Expr*>(), false); }
-#line 3432 "bison_parser.cpp" /* yacc.c:1646  */
+  case 165: /* comp_expr: operand LESSEQ operand  */
+#line 905 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLessEq, (yyvsp[0].expr)); }
+#line 3786 "bison_parser.cpp"
     break;
 
-  case 152:
-#line 807 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-4].sval), (yyvsp[-1].expr_vec), (yyvsp[-2].bval)); }
-#line 3438 "bison_parser.cpp" /* yacc.c:1646  */
+  case 166: /* comp_expr: operand GREATEREQ operand  */
+#line 906 "bison_parser.y"
+                                                { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreaterEq, (yyvsp[0].expr)); }
+#line 3792 "bison_parser.cpp"
     break;
 
-  case 153:
-#line 811 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeArray((yyvsp[-1].expr_vec)); }
-#line 3444 "bison_parser.cpp" /* yacc.c:1646  */
+  case 167: /* function_expr: IDENTIFIER '(' ')'  */
+#line 910 "bison_parser.y"
+                                   { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-2].sval), newVector<Expr*>(), false); }
+#line 3798 "bison_parser.cpp"
     break;
 
-  case 154:
-#line 815 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeArrayIndex((yyvsp[-3].expr), (yyvsp[-1].expr)->ival); }
-#line 3450 "bison_parser.cpp" /* yacc.c:1646  */
+  case 168: /* function_expr: IDENTIFIER '(' opt_distinct expr_list ')'  */
+#line 911 "bison_parser.y"
+                                                          { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-4].sval), (yyvsp[-1].expr_vec), (yyvsp[-2].bval)); }
+#line 3804 "bison_parser.cpp"
     break;
 
-  case 155:
-#line 819 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeBetween((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3456 "bison_parser.cpp" /* yacc.c:1646  */
+  case 169: /* array_expr: ARRAY '[' expr_list ']'  */
+#line 915 "bison_parser.y"
+                                        { (yyval.expr) = Expr::makeArray((yyvsp[-1].expr_vec)); }
+#line 3810 "bison_parser.cpp"
     break;
 
-  case 156:
-#line 823 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeColumnRef((yyvsp[0].sval)); }
-#line 3462 "bison_parser.cpp" /* yacc.c:1646  */
+  case 170: /* array_index: operand '[' int_literal ']'  */
+#line 919 "bison_parser.y"
+                                            { (yyval.expr) = Expr::makeArrayIndex((yyvsp[-3].expr), (yyvsp[-1].expr)->ival); delete (yyvsp[-1].expr); }
+#line 3816 "bison_parser.cpp"
     break;
 
-  case 157:
-#line 824 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeColumnRef((yyvsp[-2].sval), (yyvsp[0].sval)); }
-#line 3468 "bison_parser.cpp" /* yacc.c:1646  */
+  case 171: /* between_expr: operand BETWEEN operand AND operand  */
+#line 923 "bison_parser.y"
+                                                    { (yyval.expr) = Expr::makeBetween((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 3822 "bison_parser.cpp"
     break;
 
-  case 158:
-#line 825 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeStar(); }
-#line 3474 "bison_parser.cpp" /* yacc.c:1646  */
+  case 172: /* column_name: IDENTIFIER  */
+#line 927 "bison_parser.y"
+                           { (yyval.expr) = Expr::makeColumnRef((yyvsp[0].sval)); }
+#line 3828 "bison_parser.cpp"
     break;
 
-  case 159:
-#line 826 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeStar((yyvsp[-2].sval)); }
-#line 3480 "bison_parser.cpp" /* yacc.c:1646  */
+  case 173: /* column_name: IDENTIFIER '.' IDENTIFIER  */
+#line 928 "bison_parser.y"
+                                          { (yyval.expr) = Expr::makeColumnRef((yyvsp[-2].sval), (yyvsp[0].sval)); }
+#line 3834 "bison_parser.cpp"
     break;
 
-  case 164:
-#line 837 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeLiteral((yyvsp[0].sval)); }
-#line 3486 "bison_parser.cpp" /* yacc.c:1646  */
+  case 174: /* column_name: '*'  */
+#line 929 "bison_parser.y"
+                    { (yyval.expr) = Expr::makeStar(); }
+#line 3840 "bison_parser.cpp"
     break;
 
-  case 165:
-#line 842 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeLiteral((yyvsp[0].fval)); }
-#line 3492 "bison_parser.cpp" /* yacc.c:1646  */
+  case 175: /* column_name: IDENTIFIER '.' '*'  */
+#line 930 "bison_parser.y"
+                                   { (yyval.expr) = Expr::makeStar((yyvsp[-2].sval)); }
+#line 3846 "bison_parser.cpp"
     break;
 
-  case 167:
-#line 847 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeLiteral((yyvsp[0].ival)); }
-#line 3498 "bison_parser.cpp" /* yacc.c:1646  */
+  case 180: /* string_literal: STRING  */
+#line 941 "bison_parser.y"
+                       { (yyval.expr) = Expr::makeLiteral((yyvsp[0].sval)); }
+#line 3852 "bison_parser.cpp"
     break;
 
-  case 168:
-#line 851 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = Expr::makeNullLiteral(); }
-#line 3504 "bison_parser.cpp" /* yacc.c:1646  */
+  case 181: /* num_literal: FLOATVAL  */
+#line 946 "bison_parser.y"
+                         { (yyval.expr) = Expr::makeLiteral((yyvsp[0].fval)); }
+#line 3858 "bison_parser.cpp"
     break;
 
-  case 169:
-#line 855 "bison_parser.y" /* yacc.c:1646  */
-    {
-			(yyval.expr) = Expr::makeParameter(yylloc.total_column);
-			(yyval.expr)->ival2 = yyloc.param_list.size();
-			yyloc.param_list.push_back((yyval.expr));
+  case 183: /* int_literal: INTVAL  */
+#line 951 "bison_parser.y"
+                       { (yyval.expr) = Expr::makeLiteral((yyvsp[0].ival)); }
+#line 3864 "bison_parser.cpp"
+    break;
+
+  case 184: /* null_literal: NULL  */
+#line 955 "bison_parser.y"
+                     { (yyval.expr) = Expr::makeNullLiteral(); }
+#line 3870 "bison_parser.cpp"
+    break;
+
+  case 185: /* param_expr: '?'  */
+#line 959 "bison_parser.y"
+                    {
+			if (state->numbered_params) {
+				yyerror(&(yylsp[0]), result, scanner, state, "Numbered and unnumbered placeholders can not be mixed");
+				YYERROR;
+			}
+			(yyval.expr) = Expr::makeParameter(yylloc.last_offset);
+			(yyval.expr)->ival2 = state->param_list.size();
+			state->param_list.push_back((yyval.expr));
 		}
-#line 3514 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3884 "bison_parser.cpp"
     break;
 
-  case 171:
-#line 868 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 186: /* param_expr: '$' INTVAL  */
+#line 968 "bison_parser.y"
+                           {
+			if ((yylsp[-1]).last_offset != (yylsp[0]).first_offset || (yyvsp[0].ival) < 1 || (yyvsp[0].ival) > SQLParserResult::kMaxParameterNumber) {
+				yyerror(&(yyloc), result, scanner, state, "Invalid placeholder number");
+				YYERROR;
+			}
+			if (!state->param_list.empty() && !state->numbered_params) {
+				yyerror(&(yyloc), result, scanner, state, "Numbered and unnumbered placeholders can not be mixed");
+				YYERROR;
+			}
+			state->numbered_params = true;
+			(yyval.expr) = Expr::makeParameter((yyvsp[0].ival) - 1);
+			(yyval.expr)->ival2 = state->param_list.size();
+			state->param_list.push_back((yyval.expr));
+		}
+#line 3903 "bison_parser.cpp"
+    break;
+
+  case 188: /* table_ref: table_ref_atomic ',' table_ref_commalist  */
+#line 990 "bison_parser.y"
+                                                         {
 			(yyvsp[0].table_vec)->push_back((yyvsp[-2].table));
 			auto tbl = new TableRef(kTableCrossProduct);
 			tbl->list = (yyvsp[0].table_vec);
 			(yyval.table) = tbl;
 		}
-#line 3525 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3914 "bison_parser.cpp"
     break;
 
-  case 175:
-#line 884 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 192: /* nonjoin_table_ref_atomic: '(' select_statement ')' opt_alias  */
+#line 1006 "bison_parser.y"
+                                                   {
 			auto tbl = new TableRef(kTableSelect);
 			tbl->select = (yyvsp[-2].select_stmt);
 			tbl->alias = (yyvsp[0].sval);
 			(yyval.table) = tbl;
 		}
-#line 3536 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3925 "bison_parser.cpp"
     break;
 
-  case 176:
-#line 893 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.table_vec) = new std::vector<TableRef*>(); (yyval.table_vec)->push_back((yyvsp[0].table)); }
-#line 3542 "bison_parser.cpp" /* yacc.c:1646  */
+  case 193: /* table_ref_commalist: table_ref_atomic  */
+#line 1015 "bison_parser.y"
+                                 { (yyval.table_vec) = newVector<TableRef*>(); (yyval.table_vec)->push_back((yyvsp[0].table)); }
+#line 3931 "bison_parser.cpp"
     break;
 
-  case 177:
-#line 894 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].table_vec)->push_back((yyvsp[0].table)); (yyval.table_vec) = (yyvsp[-2].table_vec); }
-#line 3548 "bison_parser.cpp" /* yacc.c:1646  */
+  case 194: /* table_ref_commalist: table_ref_commalist ',' table_ref_atomic  */
+#line 1016 "bison_parser.y"
+                                                         { (yyvsp[-2].table_vec)->push_back((yyvsp[0].table)); (yyval.table_vec) = (yyvsp[-2].table_vec); }
+#line 3937 "bison_parser.cpp"
     break;
 
-  case 178:
-#line 899 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 195: /* table_ref_name: table_name opt_alias  */
+#line 1021 "bison_parser.y"
+                                     {
 			auto tbl = new TableRef(kTableName);
 			tbl->schema = (yyvsp[-1].table_name).schema;
 			tbl->name = (yyvsp[-1].table_name).name;
 			tbl->alias = (yyvsp[0].sval);
 			(yyval.table) = tbl;
 		}
-#line 3560 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3949 "bison_parser.cpp"
     break;
 
-  case 179:
-#line 910 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 196: /* table_ref_name_no_alias: table_name  */
+#line 1032 "bison_parser.y"
+                           {
 			(yyval.table) = new TableRef(kTableName);
 			(yyval.table)->schema = (yyvsp[0].table_name).schema;
 			(yyval.table)->name = (yyvsp[0].table_name).name;
 		}
-#line 3570 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3959 "bison_parser.cpp"
     break;
 
-  case 180:
-#line 919 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.table_name).schema = nullptr; (yyval.table_name).name = (yyvsp[0].sval);}
-#line 3576 "bison_parser.cpp" /* yacc.c:1646  */
+  case 197: /* table_name: IDENTIFIER  */
+#line 1041 "bison_parser.y"
+                                          { (yyval.table_name).schema = nullptr; (yyval.table_name).name = (yyvsp[0].sval);}
+#line 3965 "bison_parser.cpp"
     break;
 
-  case 181:
-#line 920 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.table_name).schema = (yyvsp[-2].sval); (yyval.table_name).name = (yyvsp[0].sval); }
-#line 3582 "bison_parser.cpp" /* yacc.c:1646  */
+  case 198: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1042 "bison_parser.y"
+                                          { (yyval.table_name).schema = (yyvsp[-2].sval); (yyval.table_name).name = (yyvsp[0].sval); }
+#line 3971 "bison_parser.cpp"
     break;
 
-  case 182:
-#line 925 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.sval) = (yyvsp[0].sval); }
-#line 3588 "bison_parser.cpp" /* yacc.c:1646  */
+  case 199: /* alias: AS IDENTIFIER  */
+#line 1047 "bison_parser.y"
+                              { (yyval.sval) = (yyvsp[0].sval); }
+#line 3977 "bison_parser.cpp"
     break;
 
-  case 185:
-#line 931 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.sval) = nullptr; }
-#line 3594 "bison_parser.cpp" /* yacc.c:1646  */
+  case 202: /* opt_alias: %empty  */
+#line 1053 "bison_parser.y"
+                            { (yyval.sval) = nullptr; }
+#line 3983 "bison_parser.cpp"
     break;
 
-  case 186:
-#line 940 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 203: /* join_clause: table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic  */
+#line 1062 "bison_parser.y"
+                {
 			(yyval.table) = new TableRef(kTableJoin);
 			(yyval.table)->join = new JoinDefinition();
 			(yyval.table)->join->type = kJoinNatural;
 			(yyval.table)->join->left = (yyvsp[-3].table);
 			(yyval.table)->join->right = (yyvsp[0].table);
 		}
-#line 3606 "bison_parser.cpp" /* yacc.c:1646  */
+#line 3995 "bison_parser.cpp"
     break;
 
-  case 187:
-#line 948 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 204: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic ON join_condition  */
+#line 1070 "bison_parser.y"
+                {
 			(yyval.table) = new TableRef(kTableJoin);
 			(yyval.table)->join = new JoinDefinition();
 			(yyval.table)->join->type = (JoinType) (yyvsp[-4].uval);
@@ -3615,91 +4004,96 @@ yyreduce:
 			(yyval.table)->join->right = (yyvsp[-2].table);
 			(yyval.table)->join->condition = (yyvsp[0].expr);
 		}
-#line 3619 "bison_parser.cpp" /* yacc.c:1646  */
+#line 4008 "bison_parser.cpp"
     break;
 
-  case 188:
-#line 958 "bison_parser.y" /* yacc.c:1646  */
-    {
+  case 205: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic USING '(' column_name ')'  */
+#line 1080 "bison_parser.y"
+                {
 			(yyval.table) = new TableRef(kTableJoin);
 			(yyval.table)->join = new JoinDefinition();
 			(yyval.table)->join->type = (JoinType) (yyvsp[-6].uval);
 			(yyval.table)->join->left = (yyvsp[-7].table);
 			(yyval.table)->join->right = (yyvsp[-4].table);
-			auto left_col = Expr::makeColumnRef(strdup((yyvsp[-1].expr)->name));
-			if ((yyvsp[-1].expr)->alias != nullptr) left_col->alias = strdup((yyvsp[-1].expr)->alias);
-			if ((yyvsp[-7].table)->getName() != nullptr) left_col->table = strdup((yyvsp[-7].table)->getName());
-			auto right_col = Expr::makeColumnRef(strdup((yyvsp[-1].expr)->name));
-			if ((yyvsp[-1].expr)->alias != nullptr) right_col->alias = strdup((yyvsp[-1].expr)->alias);
-			if ((yyvsp[-4].table)->getName() != nullptr) right_col->table = strdup((yyvsp[-4].table)->getName());
+			// Token texts are only terminated after the scan, so both columns
+			// share the strings. They belong to the arena of the result.
+			auto left_col = Expr::makeColumnRef((yyvsp[-1].expr)->name);
+			left_col->alias = (yyvsp[-1].expr)->alias;
+			left_col->table = (char*) (yyvsp[-7].table)->getName();
+			auto right_col = Expr::makeColumnRef((yyvsp[-1].expr)->name);
+			right_col->alias = (yyvsp[-1].expr)->alias;
+			right_col->table = (char*) (yyvsp[-4].table)->getName();
+			(yyvsp[-1].expr)->name = nullptr;
+			(yyvsp[-1].expr)->alias = nullptr;
 			(yyval.table)->join->condition = Expr::makeOpBinary(left_col, kOpEquals, right_col);
 			delete (yyvsp[-1].expr);
 		}
-#line 3639 "bison_parser.cpp" /* yacc.c:1646  */
+#line 4032 "bison_parser.cpp"
     break;
 
-  case 189:
-#line 976 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinInner; }
-#line 3645 "bison_parser.cpp" /* yacc.c:1646  */
+  case 206: /* opt_join_type: INNER  */
+#line 1102 "bison_parser.y"
+                                { (yyval.uval) = kJoinInner; }
+#line 4038 "bison_parser.cpp"
     break;
 
-  case 190:
-#line 977 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinOuter; }
-#line 3651 "bison_parser.cpp" /* yacc.c:1646  */
+  case 207: /* opt_join_type: OUTER  */
+#line 1103 "bison_parser.y"
+                                { (yyval.uval) = kJoinOuter; }
+#line 4044 "bison_parser.cpp"
     break;
 
-  case 191:
-#line 978 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinLeftOuter; }
-#line 3657 "bison_parser.cpp" /* yacc.c:1646  */
+  case 208: /* opt_join_type: LEFT OUTER  */
+#line 1104 "bison_parser.y"
+                                { (yyval.uval) = kJoinLeftOuter; }
+#line 4050 "bison_parser.cpp"
     break;
 
-  case 192:
-#line 979 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinRightOuter; }
-#line 3663 "bison_parser.cpp" /* yacc.c:1646  */
+  case 209: /* opt_join_type: RIGHT OUTER  */
+#line 1105 "bison_parser.y"
+                                { (yyval.uval) = kJoinRightOuter; }
+#line 4056 "bison_parser.cpp"
     break;
 
-  case 193:
-#line 980 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinLeft; }
-#line 3669 "bison_parser.cpp" /* yacc.c:1646  */
+  case 210: /* opt_join_type: LEFT  */
+#line 1106 "bison_parser.y"
+                                { (yyval.uval) = kJoinLeft; }
+#line 4062 "bison_parser.cpp"
     break;
 
-  case 194:
-#line 981 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinRight; }
-#line 3675 "bison_parser.cpp" /* yacc.c:1646  */
+  case 211: /* opt_join_type: RIGHT  */
+#line 1107 "bison_parser.y"
+                                { (yyval.uval) = kJoinRight; }
+#line 4068 "bison_parser.cpp"
     break;
 
-  case 195:
-#line 982 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinCross; }
-#line 3681 "bison_parser.cpp" /* yacc.c:1646  */
+  case 212: /* opt_join_type: CROSS  */
+#line 1108 "bison_parser.y"
+                                { (yyval.uval) = kJoinCross; }
+#line 4074 "bison_parser.cpp"
     break;
 
-  case 196:
-#line 983 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.uval) = kJoinInner; }
-#line 3687 "bison_parser.cpp" /* yacc.c:1646  */
+  case 213: /* opt_join_type: %empty  */
+#line 1109 "bison_parser.y"
+                                        { (yyval.uval) = kJoinInner; }
+#line 4080 "bison_parser.cpp"
     break;
 
-  case 200:
-#line 1003 "bison_parser.y" /* yacc.c:1646  */
-    { (yyval.str_vec) = new std::vector<char*>(); (yyval.str_vec)->push_back((yyvsp[0].sval)); }
-#line 3693 "bison_parser.cpp" /* yacc.c:1646  */
+  case 217: /* ident_commalist: IDENTIFIER  */
+#line 1129 "bison_parser.y"
+                           { (yyval.str_vec) = newVector<char*>(); (yyval.str_vec)->push_back((yyvsp[0].sval)); }
+#line 4086 "bison_parser.cpp"
     break;
 
-  case 201:
-#line 1004 "bison_parser.y" /* yacc.c:1646  */
-    { (yyvsp[-2].str_vec)->push_back((yyvsp[0].sval)); (yyval.str_vec) = (yyvsp[-2].str_vec); }
-#line 3699 "bison_parser.cpp" /* yacc.c:1646  */
+  case 218: /* ident_commalist: ident_commalist ',' IDENTIFIER  */
+#line 1130 "bison_parser.y"
+                                               { (yyvsp[-2].str_vec)->push_back((yyvsp[0].sval)); (yyval.str_vec) = (yyvsp[-2].str_vec); }
+#line 4092 "bison_parser.cpp"
     break;
 
 
-#line 3703 "bison_parser.cpp" /* yacc.c:1646  */
+#line 4096 "bison_parser.cpp"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -3713,11 +4107,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -3725,14 +4118,13 @@ yyreduce:
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -3743,66 +4135,61 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == SQL_HSQL_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (&yylloc, result, scanner, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken, &yylloc};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
-        yyerror (&yylloc, result, scanner, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        yyerror (&yylloc, result, scanner, state, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
          error, discard it.  */
 
-      if (yychar <= YYEOF)
+      if (yychar <= SQL_YYEOF)
         {
           /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
+          if (yychar == SQL_YYEOF)
             YYABORT;
         }
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc, result, scanner);
-          yychar = YYEMPTY;
+                      yytoken, &yylval, &yylloc, result, scanner, state);
+          yychar = SQL_HSQL_EMPTY;
         }
     }
 
@@ -3815,14 +4202,12 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
@@ -3838,13 +4223,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -3858,7 +4244,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, result, scanner);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, result, scanner, state);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -3869,13 +4255,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3886,33 +4270,37 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (&yylloc, result, scanner, YY_("memory exhausted"));
+  yyerror (&yylloc, result, scanner, state, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEMPTY)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != SQL_HSQL_EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc, result, scanner);
+                  yytoken, &yylval, &yylloc, result, scanner, state);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -3921,20 +4309,19 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, result, scanner);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, result, scanner, state);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 1007 "bison_parser.y" /* yacc.c:1906  */
+
+#line 1133 "bison_parser.y"
 
 /*********************************
  ** Section 4: Additional C code
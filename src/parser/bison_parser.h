@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_HSQL_BISON_PARSER_H_INCLUDED
 # define YY_HSQL_BISON_PARSER_H_INCLUDED
 /* Debug traces.  */
@@ -48,7 +53,7 @@
 extern int hsql_debug;
 #endif
 /* "%code requires" blocks.  */
-#line 35 "bison_parser.y" /* yacc.c:1909  */
+#line 73 "bison_parser.y"
 
 // %code requires block
 
@@ -56,168 +61,173 @@ extern int hsql_debug;
 #include "../SQLParserResult.h"
 #include "parser_typedef.h"
 
-// Auto update column and line number
+// Only track byte offsets while scanning. The line and column of an error
+// are computed from the offset when the error is reported.
 #define YY_USER_ACTION \
-		yylloc->first_line = yylloc->last_line; \
-		yylloc->first_column = yylloc->last_column; \
-		for(int i = 0; yytext[i] != '\0'; i++) { \
-			yylloc->total_column++; \
-				if(yytext[i] == '\n') { \
-						yylloc->last_line++; \
-						yylloc->last_column = 0; \
-				} \
-				else { \
-						yylloc->last_column++; \
-				} \
-		}
+		yylloc->first_offset = yylloc->last_offset; \
+		yylloc->last_offset += yyleng;
+
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+		do { \
+			if (N) { \
+				(Current).first_offset = YYRHSLOC(Rhs, 1).first_offset; \
+				(Current).last_offset = YYRHSLOC(Rhs, N).last_offset; \
+			} else { \
+				(Current).first_offset = (Current).last_offset = YYRHSLOC(Rhs, 0).last_offset; \
+			} \
+		} while (0)
 
-#line 75 "bison_parser.h" /* yacc.c:1909  */
+#line 81 "bison_parser.h"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef HSQL_TOKENTYPE
 # define HSQL_TOKENTYPE
   enum hsql_tokentype
   {
-    SQL_IDENTIFIER = 258,
-    SQL_STRING = 259,
-    SQL_FLOATVAL = 260,
-    SQL_INTVAL = 261,
-    SQL_DEALLOCATE = 262,
-    SQL_PARAMETERS = 263,
-    SQL_INTERSECT = 264,
-    SQL_TEMPORARY = 265,
-    SQL_TIMESTAMP = 266,
-    SQL_DISTINCT = 267,
-    SQL_NVARCHAR = 268,
-    SQL_RESTRICT = 269,
-    SQL_TRUNCATE = 270,
-    SQL_ANALYZE = 271,
-    SQL_BETWEEN = 272,
-    SQL_CASCADE = 273,
-    SQL_COLUMNS = 274,
-    SQL_CONTROL = 275,
-    SQL_DEFAULT = 276,
-    SQL_EXECUTE = 277,
-    SQL_EXPLAIN = 278,
-    SQL_HISTORY = 279,
-    SQL_INTEGER = 280,
-    SQL_NATURAL = 281,
-    SQL_PREPARE = 282,
-    SQL_PRIMARY = 283,
-    SQL_SCHEMAS = 284,
-    SQL_SPATIAL = 285,
-    SQL_VIRTUAL = 286,
-    SQL_BEFORE = 287,
-    SQL_COLUMN = 288,
-    SQL_CREATE = 289,
-    SQL_DELETE = 290,
-    SQL_DIRECT = 291,
-    SQL_DOUBLE = 292,
-    SQL_ESCAPE = 293,
-    SQL_EXCEPT = 294,
-    SQL_EXISTS = 295,
-    SQL_GLOBAL = 296,
-    SQL_HAVING = 297,
-    SQL_IMPORT = 298,
-    SQL_INSERT = 299,
-    SQL_ISNULL = 300,
-    SQL_OFFSET = 301,
-    SQL_RENAME = 302,
-    SQL_SCHEMA = 303,
-    SQL_SELECT = 304,
-    SQL_SORTED = 305,
-    SQL_TABLES = 306,
-    SQL_UNIQUE = 307,
-    SQL_UNLOAD = 308,
-    SQL_UPDATE = 309,
-    SQL_VALUES = 310,
-    SQL_AFTER = 311,
-    SQL_ALTER = 312,
-    SQL_CROSS = 313,
-    SQL_DELTA = 314,
-    SQL_GROUP = 315,
-    SQL_INDEX = 316,
-    SQL_INNER = 317,
-    SQL_LIMIT = 318,
-    SQL_LOCAL = 319,
-    SQL_MERGE = 320,
-    SQL_MINUS = 321,
-    SQL_ORDER = 322,
-    SQL_OUTER = 323,
-    SQL_RIGHT = 324,
-    SQL_TABLE = 325,
-    SQL_UNION = 326,
-    SQL_USING = 327,
-    SQL_WHERE = 328,
-    SQL_CALL = 329,
-    SQL_CASE = 330,
-    SQL_DATE = 331,
-    SQL_DESC = 332,
-    SQL_DROP = 333,
-    SQL_ELSE = 334,
-    SQL_FILE = 335,
-    SQL_FROM = 336,
-    SQL_FULL = 337,
-    SQL_HASH = 338,
-    SQL_HINT = 339,
-    SQL_INTO = 340,
-    SQL_JOIN = 341,
-    SQL_LEFT = 342,
-    SQL_LIKE = 343,
-    SQL_LOAD = 344,
-    SQL_NULL = 345,
-    SQL_PART = 346,
-    SQL_PLAN = 347,
-    SQL_SHOW = 348,
-    SQL_TEXT = 349,
-    SQL_THEN = 350,
-    SQL_TIME = 351,
-    SQL_VIEW = 352,
-    SQL_WHEN = 353,
-    SQL_WITH = 354,
-    SQL_ADD = 355,
-    SQL_ALL = 356,
-    SQL_AND = 357,
-    SQL_ASC = 358,
-    SQL_CSV = 359,
-    SQL_END = 360,
-    SQL_FOR = 361,
-    SQL_INT = 362,
-    SQL_KEY = 363,
-    SQL_NOT = 364,
-    SQL_OFF = 365,
-    SQL_SET = 366,
-    SQL_TBL = 367,
-    SQL_TOP = 368,
-    SQL_AS = 369,
-    SQL_BY = 370,
-    SQL_IF = 371,
-    SQL_IN = 372,
-    SQL_IS = 373,
-    SQL_OF = 374,
-    SQL_ON = 375,
-    SQL_OR = 376,
-    SQL_TO = 377,
-    SQL_ARRAY = 378,
-    SQL_CONCAT = 379,
-    SQL_ILIKE = 380,
-    SQL_EQUALS = 381,
-    SQL_NOTEQUALS = 382,
-    SQL_LESS = 383,
-    SQL_GREATER = 384,
-    SQL_LESSEQ = 385,
-    SQL_GREATEREQ = 386,
-    SQL_NOTNULL = 387,
-    SQL_UMINUS = 388
+    SQL_HSQL_EMPTY = -2,
+    SQL_YYEOF = 0,                 /* "end of file"  */
+    SQL_HSQL_error = 256,          /* error  */
+    SQL_HSQL_UNDEF = 257,          /* "invalid token"  */
+    SQL_IDENTIFIER = 258,          /* IDENTIFIER  */
+    SQL_STRING = 259,              /* STRING  */
+    SQL_FLOATVAL = 260,            /* FLOATVAL  */
+    SQL_INTVAL = 261,              /* INTVAL  */
+    SQL_DEALLOCATE = 262,          /* DEALLOCATE  */
+    SQL_PARAMETERS = 263,          /* PARAMETERS  */
+    SQL_INTERSECT = 264,           /* INTERSECT  */
+    SQL_TEMPORARY = 265,           /* TEMPORARY  */
+    SQL_TIMESTAMP = 266,           /* TIMESTAMP  */
+    SQL_DISTINCT = 267,            /* DISTINCT  */
+    SQL_NVARCHAR = 268,            /* NVARCHAR  */
+    SQL_RESTRICT = 269,            /* RESTRICT  */
+    SQL_TRUNCATE = 270,            /* TRUNCATE  */
+    SQL_ANALYZE = 271,             /* ANALYZE  */
+    SQL_BETWEEN = 272,             /* BETWEEN  */
+    SQL_CASCADE = 273,             /* CASCADE  */
+    SQL_COLUMNS = 274,             /* COLUMNS  */
+    SQL_CONTROL = 275,             /* CONTROL  */
+    SQL_DEFAULT = 276,             /* DEFAULT  */
+    SQL_EXECUTE = 277,             /* EXECUTE  */
+    SQL_EXPLAIN = 278,             /* EXPLAIN  */
+    SQL_HISTORY = 279,             /* HISTORY  */
+    SQL_INTEGER = 280,             /* INTEGER  */
+    SQL_NATURAL = 281,             /* NATURAL  */
+    SQL_PREPARE = 282,             /* PREPARE  */
+    SQL_PRIMARY = 283,             /* PRIMARY  */
+    SQL_SCHEMAS = 284,             /* SCHEMAS  */
+    SQL_SPATIAL = 285,             /* SPATIAL  */
+    SQL_VIRTUAL = 286,             /* VIRTUAL  */
+    SQL_BEFORE = 287,              /* BEFORE  */
+    SQL_COLUMN = 288,              /* COLUMN  */
+    SQL_CREATE = 289,              /* CREATE  */
+    SQL_DELETE = 290,              /* DELETE  */
+    SQL_DIRECT = 291,              /* DIRECT  */
+    SQL_DOUBLE = 292,              /* DOUBLE  */
+    SQL_ESCAPE = 293,              /* ESCAPE  */
+    SQL_EXCEPT = 294,              /* EXCEPT  */
+    SQL_EXISTS = 295,              /* EXISTS  */
+    SQL_GLOBAL = 296,              /* GLOBAL  */
+    SQL_HAVING = 297,              /* HAVING  */
+    SQL_IMPORT = 298,              /* IMPORT  */
+    SQL_INSERT = 299,              /* INSERT  */
+    SQL_ISNULL = 300,              /* ISNULL  */
+    SQL_OFFSET = 301,              /* OFFSET  */
+    SQL_RENAME = 302,              /* RENAME  */
+    SQL_SCHEMA = 303,              /* SCHEMA  */
+    SQL_SELECT = 304,              /* SELECT  */
+    SQL_SORTED = 305,              /* SORTED  */
+    SQL_TABLES = 306,              /* TABLES  */
+    SQL_UNIQUE = 307,              /* UNIQUE  */
+    SQL_UNLOAD = 308,              /* UNLOAD  */
+    SQL_UPDATE = 309,              /* UPDATE  */
+    SQL_VALUES = 310,              /* VALUES  */
+    SQL_AFTER = 311,               /* AFTER  */
+    SQL_ALTER = 312,               /* ALTER  */
+    SQL_CROSS = 313,               /* CROSS  */
+    SQL_DELTA = 314,               /* DELTA  */
+    SQL_GROUP = 315,               /* GROUP  */
+    SQL_INDEX = 316,               /* INDEX  */
+    SQL_INNER = 317,               /* INNER  */
+    SQL_LIMIT = 318,               /* LIMIT  */
+    SQL_LOCAL = 319,               /* LOCAL  */
+    SQL_MERGE = 320,               /* MERGE  */
+    SQL_MINUS = 321,               /* MINUS  */
+    SQL_ORDER = 322,               /* ORDER  */
+    SQL_OUTER = 323,               /* OUTER  */
+    SQL_RIGHT = 324,               /* RIGHT  */
+    SQL_TABLE = 325,               /* TABLE  */
+    SQL_UNION = 326,               /* UNION  */
+    SQL_USING = 327,               /* USING  */
+    SQL_WHERE = 328,               /* WHERE  */
+    SQL_CALL = 329,                /* CALL  */
+    SQL_CASE = 330,                /* CASE  */
+    SQL_DATE = 331,                /* DATE  */
+    SQL_DESC = 332,                /* DESC  */
+    SQL_DROP = 333,                /* DROP  */
+    SQL_ELSE = 334,                /* ELSE  */
+    SQL_FILE = 335,                /* FILE  */
+    SQL_FROM = 336,                /* FROM  */
+    SQL_FULL = 337,                /* FULL  */
+    SQL_HASH = 338,                /* HASH  */
+    SQL_HINT = 339,                /* HINT  */
+    SQL_INTO = 340,                /* INTO  */
+    SQL_JOIN = 341,                /* JOIN  */
+    SQL_LEFT = 342,                /* LEFT  */
+    SQL_LIKE = 343,                /* LIKE  */
+    SQL_LOAD = 344,                /* LOAD  */
+    SQL_NULL = 345,                /* NULL  */
+    SQL_PART = 346,                /* PART  */
+    SQL_PLAN = 347,                /* PLAN  */
+    SQL_SHOW = 348,                /* SHOW  */
+    SQL_TEXT = 349,                /* TEXT  */
+    SQL_THEN = 350,                /* THEN  */
+    SQL_TIME = 351,                /* TIME  */
+    SQL_VIEW = 352,                /* VIEW  */
+    SQL_WHEN = 353,                /* WHEN  */
+    SQL_WITH = 354,                /* WITH  */
+    SQL_ADD = 355,                 /* ADD  */
+    SQL_ALL = 356,                 /* ALL  */
+    SQL_AND = 357,                 /* AND  */
+    SQL_ASC = 358,                 /* ASC  */
+    SQL_CSV = 359,                 /* CSV  */
+    SQL_END = 360,                 /* END  */
+    SQL_FOR = 361,                 /* FOR  */
+    SQL_INT = 362,                 /* INT  */
+    SQL_KEY = 363,                 /* KEY  */
+    SQL_NOT = 364,                 /* NOT  */
+    SQL_OFF = 365,                 /* OFF  */
+    SQL_SET = 366,                 /* SET  */
+    SQL_TBL = 367,                 /* TBL  */
+    SQL_TOP = 368,                 /* TOP  */
+    SQL_AS = 369,                  /* AS  */
+    SQL_BY = 370,                  /* BY  */
+    SQL_IF = 371,                  /* IF  */
+    SQL_IN = 372,                  /* IN  */
+    SQL_IS = 373,                  /* IS  */
+    SQL_OF = 374,                  /* OF  */
+    SQL_ON = 375,                  /* ON  */
+    SQL_OR = 376,                  /* OR  */
+    SQL_TO = 377,                  /* TO  */
+    SQL_ARRAY = 378,               /* ARRAY  */
+    SQL_CONCAT = 379,              /* CONCAT  */
+    SQL_ILIKE = 380,               /* ILIKE  */
+    SQL_EQUALS = 381,              /* EQUALS  */
+    SQL_NOTEQUALS = 382,           /* NOTEQUALS  */
+    SQL_LESS = 383,                /* LESS  */
+    SQL_GREATER = 384,             /* GREATER  */
+    SQL_LESSEQ = 385,              /* LESSEQ  */
+    SQL_GREATEREQ = 386,           /* GREATEREQ  */
+    SQL_NOTNULL = 387,             /* NOTNULL  */
+    SQL_UMINUS = 388               /* UMINUS  */
   };
+  typedef enum hsql_tokentype hsql_token_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined HSQL_STYPE && ! defined HSQL_STYPE_IS_DECLARED
-
 union HSQL_STYPE
 {
-#line 93 "bison_parser.y" /* yacc.c:1909  */
+#line 130 "bison_parser.y"
 
 	double fval;
 	int64_t ival;
@@ -242,12 +252,13 @@ union HSQL_STYPE
 	hsql::Expr* expr;
 	hsql::OrderDescription* order;
 	hsql::OrderType order_type;
+	hsql::SetType set_type_t;
 	hsql::LimitDescription* limit;
 	hsql::ColumnDefinition* column_t;
 	hsql::GroupByDescription* group_t;
 	hsql::UpdateClause* update_t;
+	hsql::ValuesBlock* values_block;
 
-	std::vector<hsql::SQLStatement*>* stmt_vec;
 
 	std::vector<char*>* str_vec;
 	std::vector<hsql::TableRef*>* table_vec;
@@ -256,9 +267,9 @@ union HSQL_STYPE
 	std::vector<hsql::Expr*>* expr_vec;
 	std::vector<hsql::OrderDescription*>* order_vec;
 
-#line 260 "bison_parser.h" /* yacc.c:1909  */
-};
+#line 271 "bison_parser.h"
 
+};
 typedef union HSQL_STYPE HSQL_STYPE;
 # define HSQL_STYPE_IS_TRIVIAL 1
 # define HSQL_STYPE_IS_DECLARED 1
@@ -280,6 +291,8 @@ struct HSQL_LTYPE
 
 
 
-int hsql_parse (hsql::SQLParserResult* result, yyscan_t scanner);
+
+int hsql_parse (hsql::SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state);
+
 
 #endif /* !YY_HSQL_BISON_PARSER_H_INCLUDED  */
@@ -16,15 +16,53 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 
 using namespace hsql;
 
-int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const char *msg) {
+int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, HSQL_PARSE_STATE* state, const char *msg) {
 	result->setIsValid(false);
-	result->setErrorDetails(strdup(msg), llocp->first_line, llocp->first_column);
+	result->setErrorDetails(msg, hsql_get_input(scanner), llocp->first_offset);
 	return 0;
 }
 
+// Starts a chain of set operations on a select, which the operator type
+// continues. If the select is itself a chain, the new branches
+// are only appended to it when that does not change the result: the chain
+// has no ORDER BY or LIMIT of its own, and INTERSECT, which binds more
+// tightly, only extends chains of INTERSECTs. Otherwise the chain is nested
+// in a new chain on the same first select (see SetOperation::nested).
+static SelectStatement* beginSetOperation(SelectStatement* first, SetType type) {
+	SetOperation* operation = first->setOperation;
+	if (operation == nullptr) return first;
+
+	bool extend = operation->order == nullptr && operation->limit == nullptr;
+	if (extend && type == kSetIntersect) {
+		for (const SetBranch& branch : *operation->branches) {
+			if (branch.type != kSetIntersect) extend = false;
+		}
+	}
+	if (extend) return first;
+
+	first->setOperation = new SetOperation();
+	first->setOperation->nested = operation;
+	return first;
+}
+
+// Appends a select to the chain of first. INTERSECT binds more tightly than
+// UNION and EXCEPT, so a run of INTERSECTs after one of those continues the
+// select in front of it instead, as if it was parenthesized: in
+// A UNION B INTERSECT C, B holds the chain INTERSECT C. The branches of a
+// chain can then be evaluated from left to right.
+static void addSetBranch(SelectStatement* first, SetType type, bool all, SelectStatement* select) {
+	SetOperation* operation = first->setOperation;
+	if (type == kSetIntersect && operation != nullptr && !operation->branches->empty() &&
+	    operation->branches->back().type != kSetIntersect) {
+		first = beginSetOperation(operation->branches->back().select, type);
+	}
+	first->addSetBranch(type, all, select);
+}
+
 %}
 /*********************************
  ** Section 2: Bison Parser Declarations
@@ -39,20 +77,21 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 #include "../SQLParserResult.h"
 #include "parser_typedef.h"
 
-// Auto update column and line number
+// Only track byte offsets while scanning. The line and column of an error
+// are computed from the offset when the error is reported.
 #define YY_USER_ACTION \
-		yylloc->first_line = yylloc->last_line; \
-		yylloc->first_column = yylloc->last_column; \
-		for(int i = 0; yytext[i] != '\0'; i++) { \
-			yylloc->total_column++; \
-				if(yytext[i] == '\n') { \
-						yylloc->last_line++; \
-						yylloc->last_column = 0; \
-				} \
-				else { \
-						yylloc->last_column++; \
-				} \
-		}
+		yylloc->first_offset = yylloc->last_offset; \
+		yylloc->last_offset += yyleng;
+
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+		do { \
+			if (N) { \
+				(Current).first_offset = YYRHSLOC(Rhs, 1).first_offset; \
+				(Current).last_offset = YYRHSLOC(Rhs, N).last_offset; \
+			} else { \
+				(Current).first_offset = (Current).last_offset = YYRHSLOC(Rhs, 0).last_offset; \
+			} \
+		} while (0)
 }
 
 // Define the names of the created files (defined in Makefile)
@@ -71,11 +110,8 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 
 %initial-action {
 	// Initialize
-	@$.first_column = 0;
-	@$.last_column = 0;
-	@$.first_line = 0;
-	@$.last_line = 0;
-	@$.total_column = 0;
+	@$.first_offset = 0;
+	@$.last_offset = 0;
 };
 
 
@@ -85,6 +121,7 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 // Define additional parameters for yyparse
 %parse-param { hsql::SQLParserResult* result }
 %parse-param { yyscan_t scanner }
+%parse-param { HSQL_PARSE_STATE* state }
 
 
 /*********************************
@@ -114,12 +151,13 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 	hsql::Expr* expr;
 	hsql::OrderDescription* order;
 	hsql::OrderType order_type;
+	hsql::SetType set_type_t;
 	hsql::LimitDescription* limit;
 	hsql::ColumnDefinition* column_t;
 	hsql::GroupByDescription* group_t;
 	hsql::UpdateClause* update_t;
+	hsql::ValuesBlock* values_block;
 
-	std::vector<hsql::SQLStatement*>* stmt_vec;
 
 	std::vector<char*>* str_vec;
 	std::vector<hsql::TableRef*>* table_vec;
@@ -133,17 +171,25 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 /*********************************
  ** Descrutor symbols
  *********************************/
-%destructor { } <fval> <ival> <uval> <bval> <order_type> 
-%destructor { free( ($$.name) ); free( ($$.schema) ); } <table_name>
-%destructor { free( ($$) ); } <sval>
+%destructor { } <fval> <ival> <uval> <bval> <order_type> <set_type_t> 
+%destructor { freeString( ($$.name), Arena::current() ); freeString( ($$.schema), Arena::current() ); } <table_name>
+%destructor { freeString( ($$), Arena::current() ); } <sval>
+%destructor {
+	if (($$) != nullptr) {
+		for (char* ptr : *($$)) {
+			freeString(ptr, Arena::current());
+		}
+	}
+	deleteVector(($$), Arena::current());
+} <str_vec>
 %destructor {
 	if (($$) != nullptr) {
 		for (auto ptr : *($$)) {
 			delete ptr;
 		}
 	}
-	delete ($$);
-} <str_vec> <table_vec> <column_vec> <update_vec> <expr_vec> <order_vec> <stmt_vec>
+	deleteVector(($$), Arena::current());
+} <table_vec> <column_vec> <update_vec> <expr_vec> <order_vec>
 %destructor { delete ($$); } <*>
 
 
@@ -174,32 +220,34 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 /*********************************
  ** Non-Terminal types (http://www.gnu.org/software/bison/manual/html_node/Type-Decl.html)
  *********************************/
-%type <stmt_vec>	statement_list
 %type <statement> 	statement preparable_statement
 %type <exec_stmt>	execute_statement
 %type <prep_stmt>	prepare_statement
 %type <select_stmt> select_statement select_with_paren select_no_paren select_clause select_paren_or_clause
+%type <select_stmt> set_operation paren_set_operation
 %type <import_stmt> import_statement
 %type <create_stmt> create_statement
 %type <insert_stmt> insert_statement
+%type <values_block> values_start
 %type <delete_stmt> delete_statement truncate_statement
 %type <update_stmt> update_statement
 %type <drop_stmt>	drop_statement
 %type <show_stmt>	show_statement  
 %type <table_name>  table_name
 %type <sval> 		opt_alias alias file_path prepare_target_query
-%type <bval> 		opt_not_exists opt_exists opt_distinct
+%type <bval> 		opt_not_exists opt_exists opt_distinct opt_all
 %type <uval>		import_file_type opt_join_type column_type
 %type <table> 		from_clause table_ref table_ref_atomic table_ref_name nonjoin_table_ref_atomic
 %type <table>		join_clause table_ref_name_no_alias
 %type <expr> 		expr operand scalar_expr unary_expr binary_expr logic_expr exists_expr
 %type <expr>		function_expr between_expr expr_alias param_expr
 %type <expr> 		column_name literal int_literal num_literal string_literal
-%type <expr> 		comp_expr opt_where join_condition opt_having case_expr in_expr hint
+%type <expr> 		comp_expr opt_where join_condition opt_having case_expr in_expr in_list hint
 %type <expr> 		array_expr array_index null_literal
 %type <limit>		opt_limit opt_top
 %type <order>		order_desc
 %type <order_type>	opt_order_type
+%type <set_type_t>	set_type
 %type <column_t>	column_def
 %type <update_t>	update_clause
 %type <group_t>		opt_group
@@ -243,28 +291,33 @@ int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const cha
 // Defines our general input.
 input:
 		statement_list opt_semicolon {
-			for (SQLStatement* stmt : *$1) {
+			for (SQLStatement* stmt : state->statements) {
 				// Transfers ownership of the statement.
 				result->addStatement(stmt);
 			}
-
-			unsigned param_id = 0;
-			for (void* param : yyloc.param_list) {
-				if (param != nullptr) {
-					Expr* expr = (Expr*) param;
-					expr->ival = param_id;
-					result->addParameter(expr);
-					++param_id;
+			state->statements.clear();
+
+			// Placeholders ('?') are numbered in the order they were read.
+			// Numbered placeholders ($1) already have their id, but might
+			// not be in order.
+			if (state->numbered_params) {
+				std::stable_sort(state->param_list.begin(), state->param_list.end(),
+				[](const Expr* a, const Expr* b) { return a->ival < b->ival; });
+			} else {
+				for (size_t i = 0; i < state->param_list.size(); ++i) {
+					state->param_list[i]->ival = i;
 				}
 			}
-			delete $1;
+			for (Expr* param : state->param_list) {
+				result->addParameter(param);
+			}
 		}
 	;
 
 
 statement_list:
-		statement { $$ = new std::vector<SQLStatement*>(); $$->push_back($1); }
-	|	statement_list ';' statement { $1->push_back($3); $$ = $1; }
+		statement { state->statements.push_back($1); }
+	|	statement_list ';' statement { state->statements.push_back($3); }
 	;
 
 statement:
@@ -306,7 +359,7 @@ opt_hints:
 
 
 hint_list:
-	  hint { $$ = new std::vector<Expr*>(); $$->push_back($1); }
+	  hint { $$ = newVector<Expr*>(); $$->push_back($1); }
 	| hint_list ',' hint { $1->push_back($3); $$ = $1; }
 	;
 
@@ -366,7 +419,7 @@ import_file_type:
 	;
 
 file_path:
-		string_literal { $$ = strdup($1->name); delete $1; }
+		string_literal { $$ = $1->name; $1->name = nullptr; delete $1; }
 	;
 
 
@@ -423,7 +476,7 @@ opt_not_exists:
 	;
 
 column_def_commalist:
-		column_def { $$ = new std::vector<ColumnDefinition*>(); $$->push_back($1); }
+		column_def { $$ = newVector<ColumnDefinition*>(); $$->push_back($1); }
 	|	column_def_commalist ',' column_def { $1->push_back($3); $$ = $1; }
 	;
 
@@ -497,15 +550,22 @@ truncate_statement:
 /******************************
  * Insert Statement
  * INSERT INTO students VALUES ('Max', 1112233, 'Musterhausen', 2.3)
+ * INSERT INTO students VALUES ('Max', 1112233), ('Anna', 1112234)
  * INSERT INTO employees SELECT * FROM stundents
  ******************************/
 insert_statement:
-		INSERT INTO table_name opt_column_list VALUES '(' literal_list ')' {
+		INSERT INTO table_name opt_column_list values_start values_rows {
 			$$ = new InsertStatement(kInsertValues);
 			$$->schema = $3.schema;
 			$$->tableName = $3.name;
 			$$->columns = $4;
-			$$->values = $7;
+			if ($5->numRows == 1) {
+				$$->values = $5->releaseRow(0);
+				delete $5;
+			} else {
+				$$->rows = $5;
+			}
+			state->values_block = nullptr;
 		}
 	|	INSERT INTO table_name opt_column_list select_no_paren {
 			$$ = new InsertStatement(kInsertSelect);
@@ -522,6 +582,39 @@ opt_column_list:
 	|	/* empty */ { $$ = nullptr; }
 	;
 
+// The values are added to the block as they are read, without creating an
+// expression for each literal.
+values_start:
+		VALUES { $$ = new ValuesBlock(); state->values_block = $$; }
+	;
+
+values_rows:
+		values_row
+	|	values_rows ',' values_row
+	;
+
+values_row:
+		'(' row_values ')' {
+			if (!state->values_block->endRow()) {
+				yyerror(&@$, result, scanner, state, "All rows of VALUES must have the same number of values");
+				YYERROR;
+			}
+		}
+	;
+
+row_values:
+		row_value
+	|	row_values ',' row_value
+	;
+
+row_value:
+		STRING { state->values_block->addString($1); }
+	|	FLOATVAL { state->values_block->addFloat($1); }
+	|	INTVAL { state->values_block->addInt($1); }
+	|	NULL { state->values_block->addNull(); }
+	|	param_expr { state->values_block->addExpr($1); }
+	;
+
 
 /******************************
  * Update Statement
@@ -538,7 +631,7 @@ update_statement:
 	;
 
 update_clause_commalist:
-		update_clause { $$ = new std::vector<UpdateClause*>(); $$->push_back($1); }
+		update_clause { $$ = newVector<UpdateClause*>(); $$->push_back($1); }
 	|	update_clause_commalist ',' update_clause { $1->push_back($3); $$ = $1; }
 	;
 
@@ -557,19 +650,10 @@ update_clause:
 select_statement:
 		select_with_paren
 	|	select_no_paren
-	|	select_with_paren set_operator select_paren_or_clause opt_order opt_limit {
-			// TODO: allow multiple unions (through linked list)
-			// TODO: capture type of set_operator
-			// TODO: might overwrite order and limit of first select here
+	|	paren_set_operation opt_order opt_limit {
 			$$ = $1;
-			$$->unionSelect = $3;
-			$$->order = $4;
-
-			// Limit could have been set by TOP.
-			if ($5 != nullptr) {
-				delete $$->limit;
-				$$->limit = $5;
-			}
+			$$->setOperation->order = $2;
+			$$->setOperation->limit = $3;
 		}
 	;
 
@@ -594,35 +678,48 @@ select_no_paren:
 				$$->limit = $3;
 			}
 		}
-	|	select_clause set_operator select_paren_or_clause opt_order opt_limit {
-			// TODO: allow multiple unions (through linked list)
-			// TODO: capture type of set_operator
-			// TODO: might overwrite order and limit of first select here
+	|	set_operation opt_order opt_limit {
 			$$ = $1;
-			$$->unionSelect = $3;
-			$$->order = $4;
+			$$->setOperation->order = $2;
+			$$->setOperation->limit = $3;
+		}
+	;
 
-			// Limit could have been set by TOP.
-			if ($5 != nullptr) {
-				delete $$->limit;
-				$$->limit = $5;
-			}
+// Chains of set operations are kept flat, in the order of the query, except
+// for runs of INTERSECTs (see addSetBranch).
+set_operation:
+		select_clause set_type opt_all select_paren_or_clause {
+			$$ = $1;
+			addSetBranch($$, $2, $3, $4);
+		}
+	|	set_operation set_type opt_all select_paren_or_clause {
+			$$ = $1;
+			addSetBranch($$, $2, $3, $4);
 		}
 	;
 
-set_operator:
-		set_type opt_all
+// Chains that start with a parenthesized select. These are only allowed at
+// the top level of a statement, where they do not conflict with '(' expr ')'.
+paren_set_operation:
+		select_with_paren set_type opt_all select_paren_or_clause {
+			$$ = beginSetOperation($1, $2);
+			addSetBranch($$, $2, $3, $4);
+		}
+	|	paren_set_operation set_type opt_all select_paren_or_clause {
+			$$ = $1;
+			addSetBranch($$, $2, $3, $4);
+		}
 	;
 
 set_type:
-		UNION
-	|	INTERSECT
-	|	EXCEPT
+		UNION { $$ = kSetUnion; }
+	|	INTERSECT { $$ = kSetIntersect; }
+	|	EXCEPT { $$ = kSetExcept; }
 	;
 
 opt_all:
-		ALL
-	|	/* empty */
+		ALL { $$ = true; }
+	|	/* empty */ { $$ = false; }
 	;
 
 select_clause:
@@ -675,7 +772,7 @@ opt_order:
 	;
 
 order_list:
-		order_desc { $$ = new std::vector<OrderDescription*>(); $$->push_back($1); }
+		order_desc { $$ = newVector<OrderDescription*>(); $$->push_back($1); }
 	|	order_list ',' order_desc { $1->push_back($3); $$ = $1; }
 	;
 
@@ -706,12 +803,12 @@ opt_limit:
  * Expressions
  ******************************/
 expr_list:
-		expr_alias { $$ = new std::vector<Expr*>(); $$->push_back($1); }
+		expr_alias { $$ = newVector<Expr*>(); $$->push_back($1); }
 	|	expr_list ',' expr_alias { $1->push_back($3); $$ = $1; }
 	;
 
 literal_list:
-		literal { $$ = new std::vector<Expr*>(); $$->push_back($1); }
+		literal { $$ = newVector<Expr*>(); $$->push_back($1); }
 	|	literal_list ',' literal { $1->push_back($3); $$ = $1; }
 	;
 
@@ -775,12 +872,19 @@ logic_expr:
 	;
 
 in_expr:
-		operand IN '(' expr_list ')'			{ $$ = Expr::makeInOperator($1, $4); }
-	|	operand NOT IN '(' expr_list ')'		{ $$ = Expr::makeOpUnary(kOpNot, Expr::makeInOperator($1, $5)); }
+		operand IN '(' in_list ')'			{ $$ = $4; $$->expr = $1; }
+	|	operand NOT IN '(' in_list ')'		{ $5->expr = $1; $$ = Expr::makeOpUnary(kOpNot, $5); }
 	|	operand IN '(' select_no_paren ')'		{ $$ = Expr::makeInOperator($1, $4); }
 	|	operand NOT IN '(' select_no_paren ')'	{ $$ = Expr::makeOpUnary(kOpNot, Expr::makeInOperator($1, $5)); }
 	;
 
+// Values are added to the IN operator as they are read, so that lists of
+// literals are stored as plain values (see Expr::addInValue).
+in_list:
+		expr_alias { $$ = Expr::makeInOperator(nullptr); $$->addInValue($1); }
+	|	in_list ',' expr_alias { $$ = $1; $$->addInValue($3); }
+	;
+
 // TODO: allow no else specified
 case_expr:
 		CASE WHEN expr THEN operand END { $$ = Expr::makeCase($3, $5); }
@@ -803,7 +907,7 @@ comp_expr:
 	;
 
 function_expr:
-		IDENTIFIER '(' ')' { $$ = Expr::makeFunctionRef($1, new std::vector<Expr*>(), false); }
+		IDENTIFIER '(' ')' { $$ = Expr::makeFunctionRef($1, newVector<Expr*>(), false); }
 	|	IDENTIFIER '(' opt_distinct expr_list ')' { $$ = Expr::makeFunctionRef($1, $4, $3); }
 	;
 
@@ -812,7 +916,7 @@ array_expr:
 	;
 
 array_index:
-	   	operand '[' int_literal ']' { $$ = Expr::makeArrayIndex($1, $3->ival); }
+	   	operand '[' int_literal ']' { $$ = Expr::makeArrayIndex($1, $3->ival); delete $3; }
 	;
 
 between_expr:
@@ -853,9 +957,27 @@ null_literal:
 
 param_expr:
 		'?' {
-			$$ = Expr::makeParameter(yylloc.total_column);
-			$$->ival2 = yyloc.param_list.size();
-			yyloc.param_list.push_back($$);
+			if (state->numbered_params) {
+				yyerror(&@1, result, scanner, state, "Numbered and unnumbered placeholders can not be mixed");
+				YYERROR;
+			}
+			$$ = Expr::makeParameter(yylloc.last_offset);
+			$$->ival2 = state->param_list.size();
+			state->param_list.push_back($$);
+		}
+	|	'$' INTVAL {
+			if (@1.last_offset != @2.first_offset || $2 < 1 || $2 > SQLParserResult::kMaxParameterNumber) {
+				yyerror(&@$, result, scanner, state, "Invalid placeholder number");
+				YYERROR;
+			}
+			if (!state->param_list.empty() && !state->numbered_params) {
+				yyerror(&@$, result, scanner, state, "Numbered and unnumbered placeholders can not be mixed");
+				YYERROR;
+			}
+			state->numbered_params = true;
+			$$ = Expr::makeParameter($2 - 1);
+			$$->ival2 = state->param_list.size();
+			state->param_list.push_back($$);
 		}
 	;
 
@@ -890,7 +1012,7 @@ nonjoin_table_ref_atomic:
 	;
 
 table_ref_commalist:
-		table_ref_atomic { $$ = new std::vector<TableRef*>(); $$->push_back($1); }
+		table_ref_atomic { $$ = newVector<TableRef*>(); $$->push_back($1); }
 	|	table_ref_commalist ',' table_ref_atomic { $1->push_back($3); $$ = $1; }
 	;
 
@@ -961,12 +1083,16 @@ join_clause:
 			$$->join->type = (JoinType) $2;
 			$$->join->left = $1;
 			$$->join->right = $4;
-			auto left_col = Expr::makeColumnRef(strdup($7->name));
-			if ($7->alias != nullptr) left_col->alias = strdup($7->alias);
-			if ($1->getName() != nullptr) left_col->table = strdup($1->getName());
-			auto right_col = Expr::makeColumnRef(strdup($7->name));
-			if ($7->alias != nullptr) right_col->alias = strdup($7->alias);
-			if ($4->getName() != nullptr) right_col->table = strdup($4->getName());
+			// Token texts are only terminated after the scan, so both columns
+			// share the strings. They belong to the arena of the result.
+			auto left_col = Expr::makeColumnRef($7->name);
+			left_col->alias = $7->alias;
+			left_col->table = (char*) $1->getName();
+			auto right_col = Expr::makeColumnRef($7->name);
+			right_col->alias = $7->alias;
+			right_col->table = (char*) $4->getName();
+			$7->name = nullptr;
+			$7->alias = nullptr;
 			$$->join->condition = Expr::makeOpBinary(left_col, kOpEquals, right_col);
 			delete $7;
 		}
@@ -1000,7 +1126,7 @@ opt_semicolon:
 
 
 ident_commalist:
-		IDENTIFIER { $$ = new std::vector<char*>(); $$->push_back($1); }
+		IDENTIFIER { $$ = newVector<char*>(); $$->push_back($1); }
 	|	ident_commalist ',' IDENTIFIER { $1->push_back($3); $$ = $1; }
 	;
 
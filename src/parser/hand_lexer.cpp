@@ -0,0 +1,365 @@
+/**
+ * Hand-written lexer
+ *
+ * Drop-in replacement for the flex scanner generated from flex_lexer.l.
+ * It implements the part of the flex API that the parser uses and produces
+ * the same tokens, values and locations. Build it instead of the flex
+ * scanner with 'make lexer=hand'.
+ *
+ * Whitespace, identifier runs and quoted text are scanned with SSE2, or
+ * with AVX2 if the compiler targets it (e.g. -mavx2 or -march=native).
+ * Identifiers are classified as keywords with a single probe into the
+ * perfect hash in keyword_hash.h.
+ */
+
+#include "../sql/Expr.h"
+#include "bison_parser.h"
+#include "flex_lexer.h"
+#include "keyword_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+  /***************************
+   ** Scanner state
+   ***************************/
+
+  struct Scanner {
+    // Handed out by hsql__scan_buffer.
+    yy_buffer_state buffer;
+
+    // Next character to scan and the end of the input.
+    const char* cursor;
+    const char* end;
+
+    // Copy of the input that token strings point into (see hsql::tokenText).
+    void* extra;
+  };
+
+  /***************************
+   ** Character classes
+   ***************************/
+
+  inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n';
+  }
+
+  inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  inline bool isAlpha(char c) {
+    return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+  }
+
+  inline bool isIdentifierChar(char c) {
+    return isAlpha(c) || isDigit(c) || c == '_';
+  }
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  // Thin wrappers, so that the scanning loops below are written once for
+  // both vector widths.
+#if defined(__AVX2__)
+  typedef __m256i Vector;
+  const size_t kVectorSize = 32;
+  inline Vector load(const char* p) { return _mm256_loadu_si256((const __m256i*) p); }
+  inline Vector splat(char c) { return _mm256_set1_epi8(c); }
+  inline Vector equal(Vector a, Vector b) { return _mm256_cmpeq_epi8(a, b); }
+  inline Vector greater(Vector a, Vector b) { return _mm256_cmpgt_epi8(a, b); }
+  inline Vector both(Vector a, Vector b) { return _mm256_and_si256(a, b); }
+  inline Vector either(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+  inline uint32_t mask(Vector v) { return (uint32_t) _mm256_movemask_epi8(v); }
+#else
+  typedef __m128i Vector;
+  const size_t kVectorSize = 16;
+  inline Vector load(const char* p) { return _mm_loadu_si128((const __m128i*) p); }
+  inline Vector splat(char c) { return _mm_set1_epi8(c); }
+  inline Vector equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+  inline Vector greater(Vector a, Vector b) { return _mm_cmpgt_epi8(a, b); }
+  inline Vector both(Vector a, Vector b) { return _mm_and_si128(a, b); }
+  inline Vector either(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  inline uint32_t mask(Vector v) { return (uint32_t) _mm_movemask_epi8(v); }
+#endif
+  const uint32_t kFullMask = (uint32_t) ((1ull << kVectorSize) - 1);
+#define HSQL_LEXER_SIMD
+#endif
+
+  // Returns the first character in [p, end) that is not whitespace.
+  const char* skipWhitespace(const char* p, const char* end) {
+#ifdef HSQL_LEXER_SIMD
+    const Vector space = splat(' ');
+    const Vector tab = splat('\t');
+    const Vector newline = splat('\n');
+    while ((size_t) (end - p) >= kVectorSize) {
+      Vector chunk = load(p);
+      uint32_t other = ~mask(either(either(equal(chunk, space), equal(chunk, tab)), equal(chunk, newline))) & kFullMask;
+      if (other != 0) return p + __builtin_ctz(other);
+      p += kVectorSize;
+    }
+#endif
+    while (p < end && isWhitespace(*p)) ++p;
+    return p;
+  }
+
+  // Returns the first character in [p, end) that can not be part of an identifier.
+  const char* skipIdentifier(const char* p, const char* end) {
+#ifdef HSQL_LEXER_SIMD
+    // Bytes >= 0x80 compare as negative numbers and are never in a range.
+    const Vector caseBit = splat(0x20);
+    const Vector beforeA = splat('a' - 1);
+    const Vector afterZ = splat('z' + 1);
+    const Vector beforeZero = splat('0' - 1);
+    const Vector afterNine = splat('9' + 1);
+    const Vector underscore = splat('_');
+    while ((size_t) (end - p) >= kVectorSize) {
+      Vector chunk = load(p);
+      Vector lower = either(chunk, caseBit);
+      Vector alpha = both(greater(lower, beforeA), greater(afterZ, lower));
+      Vector digit = both(greater(chunk, beforeZero), greater(afterNine, chunk));
+      Vector accepted = either(either(alpha, digit), equal(chunk, underscore));
+      uint32_t other = ~mask(accepted) & kFullMask;
+      if (other != 0) return p + __builtin_ctz(other);
+      p += kVectorSize;
+    }
+#endif
+    while (p < end && isIdentifierChar(*p)) ++p;
+    return p;
+  }
+
+  // Returns the first occurrence of quote or a newline in [p, end), or end.
+  const char* findQuoteEnd(const char* p, const char* end, char quote) {
+#ifdef HSQL_LEXER_SIMD
+    const Vector quoteChar = splat(quote);
+    const Vector newline = splat('\n');
+    while ((size_t) (end - p) >= kVectorSize) {
+      Vector chunk = load(p);
+      uint32_t found = mask(either(equal(chunk, quoteChar), equal(chunk, newline)));
+      if (found != 0) return p + __builtin_ctz(found);
+      p += kVectorSize;
+    }
+#endif
+    while (p < end && *p != quote && *p != '\n') ++p;
+    return p;
+  }
+
+  // Returns the end of the line that starts at p (the newline is not included).
+  const char* skipLine(const char* p, const char* end) {
+    const char* newline = (const char*) memchr(p, '\n', end - p);
+    return (newline != nullptr) ? newline : end;
+  }
+
+  /***************************
+   ** Tokens
+   ***************************/
+
+  // Same bookkeeping as YY_USER_ACTION in bison_parser.y.
+  void setLocation(HSQL_LTYPE* loc, const char* input, const char* start, const char* end) {
+    loc->first_offset = start - input;
+    loc->last_offset = end - input;
+  }
+
+  // Parses a numeric token the same way atof()/atol() does on flex' yytext.
+  // The input is not terminated after the token, so it is copied first.
+  template <typename T>
+  T parseNumber(const char* start, const char* end, T (*convert)(const char*)) {
+    char buffer[64];
+    size_t length = end - start;
+    if (length < sizeof(buffer)) {
+      memcpy(buffer, start, length);
+      buffer[length] = '\0';
+      return convert(buffer);
+    }
+    return convert(std::string(start, length).c_str());
+  }
+
+  double toDouble(const char* text) {
+    return atof(text);
+  }
+
+  int64_t toInteger(const char* text) {
+    return atol(text);
+  }
+
+  // Returns the next token. Locations and values are set like in flex_lexer.l.
+  int nextToken(Scanner* s, HSQL_STYPE* yylval, HSQL_LTYPE* yylloc) {
+    const char* p = s->cursor;
+    const char* end = s->end;
+
+    const char* input = s->buffer.yy_ch_buf;
+
+    // Skip whitespace and comments. The location is set in the same steps
+    // as flex matches them, so that error positions are identical.
+    for (;;) {
+      const char* start = p;
+      if (p < end && isWhitespace(*p)) {
+        p = skipWhitespace(p, end);
+        setLocation(yylloc, input, start, p);
+      } else if (p + 1 < end && p[0] == '-' && p[1] == '-') {
+        setLocation(yylloc, input, start, start + 2);
+        p = skipLine(start + 2, end);
+        if (p != start + 2) setLocation(yylloc, input, start + 2, p);
+        // The newline that ends the comment is matched on its own.
+        if (p < end) {
+          setLocation(yylloc, input, p, p + 1);
+          ++p;
+        }
+      } else {
+        break;
+      }
+    }
+
+    if (p == end) {
+      s->cursor = p;
+      return 0;
+    }
+
+    const char* start = p;
+    int token;
+    char c = *p;
+    char next = (p + 1 < end) ? p[1] : '\0';
+
+    if (isAlpha(c)) {
+      p = skipIdentifier(p + 1, end);
+      token = hsql::findKeyword(start, p - start);
+      if (token == 0) {
+        yylval->sval = hsql::tokenText(s->extra, s->buffer.yy_ch_buf, start, 0, p - start);
+        token = SQL_IDENTIFIER;
+      }
+
+    } else if (isDigit(c) || (c == '-' && isDigit(next)) || (c == '.' && isDigit(next))) {
+      // -?[0-9]+"."[0-9]* | "."[0-9]* | -?[0-9]+
+      bool isFloat = (c == '.');
+      p += 1;
+      while (p < end && isDigit(*p)) ++p;
+      if (!isFloat && p < end && *p == '.') {
+        isFloat = true;
+        p += 1;
+        while (p < end && isDigit(*p)) ++p;
+      }
+
+      if (isFloat) {
+        yylval->fval = parseNumber(start, p, toDouble);
+        token = SQL_FLOATVAL;
+      } else {
+        yylval->ival = parseNumber(start, p, toInteger);
+        token = SQL_INTVAL;
+      }
+
+    } else if (c == '"' || c == '\'') {
+      // Quoted identifiers must not be empty, strings may be.
+      const char* close = findQuoteEnd(p + 1, end, c);
+      if (close == end || *close != c || (c == '"' && close == p + 1)) {
+        token = -1;
+        p += 1;
+      } else {
+        p = close + 1;
+        yylval->sval = hsql::tokenText(s->extra, s->buffer.yy_ch_buf, start, 1, p - start - 1);
+        token = (c == '"') ? SQL_IDENTIFIER : SQL_STRING;
+      }
+
+    } else {
+      // Operators of two characters take precedence over single characters.
+      size_t length = 1;
+      switch (c) {
+        case '!':
+          token = -1;
+          if (next == '=') { token = SQL_NOTEQUALS; length = 2; }
+          break;
+        case '<':
+          token = '<';
+          if (next == '>') { token = SQL_NOTEQUALS; length = 2; }
+          if (next == '=') { token = SQL_LESSEQ; length = 2; }
+          break;
+        case '>':
+          token = '>';
+          if (next == '=') { token = SQL_GREATEREQ; length = 2; }
+          break;
+        case '|':
+          token = '|';
+          if (next == '|') { token = SQL_CONCAT; length = 2; }
+          break;
+        case '-': case '+': case '*': case '/': case '(': case ')': case '{': case '}':
+        case ',': case '.': case ';': case '=': case '^': case '%': case ':': case '?':
+        case '[': case ']': case '$':
+          token = c;
+          break;
+        default:
+          token = -1;
+      }
+      p += length;
+    }
+
+    setLocation(yylloc, input, start, p);
+    s->cursor = p;
+
+    if (token == -1) {
+      fprintf(stderr, "[SQL-Lexer-Error] Unknown Character: %c\n", c);
+      return 0;
+    }
+    return token;
+  }
+
+} // namespace
+
+/***************************
+ ** Flex API
+ ***************************/
+
+int hsql_lex(YYSTYPE* yylval_param, YYLTYPE* yylloc_param, yyscan_t yyscanner) {
+  return nextToken((Scanner*) yyscanner, yylval_param, yylloc_param);
+}
+
+int hsql_lex_init(yyscan_t* scanner) {
+  Scanner* s = (Scanner*) calloc(1, sizeof(Scanner));
+  *scanner = s;
+  return (s == nullptr) ? 1 : 0;
+}
+
+int hsql_lex_destroy(yyscan_t yyscanner) {
+  free(yyscanner);
+  return 0;
+}
+
+YY_BUFFER_STATE hsql__scan_buffer(char* base, yy_size_t size, yyscan_t yyscanner) {
+  // Like flex, require the input to end with two null characters.
+  if (size < 2 || base[size - 2] != '\0' || base[size - 1] != '\0') return nullptr;
+
+  Scanner* s = (Scanner*) yyscanner;
+  memset(&s->buffer, 0, sizeof(s->buffer));
+  s->buffer.yy_ch_buf = base;
+  s->buffer.yy_buf_pos = base;
+  s->buffer.yy_buf_size = size - 2;
+  s->buffer.yy_n_chars = size - 2;
+  s->cursor = base;
+  s->end = base + size - 2;
+  return &s->buffer;
+}
+
+void hsql__delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner) {
+  Scanner* s = (Scanner*) yyscanner;
+  if (b == &s->buffer) {
+    s->cursor = nullptr;
+    s->end = nullptr;
+  }
+}
+
+void hsql_set_extra(YY_EXTRA_TYPE user_defined, yyscan_t yyscanner) {
+  ((Scanner*) yyscanner)->extra = user_defined;
+}
+
+YY_EXTRA_TYPE hsql_get_extra(yyscan_t yyscanner) {
+  return ((Scanner*) yyscanner)->extra;
+}
+
+const char* hsql_get_input(yyscan_t yyscanner) {
+  return ((Scanner*) yyscanner)->buffer.yy_ch_buf;
+}
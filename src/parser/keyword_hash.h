@@ -0,0 +1,175 @@
+// Generated by keywordlist_generator.py from sql_keywords.txt.
+// Do not edit, run 'make keyword_hash.h' in src/parser instead.
+#ifndef __SQLPARSER__KEYWORD_HASH_H__
+#define __SQLPARSER__KEYWORD_HASH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bison_parser.h"
+
+namespace hsql {
+
+  // Minimal perfect hash over the 118 SQL keywords.
+  const size_t kMaxKeywordLength = 10;
+  const uint64_t kKeywordSeed = 49ull;
+  const uint32_t kNumKeywordBuckets = 30;
+  const uint32_t kNumKeywordSlots = 118;
+
+  const uint8_t kKeywordDisplacements[kNumKeywordBuckets] = {
+    15, 1, 1, 62, 12, 16, 11, 5, 54, 15, 43, 63, 4, 5, 157, 74,
+    4, 10, 107, 58, 149, 56, 27, 5, 1, 14, 108, 102, 90, 106,
+  };
+
+  struct KeywordSlot {
+    char name[kMaxKeywordLength + 1];
+    uint8_t length;
+    int16_t token;
+  };
+
+  const KeywordSlot kKeywordSlots[kNumKeywordSlots] = {
+    {"IN", 2, SQL_IN},
+    {"DEFAULT", 7, SQL_DEFAULT},
+    {"ELSE", 4, SQL_ELSE},
+    {"FULL", 4, SQL_FULL},
+    {"PLAN", 4, SQL_PLAN},
+    {"IMPORT", 6, SQL_IMPORT},
+    {"LIKE", 4, SQL_LIKE},
+    {"OFF", 3, SQL_OFF},
+    {"EXECUTE", 7, SQL_EXECUTE},
+    {"NVARCHAR", 8, SQL_NVARCHAR},
+    {"TOP", 3, SQL_TOP},
+    {"DISTINCT", 8, SQL_DISTINCT},
+    {"MINUS", 5, SQL_MINUS},
+    {"ARRAY", 5, SQL_ARRAY},
+    {"TEXT", 4, SQL_TEXT},
+    {"PARAMETERS", 10, SQL_PARAMETERS},
+    {"TIMESTAMP", 9, SQL_TIMESTAMP},
+    {"SET", 3, SQL_SET},
+    {"VIEW", 4, SQL_VIEW},
+    {"TO", 2, SQL_TO},
+    {"HISTORY", 7, SQL_HISTORY},
+    {"SCHEMAS", 7, SQL_SCHEMAS},
+    {"CASCADE", 7, SQL_CASCADE},
+    {"DELETE", 6, SQL_DELETE},
+    {"RENAME", 6, SQL_RENAME},
+    {"FILE", 4, SQL_FILE},
+    {"EXISTS", 6, SQL_EXISTS},
+    {"SCHEMA", 6, SQL_SCHEMA},
+    {"IF", 2, SQL_IF},
+    {"TRUNCATE", 8, SQL_TRUNCATE},
+    {"NATURAL", 7, SQL_NATURAL},
+    {"BY", 2, SQL_BY},
+    {"OUTER", 5, SQL_OUTER},
+    {"LEFT", 4, SQL_LEFT},
+    {"INTEGER", 7, SQL_INTEGER},
+    {"CASE", 4, SQL_CASE},
+    {"AFTER", 5, SQL_AFTER},
+    {"USING", 5, SQL_USING},
+    {"TIME", 4, SQL_TIME},
+    {"WITH", 4, SQL_WITH},
+    {"COLUMNS", 7, SQL_COLUMNS},
+    {"DATE", 4, SQL_DATE},
+    {"DIRECT", 6, SQL_DIRECT},
+    {"BETWEEN", 7, SQL_BETWEEN},
+    {"ON", 2, SQL_ON},
+    {"INDEX", 5, SQL_INDEX},
+    {"VIRTUAL", 7, SQL_VIRTUAL},
+    {"INT", 3, SQL_INT},
+    {"NOT", 3, SQL_NOT},
+    {"HINT", 4, SQL_HINT},
+    {"WHERE", 5, SQL_WHERE},
+    {"UNLOAD", 6, SQL_UNLOAD},
+    {"ANALYZE", 7, SQL_ANALYZE},
+    {"DEALLOCATE", 10, SQL_DEALLOCATE},
+    {"ISNULL", 6, SQL_ISNULL},
+    {"DOUBLE", 6, SQL_DOUBLE},
+    {"CONTROL", 7, SQL_CONTROL},
+    {"VALUES", 6, SQL_VALUES},
+    {"UNIQUE", 6, SQL_UNIQUE},
+    {"CREATE", 6, SQL_CREATE},
+    {"SHOW", 4, SQL_SHOW},
+    {"INSERT", 6, SQL_INSERT},
+    {"IS", 2, SQL_IS},
+    {"TABLES", 6, SQL_TABLES},
+    {"ORDER", 5, SQL_ORDER},
+    {"OFFSET", 6, SQL_OFFSET},
+    {"RIGHT", 5, SQL_RIGHT},
+    {"DESC", 4, SQL_DESC},
+    {"SELECT", 6, SQL_SELECT},
+    {"HAVING", 6, SQL_HAVING},
+    {"EXCEPT", 6, SQL_EXCEPT},
+    {"TEMPORARY", 9, SQL_TEMPORARY},
+    {"OF", 2, SQL_OF},
+    {"FOR", 3, SQL_FOR},
+    {"THEN", 4, SQL_THEN},
+    {"UPDATE", 6, SQL_UPDATE},
+    {"NULL", 4, SQL_NULL},
+    {"PREPARE", 7, SQL_PREPARE},
+    {"WHEN", 4, SQL_WHEN},
+    {"EXPLAIN", 7, SQL_EXPLAIN},
+    {"ADD", 3, SQL_ADD},
+    {"INTO", 4, SQL_INTO},
+    {"BEFORE", 6, SQL_BEFORE},
+    {"GROUP", 5, SQL_GROUP},
+    {"ESCAPE", 6, SQL_ESCAPE},
+    {"RESTRICT", 8, SQL_RESTRICT},
+    {"DELTA", 5, SQL_DELTA},
+    {"ALTER", 5, SQL_ALTER},
+    {"AS", 2, SQL_AS},
+    {"OR", 2, SQL_OR},
+    {"HASH", 4, SQL_HASH},
+    {"UNION", 5, SQL_UNION},
+    {"COLUMN", 6, SQL_COLUMN},
+    {"LIMIT", 5, SQL_LIMIT},
+    {"PART", 4, SQL_PART},
+    {"MERGE", 5, SQL_MERGE},
+    {"ASC", 3, SQL_ASC},
+    {"SPATIAL", 7, SQL_SPATIAL},
+    {"JOIN", 4, SQL_JOIN},
+    {"TBL", 3, SQL_TBL},
+    {"KEY", 3, SQL_KEY},
+    {"INNER", 5, SQL_INNER},
+    {"AND", 3, SQL_AND},
+    {"ALL", 3, SQL_ALL},
+    {"CROSS", 5, SQL_CROSS},
+    {"CALL", 4, SQL_CALL},
+    {"LOCAL", 5, SQL_LOCAL},
+    {"DROP", 4, SQL_DROP},
+    {"LOAD", 4, SQL_LOAD},
+    {"END", 3, SQL_END},
+    {"ILIKE", 5, SQL_ILIKE},
+    {"SORTED", 6, SQL_SORTED},
+    {"FROM", 4, SQL_FROM},
+    {"INTERSECT", 9, SQL_INTERSECT},
+    {"GLOBAL", 6, SQL_GLOBAL},
+    {"CSV", 3, SQL_CSV},
+    {"PRIMARY", 7, SQL_PRIMARY},
+    {"TABLE", 5, SQL_TABLE},
+  };
+
+  // Returns the token of the keyword, or 0 if the identifier is not a keyword.
+  // Keywords are matched case-insensitively.
+  inline int findKeyword(const char* text, size_t length) {
+    if (length > kMaxKeywordLength) return 0;
+
+    uint64_t hash = 0xCBF29CE484222325ull ^ kKeywordSeed;
+    for (size_t i = 0; i < length; ++i) {
+      hash = (hash ^ (uint8_t) (text[i] | 0x20)) * 0x100000001B3ull;
+    }
+
+    uint32_t bucket = (uint32_t) (((hash >> 32) * kNumKeywordBuckets) >> 32);
+    uint32_t mixed = ((uint32_t) hash ^ kKeywordDisplacements[bucket]) * 0x9E3779B1u;
+    const KeywordSlot& slot = kKeywordSlots[((uint64_t) mixed * kNumKeywordSlots) >> 32];
+
+    if (slot.length != length) return 0;
+    for (size_t i = 0; i < length; ++i) {
+      char c = text[i];
+      if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+      if (c != slot.name[i]) return 0;
+    }
+    return slot.token;
+  }
+
+} // namespace hsql
+
+#endif
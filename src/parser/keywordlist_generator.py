@@ -1,5 +1,6 @@
-
+from __future__ import print_function
 import math
+import sys
 
 
 with open("sql_keywords.txt", 'r') as fh:
@@ -8,39 +9,149 @@ with open("sql_keywords.txt", 'r') as fh:
 	keywords = sorted(set(keywords)) # Sort by name
 	keywords = sorted(keywords, key=lambda x: len(x), reverse=True) # Sort by length
 
-	#################
-	# Flex
-
-	max_len = len(max(keywords, key=lambda x: len(x))) + 1
-	max_len = 4 * int(math.ceil(max_len / 4.0))
-
-	for keyword in keywords:
-		len_diff = (max_len) - len(keyword)
-		num_tabs = int(math.floor(len_diff / 4.0))
-
-		if len_diff % 4 != 0: num_tabs += 1
-
-		tabs = ''.join(['\t' for _ in range(num_tabs)])
-		print "%s%sTOKEN(%s)" % (keyword, tabs, keyword) 
-
-	#
-	#################
-
 
+def print_bison_tokens():
 	#################
 	# Bison
 	line = "%token"
 	max_len = 60
 
-	print "/* SQL Keywords */"
+	print("/* SQL Keywords */")
 	for keyword in keywords:
 
 		if len(line + " " + keyword) > max_len:
-			print line
+			print(line)
 			line = "%token " + keyword
 		else:
 			line = line + " " + keyword
-	print line
+	print(line)
+
+	#
+	#################
+
+
+#################
+# Perfect hash
+#
+# Keywords are placed with "hash and displace": the high half of a 64 bit
+# FNV-1a hash selects a bucket, whose displacement is mixed into the low
+# half to select the slot. The buckets are filled largest first, trying
+# displacements until all keywords of the bucket hit free slots.
+# Must match findKeyword() in the generated header.
+
+MASK32 = 0xFFFFFFFF
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+def keyword_hash(keyword, seed):
+	h = (0xCBF29CE484222325 ^ seed) & MASK64
+	for c in keyword:
+		h = ((h ^ (ord(c) | 0x20)) * 0x100000001B3) & MASK64
+	return h
+
+def reduce(value, size):
+	return (value * size) >> 32
+
+def slot_of(h, displacement, num_slots):
+	mixed = (((h & MASK32) ^ displacement) * 0x9E3779B1) & MASK32
+	return reduce(mixed, num_slots)
+
+def build_perfect_hash(num_buckets, num_slots):
+	for seed in range(1 << 16):
+		buckets = [[] for _ in range(num_buckets)]
+		for keyword in keywords:
+			h = keyword_hash(keyword, seed)
+			buckets[reduce(h >> 32, num_buckets)].append((keyword, h))
+
+		displacements = [0] * num_buckets
+		slots = [None] * num_slots
+		order = sorted(range(num_buckets), key=lambda b: len(buckets[b]), reverse=True)
+		for b in order:
+			if len(buckets[b]) == 0: break
+			for displacement in range(1 << 8):
+				candidate = [slot_of(h, displacement, num_slots) for (_, h) in buckets[b]]
+				if len(set(candidate)) == len(candidate) and all(slots[s] is None for s in candidate):
+					for s, (keyword, _) in zip(candidate, buckets[b]):
+						slots[s] = keyword
+					displacements[b] = displacement
+					break
+			else:
+				break
+		else:
+			return seed, displacements, slots
+	raise Exception("No perfect hash found")
+
+def print_keyword_hash():
+	num_buckets = int(math.ceil(len(keywords) / 4.0))
+	num_slots = len(keywords)
+	seed, displacements, slots = build_perfect_hash(num_buckets, num_slots)
+	max_len = len(max(keywords, key=lambda x: len(x)))
+
+	print("// Generated by keywordlist_generator.py from sql_keywords.txt.")
+	print("// Do not edit, run 'make keyword_hash.h' in src/parser instead.")
+	print("#ifndef __SQLPARSER__KEYWORD_HASH_H__")
+	print("#define __SQLPARSER__KEYWORD_HASH_H__")
+	print("")
+	print("#include <stddef.h>")
+	print("#include <stdint.h>")
+	print("#include \"bison_parser.h\"")
+	print("")
+	print("namespace hsql {")
+	print("")
+	print("  // Minimal perfect hash over the %d SQL keywords." % len(keywords))
+	print("  const size_t kMaxKeywordLength = %d;" % max_len)
+	print("  const uint64_t kKeywordSeed = %dull;" % seed)
+	print("  const uint32_t kNumKeywordBuckets = %d;" % num_buckets)
+	print("  const uint32_t kNumKeywordSlots = %d;" % num_slots)
+	print("")
+	print("  const uint8_t kKeywordDisplacements[kNumKeywordBuckets] = {")
+	for i in range(0, num_buckets, 16):
+		print("    " + " ".join("%d," % d for d in displacements[i:i + 16]))
+	print("  };")
+	print("")
+	print("  struct KeywordSlot {")
+	print("    char name[kMaxKeywordLength + 1];")
+	print("    uint8_t length;")
+	print("    int16_t token;")
+	print("  };")
+	print("")
+	print("  const KeywordSlot kKeywordSlots[kNumKeywordSlots] = {")
+	for keyword in slots:
+		print("    {\"%s\", %d, SQL_%s}," % (keyword, len(keyword), keyword))
+	print("  };")
+	print("")
+	print("  // Returns the token of the keyword, or 0 if the identifier is not a keyword.")
+	print("  // Keywords are matched case-insensitively.")
+	print("  inline int findKeyword(const char* text, size_t length) {")
+	print("    if (length > kMaxKeywordLength) return 0;")
+	print("")
+	print("    uint64_t hash = 0xCBF29CE484222325ull ^ kKeywordSeed;")
+	print("    for (size_t i = 0; i < length; ++i) {")
+	print("      hash = (hash ^ (uint8_t) (text[i] | 0x20)) * 0x100000001B3ull;")
+	print("    }")
+	print("")
+	print("    uint32_t bucket = (uint32_t) (((hash >> 32) * kNumKeywordBuckets) >> 32);")
+	print("    uint32_t mixed = ((uint32_t) hash ^ kKeywordDisplacements[bucket]) * 0x9E3779B1u;")
+	print("    const KeywordSlot& slot = kKeywordSlots[((uint64_t) mixed * kNumKeywordSlots) >> 32];")
+	print("")
+	print("    if (slot.length != length) return 0;")
+	print("    for (size_t i = 0; i < length; ++i) {")
+	print("      char c = text[i];")
+	print("      if (c >= 'a' && c <= 'z') c -= 'a' - 'A';")
+	print("      if (c != slot.name[i]) return 0;")
+	print("    }")
+	print("    return slot.token;")
+	print("  }")
+	print("")
+	print("} // namespace hsql")
+	print("")
+	print("#endif")
 
 	#
-	#################
\ No newline at end of file
+	#################
+
+
+if __name__ == "__main__":
+	if len(sys.argv) > 1 and sys.argv[1] == "--hash":
+		print_keyword_hash()
+	else:
+		print_bison_tokens()
@@ -15,19 +15,57 @@ typedef void* yyscan_t;
 
 
 struct HSQL_CUST_LTYPE {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-
-  int total_column;
-
-  // Parameters.
-  // int param_id;
-  std::vector<void*> param_list;
+  // Byte offsets of the first character and of the character after the
+  // last one in the input.
+  int first_offset;
+  int last_offset;
 };
 
 #define HSQL_LTYPE HSQL_CUST_LTYPE
 #define HSQL_LTYPE_IS_DECLARED 1
 
+namespace hsql {
+  struct Expr;
+  struct SQLStatement;
+  struct ValuesBlock;
+}
+
+// State of a parse that is shared by the grammar actions.
+// Passed to the parser as an additional argument (%parse-param).
+// Kept by SQLParserContext across parses, so that its lists keep their
+// memory. Both lists are empty between parses.
+struct HSQL_PARSE_STATE {
+  // Statements that were parsed so far. They are handed to the result
+  // once the whole input was parsed.
+  std::vector<hsql::SQLStatement*> statements;
+
+  // Placeholders ('?' or $1) in the order they were read.
+  std::vector<hsql::Expr*> param_list;
+
+  // True if the placeholders are numbered ($1). A query can not mix them
+  // with unnumbered placeholders ('?').
+  bool numbered_params = false;
+
+  // Values of the INSERT that is being read.
+  hsql::ValuesBlock* values_block = nullptr;
+};
+
+// Only the flex scanner has start conditions and writes to its input. The
+// hand-written lexer (make lexer=hand) defines HSQL_HAND_LEXER.
+#ifndef HSQL_HAND_LEXER
+// Defined in flex_lexer.l.
+// Puts the scanner back into its initial start condition, so that it can be
+// reused for the next input.
+void hsql_reset_start_condition(yyscan_t yyscanner);
+
+// Defined in flex_lexer.l.
+// Writes back the input character the scanner replaced with the terminator
+// of the current token.
+void hsql_restore_input(yyscan_t yyscanner);
+#endif
+
+// Defined in flex_lexer.l.
+// Returns the start of the input that is being scanned.
+const char* hsql_get_input(yyscan_t yyscanner);
+
 #endif
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace hsql {
   struct SelectStatement;
 
   // Represents definition of a table column
-  struct ColumnDefinition {
+  struct ColumnDefinition : ArenaAllocated {
     enum DataType {
       UNKNOWN,
       TEXT,
@@ -6,30 +6,105 @@
 
 namespace hsql {
 
+  // ValuesColumn
+  ValuesColumn::ValuesColumn() :
+    type(kValuesNull) {}
+
+  size_t ValuesColumn::size() const {
+    return cells.size();
+  }
+
+  bool ValuesColumn::isNull(size_t index) const {
+    return (nulls[index / 64] >> (index % 64)) & 1;
+  }
+
+  void ValuesColumn::append(ValuesCell cell) {
+    if (cells.size() % 64 == 0) nulls.push_back(0);
+    cells.push_back(cell);
+  }
+
+  void ValuesColumn::appendNull() {
+    size_t index = cells.size();
+    ValuesCell cell;
+    cell.ival = 0;
+    append(cell);
+    nulls.back() |= uint64_t(1) << (index % 64);
+  }
+
+  Expr* ValuesColumn::makeLiteral(size_t index) const {
+    if (isNull(index)) return Expr::makeNullLiteral();
+
+    const ValuesCell& cell = cells[index];
+    switch (type) {
+      case kValuesInt:
+        return Expr::makeLiteral(cell.ival);
+      case kValuesFloat:
+        return Expr::makeLiteral(cell.fval);
+      case kValuesString:
+        return Expr::makeLiteral(copyString(cell.sval));
+      default:
+        return nullptr;
+    }
+  }
+
+  // Expr
   Expr::Expr(ExprType type)
-    : type(type),
+    : expr(nullptr),
+      expr2(nullptr),
+      expr3(nullptr),
       exprList(nullptr),
       select(nullptr),
       name(nullptr),
       table(nullptr),
       alias(nullptr),
-      fval(0),
       ival(0),
       ival2(0),
+      fval(0),
+      type(type),
       opType(kOpNone),
       distinct(false) {};
 
+  // Moves the operands of the expression to the worklist.
+  static void detachOperands(Expr* e, std::vector<Expr*>* pending) {
+    if (e->expr != nullptr) pending->push_back(e->expr);
+    if (e->expr2 != nullptr) pending->push_back(e->expr2);
+    if (e->expr3 != nullptr) pending->push_back(e->expr3);
+    e->expr = e->expr2 = e->expr3 = nullptr;
+
+    if (e->exprList != nullptr) {
+      pending->insert(pending->end(), e->exprList->begin(), e->exprList->end());
+      deleteVector(e->exprList, e->arena());
+      e->exprList = nullptr;
+    }
+  }
+
+  // Frees the values of an IN list that are kept in inValues.
+  static void deleteInValues(ValuesColumn* values, const Arena* owner) {
+    if (values->type == kValuesString) {
+      for (ValuesCell& cell : values->cells) freeString(cell.sval, owner);
+    }
+    deleteObject(values, owner);
+  }
+
   Expr::~Expr() {
     delete select;
-    free(name);
-    free(table);
-    free(alias);
+    freeString(name, arena());
+    freeString(table, arena());
+    freeString(alias, arena());
+    if (type == kExprOperator && opType == kOpIn && inValues != nullptr) {
+      deleteInValues(inValues, arena());
+    }
 
-    if (exprList != nullptr) {
-      for (Expr* e : *exprList) {
-        delete e;
-      }
-      delete exprList;
+    // Operator chains (a + b + c ...) can be arbitrarily deep, so the
+    // operands are destroyed from a worklist instead of recursively.
+    // Each operand is emptied before it is deleted.
+    std::vector<Expr*> pending;
+    detachOperands(this, &pending);
+    while (!pending.empty()) {
+      Expr* e = pending.back();
+      pending.pop_back();
+      detachOperands(e, &pending);
+      delete e;
     }
   }
 
@@ -41,46 +116,68 @@ namespace hsql {
   Expr* Expr::makeOpUnary(OperatorType op, Expr* expr) {
     Expr* e = new Expr(kExprOperator);
     e->opType = op;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
+    e->expr = expr;
     return e;
   }
 
+  // Returns true if the expression is an AND or OR chain of the given kind
+  // that operands can be merged into.
+  static bool isLogicChain(const Expr* expr, OperatorType op) {
+    return expr->type == kExprOperator && expr->opType == op && expr->alias == nullptr;
+  }
+
   Expr* Expr::makeOpBinary(Expr* expr1, OperatorType op, Expr* expr2) {
+    if (op == kOpAnd || op == kOpOr) {
+      // AND and OR are associative, so chains of them are kept in a single
+      // node instead of a deep tree.
+      Expr* e = expr1;
+      if (!isLogicChain(expr1, op)) {
+        e = new Expr(kExprOperator);
+        e->opType = op;
+        e->exprList = newVector<Expr*>();
+        e->exprList->push_back(expr1);
+      }
+
+      if (isLogicChain(expr2, op)) {
+        e->exprList->insert(e->exprList->end(), expr2->exprList->begin(), expr2->exprList->end());
+        expr2->exprList->clear();
+        delete expr2;
+      } else {
+        e->exprList->push_back(expr2);
+      }
+      return e;
+    }
+
     Expr* e = new Expr(kExprOperator);
     e->opType = op;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr1);
-    e->exprList->push_back(expr2);
+    e->expr = expr1;
+    e->expr2 = expr2;
     return e;
   }
 
   Expr* Expr::makeBetween(Expr* expr, Expr* left, Expr* right) {
     Expr* e = new Expr(kExprOperator);
     e->opType = kOpBetween;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
-    e->exprList->push_back(left);
-    e->exprList->push_back(right);
+    e->expr = expr;
+    e->expr2 = left;
+    e->expr3 = right;
     return e;
   }
 
   Expr* Expr::makeCase(Expr* expr, Expr* then) {
     Expr* e = new Expr(kExprOperator);
     e->opType = kOpCase;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
-    e->exprList->push_back(then);
+    e->expr = expr;
+    e->expr2 = then;
     return e;
   }
 
   Expr* Expr::makeCase(Expr* expr, Expr* then, Expr* other) {
     Expr* e = new Expr(kExprOperator);
     e->opType = kOpCase;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
-    e->exprList->push_back(then);
-    e->exprList->push_back(other);
+    e->expr = expr;
+    e->expr2 = then;
+    e->expr3 = other;
     return e;
   }
 
@@ -148,8 +245,7 @@ namespace hsql {
 
   Expr* Expr::makeArrayIndex(Expr* expr, int64_t index) {
     Expr* e = new Expr(kExprArrayIndex);
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
+    e->expr = expr;
     e->ival = index;
     return e;
   }
@@ -176,16 +272,22 @@ namespace hsql {
   Expr* Expr::makeInOperator(Expr* expr, std::vector<Expr*>* exprList) {
     Expr* e = new Expr(kExprOperator);
     e->opType = kOpIn;
-    exprList->push_back(expr);
+    e->expr = expr;
     e->exprList = exprList;
     return e;
   }
 
+  Expr* Expr::makeInOperator(Expr* expr) {
+    Expr* e = new Expr(kExprOperator);
+    e->opType = kOpIn;
+    e->expr = expr;
+    return e;
+  }
+
   Expr* Expr::makeInOperator(Expr* expr, SelectStatement* select) {
     Expr* e = new Expr(kExprOperator);
     e->opType = kOpIn;
-    e->exprList = new std::vector<Expr*>();
-    e->exprList->push_back(expr);
+    e->expr = expr;
     e->select = select;
     return e;
   }
@@ -215,12 +317,121 @@ namespace hsql {
       return name;
   }
 
+  size_t Expr::numOperands() const {
+    size_t count = (expr != nullptr) + (expr2 != nullptr) + (expr3 != nullptr);
+    return exprList != nullptr ? count + exprList->size() : count;
+  }
+
+  Expr* Expr::operand(size_t index) const {
+    for (Expr* e : {expr, expr2, expr3}) {
+      if (e == nullptr) continue;
+      if (index == 0) return e;
+      --index;
+    }
+    return exprList != nullptr && index < exprList->size() ? exprList->at(index) : nullptr;
+  }
+
+  size_t Expr::inListSize() const {
+    if (exprList != nullptr) return exprList->size();
+    if (opType == kOpIn && inValues != nullptr) return inValues->size();
+    return 0;
+  }
+
+  InValue Expr::inValue(size_t index) const {
+    InValue value;
+    if (exprList != nullptr) {
+      value.type = kValuesExpr;
+      value.cell.expr = exprList->at(index);
+    } else {
+      value.type = inValues->isNull(index) ? kValuesNull : inValues->type;
+      value.cell = inValues->cells[index];
+    }
+    return value;
+  }
+
+  // Returns the type that a value of an IN list is stored as in inValues,
+  // or kValuesExpr if it has to stay an expression.
+  static ValuesType inValueType(const Expr* value) {
+    if (value->alias != nullptr) return kValuesExpr;
+    switch (value->type) {
+      case kExprLiteralInt:
+        return kValuesInt;
+      case kExprLiteralFloat:
+        return kValuesFloat;
+      case kExprLiteralString:
+        return kValuesString;
+      case kExprLiteralNull:
+        return kValuesNull;
+      default:
+        return kValuesExpr;
+    }
+  }
+
+  void Expr::addInValue(Expr* value) {
+    ValuesType valueType = inValueType(value);
+    if (exprList == nullptr && valueType != kValuesExpr) {
+      if (inValues == nullptr) {
+        // The list is allocated like the node itself.
+        ArenaScope scope(arena());
+        inValues = newObject<ValuesColumn>();
+      }
+
+      if (valueType == kValuesNull) {
+        inValues->appendNull();
+        delete value;
+        return;
+      }
+      if (inValues->type == kValuesNull || inValues->type == valueType) {
+        ValuesCell cell;
+        if (valueType == kValuesInt) {
+          cell.ival = value->ival;
+        } else if (valueType == kValuesFloat) {
+          cell.fval = value->fval;
+        } else {
+          cell.sval = value->name;
+          value->name = nullptr;
+        }
+        inValues->type = valueType;
+        inValues->append(cell);
+
+        // The literal is usually the most recent allocation of the arena,
+        // so deleting it gives its memory back.
+        delete value;
+        return;
+      }
+    }
+
+    expandInList();
+    exprList->push_back(value);
+  }
+
+  void Expr::expandInList() {
+    if (exprList != nullptr || select != nullptr) return;
+    ArenaScope scope(arena());
+    exprList = newVector<Expr*>();
+    if (inValues == nullptr) return;
+
+    exprList->reserve(inValues->size());
+    for (size_t i = 0; i < inValues->size(); ++i) {
+      exprList->push_back(inValues->makeLiteral(i));
+    }
+    deleteInValues(inValues, arena());
+    inValues = nullptr;
+  }
+
   char* substr(const char* source, int from, int to) {
-    int len = to - from;
-    char* copy = (char*)malloc(len + 1);
-    ;
-    strncpy(copy, source + from, len);
-    copy[len] = '\0';
-    return copy;
+    return copyString(source + from, to - from);
+  }
+
+  char* tokenText(void* terminators, const char* buffer, const char* token, int from, int to) {
+    if (terminators == nullptr) return substr(token, from, to);
+
+    // The text stays in the scanned buffer. It can only be terminated once
+    // the scan is over, since the scanner still reads the character that
+    // follows the token. That character never belongs to the text of
+    // another token.
+    char* text = (char*) token;
+    ((std::vector<char*>*) terminators)->push_back(text + to);
+    return text + from;
   }
 }  // namespace hsql
@@ -1,10 +1,13 @@
 #ifndef __SQLPARSER__EXPR_H__
 #define __SQLPARSER__EXPR_H__
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <memory>
 #include <vector>
 
+#include "../util/arena.h"
+
 namespace hsql {
   struct SelectStatement;
 
@@ -12,7 +15,14 @@ namespace hsql {
 // TODO: move to more appropriate place.
   char* substr(const char* source, int from, int to);
 
-  enum ExprType {
+// Returns the characters [from, to) of a token within the scanned buffer.
+// If terminators is given (a std::vector<char*>*), the string is a view into
+// the buffer and the position of its terminator is appended to terminators.
+// The scanner writes the terminators once it is done with the buffer.
+// Otherwise the characters are copied into a null-terminated string.
+  char* tokenText(void* terminators, const char* buffer, const char* token, int from, int to);
+
+  enum ExprType : uint8_t {
     kExprLiteralFloat,
     kExprLiteralString,
     kExprLiteralInt,
@@ -29,7 +39,7 @@ namespace hsql {
   };
 
 // Operator types. These are important for expressions of type kExprOperator.
-  enum OperatorType {
+  enum OperatorType : uint8_t {
     kOpNone,
 
     // Ternary operators
@@ -67,24 +77,103 @@ namespace hsql {
 
   typedef struct Expr Expr;
 
-// Represents SQL expressions (i.e. literals, operators, column_refs).
-// TODO: When destructing a placeholder expression, we might need to alter the
-// placeholder_list.
-  struct Expr {
-    Expr(ExprType type);
-    virtual ~Expr();
+  // Type of the values in a ValuesColumn.
+  enum ValuesType : uint8_t {
+    kValuesNull,    // All values so far are NULL.
+    kValuesInt,
+    kValuesFloat,
+    kValuesString,
+    kValuesExpr     // Placeholders or values of different types.
+  };
 
-    ExprType type;
+  // Value of a cell. Which member is set depends on the type of the column.
+  union ValuesCell {
+    int64_t ival;
+    double fval;
+    char* sval;
+    Expr* expr;
+  };
+
+  // Literals of one type stored as a plain array, used for long lists of
+  // values (rows of an INSERT, IN lists) instead of one expression per value.
+  struct ValuesColumn {
+    ValuesColumn();
+
+    ValuesType type;
+
+    // One cell per value. Cells of NULL values are zero.
+    std::vector<ValuesCell> cells;
+
+    // Bit i is set if value i is NULL.
+    std::vector<uint64_t> nulls;
+
+    size_t size() const;
+
+    bool isNull(size_t index) const;
+
+    // Appends a value. The column has to have the type of the value.
+    void append(ValuesCell cell);
+
+    void appendNull();
+
+    // Returns a new literal with the value at the given index, which the
+    // caller owns. Cells of kValuesExpr columns hold their expression instead.
+    Expr* makeLiteral(size_t index) const;
+  };
 
+  // A value of an IN list (see Expr::inValue). Values of a typed list are
+  // returned as their cell, with the type kValuesNull for NULL values.
+  // Values kept as expressions have the type kValuesExpr and are in
+  // cell.expr.
+  struct InValue {
+    ValuesType type;
+    ValuesCell cell;
+  };
+
+// Represents SQL expressions (i.e. literals, operators, column_refs).
+// The fields that are set depend on the type of the expression. Nodes are
+// not polymorphic and the scalar fields are packed at the end. That only
+// makes up for the operands, which are stored inline now: an expression
+// still takes 88 bytes on 64-bit platforms, plus the header of its arena
+// allocation (see ArenaAllocated).
+  struct Expr : ArenaAllocated {
+    Expr(ExprType type);
+    ~Expr();
+
+    // Operands of operators are stored in the node itself:
+    // - unary operators, IN and array indexes use expr,
+    // - binary operators use expr and expr2, except AND and OR, which keep
+    //   all operands of a chain (a AND b AND ...) in exprList,
+    // - BETWEEN uses expr, expr2 (lower bound) and expr3 (upper bound),
+    // - CASE uses expr (condition), expr2 (then) and expr3 (else, optional).
+    Expr* expr;
+    Expr* expr2;
+    Expr* expr3;
+
+    // Function arguments, array elements, the values of an IN list and the
+    // operands of AND and OR. IN lists of literals of one type keep their
+    // values in inValues instead.
     std::vector<Expr*>* exprList;
     SelectStatement* select;
     char* name;
     char* table;
     char* alias;
-    float fval;
-    int64_t ival;
+
+    // Value of integer literals, parameter ids and array indexes. IN
+    // operators (kOpIn) with a typed list keep it in inValues instead, so
+    // their ival is not 0 then.
+    union {
+      int64_t ival;
+      ValuesColumn* inValues;
+    };
+    // Position of placeholders in the query. Bound string literals in an
+    // arena keep the size of the buffer of their name here instead (see
+    // SQLParserResult::bindParameters), which copies do not take over.
     int64_t ival2;
 
+    // Value of float literals.
+    float fval;
+    ExprType type;
     OperatorType opType;
     bool distinct;
 
@@ -100,12 +189,43 @@ namespace hsql {
 
     const char* getName() const;
 
+    // Operands in the order in which the parser used to keep them in
+    // exprList, for code that does not depend on the layout of the node:
+    // the set ones of expr, expr2 and expr3, followed by exprList. So
+    // binary operators have two operands, BETWEEN three (value, lower and
+    // upper bound), CASE two or three (condition, then, else), AND and OR
+    // one per operand of the chain, and IN the tested value followed by the
+    // values of its list. Values of a typed IN list are not operands (see
+    // inValue). operand returns nullptr if index is out of range.
+    size_t numOperands() const;
+
+    Expr* operand(size_t index) const;
+
+    // Number of values of an IN list, whether they are kept in exprList or
+    // in inValues.
+    size_t inListSize() const;
+
+    // Value at the given index of an IN list, whether it is kept in exprList
+    // or in inValues. Unlike expandInList, this does not change the node.
+    InValue inValue(size_t index) const;
+
+    // Appends a value to an IN list and takes it over. Literals are stored
+    // in inValues as long as all of them have the same type. Any other value
+    // moves the list to exprList (see expandInList).
+    void addInValue(Expr* value);
+
+    // Moves the values of an IN list from inValues to exprList, for passes
+    // that rewrite the values of the list. Readers use inValue instead.
+    void expandInList();
+
     // Static constructors.
 
     static Expr* make(ExprType type);
 
     static Expr* makeOpUnary(OperatorType op, Expr* expr);
 
+    // AND and OR operands that are chains of the same operator are merged
+    // into a single node.
     static Expr* makeOpBinary(Expr* expr1, OperatorType op, Expr* expr2);
 
     static Expr* makeBetween(Expr* expr, Expr* left, Expr* right);
@@ -145,9 +265,15 @@ namespace hsql {
 
     static Expr* makeInOperator(Expr* expr, std::vector<Expr*>* exprList);
 
+    // Creates an IN operator with an empty list. See addInValue.
+    static Expr* makeInOperator(Expr* expr);
+
     static Expr* makeInOperator(Expr* expr, SelectStatement* select);
   };
 
+  // Fields added to Expr should keep the layout packed (see above).
+  static_assert(sizeof(void*) != 8 || sizeof(Expr) == 88, "Expr is expected to take 88 bytes on 64 bit platforms");
+
 // Zero initializes an Expr object and assigns it to a space in the heap
 // For Hyrise we still had to put in the explicit NULL constructor
 // http://www.ex-parrot.com/~chris/random/initialise.html
@@ -10,8 +10,65 @@ namespace hsql {
     kInsertSelect
   };
 
+  // Rows of an INSERT with more than one row of values, stored by column.
+  // Literals are kept as typed values instead of one expression per value,
+  // so that bulk inserts of many rows stay cheap to parse and to hold.
+  // A column that mixes types or holds placeholders falls back to one
+  // expression per value (kValuesExpr). NULL does not change the type.
+  // Example: "INSERT INTO t VALUES (1, 'a'), (2, NULL), (3, 'c')"
+  struct ValuesBlock : ArenaAllocated {
+    ValuesBlock();
+    ~ValuesBlock();
+
+    // Appends a value to the row that is being read.
+    void addInt(int64_t value);
+    void addFloat(double value);
+    void addString(char* value);
+    void addNull();
+
+    // Takes over a literal or a placeholder. Literals are stored as values,
+    // all other expressions as expressions.
+    void addExpr(Expr* expr);
+
+    // Completes the row that is being read. Returns false if it does not
+    // have as many values as the first row.
+    bool endRow();
+
+    size_t numColumns() const;
+
+    // Returns a new literal with the value of the given cell, which the
+    // caller owns. Cells of kValuesExpr columns hold their expression instead.
+    Expr* makeLiteral(size_t row, size_t column) const;
+
+    // Moves the values of all columns to expressions (kValuesExpr), for
+    // code that needs one expression per value. NULL values stay NULL.
+    void expandColumns();
+
+    // Moves the values of the row into a new vector of expressions.
+    // Used for inserts of a single row, which keep their values as expressions.
+    std::vector<Expr*>* releaseRow(size_t row);
+
+    size_t numRows;
+    std::vector<ValuesColumn>* columns;
+
+   private:
+    // Returns the column of the next value of the row, or nullptr if the row
+    // already has as many values as the first row.
+    ValuesColumn* nextColumn(ValuesType type);
+
+    // Converts the values of the column read so far into expressions.
+    void convertToExprs(ValuesColumn* column);
+
+    // Returns the value of the cell as an expression and clears the cell.
+    // Returns nullptr for NULL cells of kValuesExpr columns.
+    Expr* takeExpr(ValuesColumn* column, size_t row);
+
+    size_t nextColumn_;
+  };
+
   // Represents SQL Insert statements.
   // Example: "INSERT INTO students VALUES ('Max', 1112233, 'Musterhausen', 2.3)"
+  // Inserts of more than one row keep their values in rows instead of values.
   struct InsertStatement : SQLStatement {
     InsertStatement(InsertType type);
     virtual ~InsertStatement();
@@ -21,6 +78,7 @@ namespace hsql {
     char* tableName;
     std::vector<char*>* columns;
     std::vector<Expr*>* values;
+    ValuesBlock* rows;
     SelectStatement* select;
   };
 
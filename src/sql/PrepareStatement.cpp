@@ -1,15 +1,31 @@
 
 #include "PrepareStatement.h"
+#include "../SQLParserResult.h"
 
 namespace hsql {
   // PrepareStatement
   PrepareStatement::PrepareStatement() :
     SQLStatement(kStmtPrepare),
     name(nullptr),
-    query(nullptr) {}
+    query(nullptr),
+    prepared(nullptr) {}
 
   PrepareStatement::~PrepareStatement() {
-    free(name);
-    free(query);
+    freeString(name, arena());
+    freeString(query, arena());
+    if (arena() == nullptr) delete prepared;
+  }
+
+  static void deletePrepared(void* result) {
+    delete (SQLParserResult*) result;
+  }
+
+  void PrepareStatement::setPrepared(SQLParserResult* result) {
+    if (arena() == nullptr) {
+      delete prepared;
+    } else {
+      arena()->addFinalizer(&deletePrepared, result);
+    }
+    prepared = result;
   }
 } // namespace hsql
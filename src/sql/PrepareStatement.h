@@ -4,6 +4,7 @@
 #include "SQLStatement.h"
 
 namespace hsql {
+  class SQLParserResult;
 
   // Represents SQL Prepare statements.
   // Example: PREPARE test FROM 'SELECT * FROM test WHERE a = ?;'
@@ -15,6 +16,17 @@ namespace hsql {
 
     // The query that is supposed to be prepared.
     char* query;
+
+    // The statements of the query and their placeholders, parsed together
+    // with the PREPARE statement. Check isValid(), the query might not be
+    // valid SQL even if the PREPARE statement is.
+    // nullptr if the statement was not created by the parser.
+    SQLParserResult* prepared;
+
+    // Sets prepared and takes ownership of it. If this statement is
+    // allocated from an arena, the arena deletes the result, since statements
+    // might be released in bulk without running their destructors.
+    void setPrepared(SQLParserResult* result);
   };
 
 } // namsepace hsql
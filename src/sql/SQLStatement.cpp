@@ -14,7 +14,22 @@ namespace hsql {
         delete hint;
       }
     }
-    delete hints;
+    deleteVector(hints, arena());
+  }
+
+  void* SQLStatement::operator new(size_t size) {
+    Arena* arena = Arena::current();
+    void* ptr = ArenaAllocated::operator new(size);
+    if (arena != nullptr) arena->retain();
+    return ptr;
+  }
+
+  void SQLStatement::operator delete(void* ptr, size_t size) {
+    if (ptr == nullptr) return;
+
+    Arena* arena = ((SQLStatement*) ptr)->arena();
+    ArenaAllocated::operator delete(ptr, size);
+    if (arena != nullptr) arena->release();
   }
 
   StatementType SQLStatement::type() const {
@@ -24,12 +24,17 @@ namespace hsql {
   };
 
   // Base struct for every SQL statement
-  struct SQLStatement {
+  struct SQLStatement : ArenaAllocated {
 
     SQLStatement(StatementType type);
 
     virtual ~SQLStatement();
 
+    // Statements hold a reference on the arena they were allocated from,
+    // so that they stay valid after being released from their result.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+
     StatementType type() const;
 
     bool isType(StatementType type) const;
@@ -13,7 +13,7 @@ namespace hsql {
 
 
   // Description of the order by clause within a select statement.
-  struct OrderDescription {
+  struct OrderDescription : ArenaAllocated {
     OrderDescription(OrderType type, Expr* expr);
     virtual ~OrderDescription();
 
@@ -25,7 +25,7 @@ namespace hsql {
   const int64_t kNoOffset = -1;
 
   // Description of the limit clause within a select statement.
-  struct LimitDescription {
+  struct LimitDescription : ArenaAllocated {
     LimitDescription(int64_t limit, int64_t offset);
 
     int64_t limit;
@@ -33,7 +33,7 @@ namespace hsql {
   };
 
   // Description of the group-by clause within a select statement.
-  struct GroupByDescription {
+  struct GroupByDescription : ArenaAllocated {
     GroupByDescription();
     virtual ~GroupByDescription();
 
@@ -41,8 +41,48 @@ namespace hsql {
     Expr* having;
   };
 
+  enum SetType {
+    kSetUnion,
+    kSetIntersect,
+    kSetExcept
+  };
+
+  struct SelectStatement;
+
+  // One select that is combined with the ones before it by a set operator.
+  struct SetBranch {
+    SetType type;
+
+    // UNION ALL instead of UNION (DISTINCT).
+    bool all;
+    SelectStatement* select;
+  };
+
+  // Chain of set operations like A UNION B UNION ALL C EXCEPT D, which is
+  // stored on its first select (A). The other selects are the branches,
+  // kept in the order of the query together with the operator in front of
+  // them. Parenthesized groups stay nested as the select of their branch.
+  // So do runs of INTERSECTs after UNION or EXCEPT, since INTERSECT binds
+  // more tightly: A UNION B INTERSECT C is stored as A UNION (B INTERSECT C).
+  // The branches can therefore be evaluated from left to right.
+  // ORDER BY and LIMIT after the last select apply to the whole chain.
+  struct SetOperation : ArenaAllocated {
+    SetOperation();
+    virtual ~SetOperation();
+
+    std::vector<SetBranch>* branches;
+    std::vector<OrderDescription*>* order;
+    LimitDescription* limit;
+
+    // Parenthesized chain that starts with the first select and that this
+    // chain continues, if it could not be merged into it. In
+    // (A UNION B LIMIT 5) UNION C, A holds the chain UNION C, which holds
+    // the chain UNION B LIMIT 5 here. The first operand of this chain is
+    // then the result of the nested chain instead of the first select.
+    SetOperation* nested;
+  };
+
   // Representation of a full SQL select statement.
-  // TODO: add union_order and union_limit.
   struct SelectStatement : SQLStatement {
     SelectStatement();
     virtual ~SelectStatement();
@@ -53,9 +93,16 @@ namespace hsql {
     Expr* whereClause;
     GroupByDescription* groupBy;
 
-    SelectStatement* unionSelect;
+    // Order and limit of this select only. Those of a chain of set
+    // operations are kept in setOperation.
     std::vector<OrderDescription*>* order;
     LimitDescription* limit;
+
+    // Set operations with this select as the first operand, if any.
+    SetOperation* setOperation;
+
+    // Appends select as the next branch of setOperation, creating it if needed.
+    void addSetBranch(SetType type, bool all, SelectStatement* select);
   };
 
 } // namespace hsql
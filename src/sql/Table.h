@@ -25,7 +25,7 @@ namespace hsql {
   };
 
   // Holds reference to tables. Can be either table names or a select statement.
-  struct TableRef {
+  struct TableRef : ArenaAllocated {
     TableRef(TableRefType type);
     virtual ~TableRef();
 
@@ -59,7 +59,7 @@ namespace hsql {
   };
 
   // Definition of a join construct.
-  struct JoinDefinition {
+  struct JoinDefinition : ArenaAllocated {
     JoinDefinition();
     virtual ~JoinDefinition();
 
@@ -6,7 +6,7 @@
 namespace hsql {
 
   // Represents "column = value" expressions.
-  struct UpdateClause {
+  struct UpdateClause : ArenaAllocated {
     char* column;
     Expr* value;
   };
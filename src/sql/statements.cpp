@@ -9,7 +9,7 @@ namespace hsql {
     type(type) {};
 
   ColumnDefinition::~ColumnDefinition() {
-    free(name);
+    freeString(name, arena());
   }
 
   // CreateStatemnet
@@ -25,23 +25,23 @@ namespace hsql {
     select(nullptr) {};
 
   CreateStatement::~CreateStatement() {
-    free(filePath);
-    free(schema);
-    free(tableName);
+    freeString(filePath, arena());
+    freeString(schema, arena());
+    freeString(tableName, arena());
     delete select;
 
     if (columns != nullptr) {
       for (ColumnDefinition* def : *columns) {
         delete def;
       }
-      delete columns;
+      deleteVector(columns, arena());
     }
 
     if (viewColumns != nullptr) {
       for (char* column : *viewColumns) {
-        free(column);
+        freeString(column, arena());
       }
-      delete viewColumns;
+      deleteVector(viewColumns, arena());
     }
   }
 
@@ -53,8 +53,8 @@ namespace hsql {
     expr(nullptr) {};
 
   DeleteStatement::~DeleteStatement() {
-    free(schema);
-    free(tableName);
+    freeString(schema, arena());
+    freeString(tableName, arena());
     delete expr;
   }
 
@@ -66,8 +66,8 @@ namespace hsql {
     name(nullptr) {}
 
   DropStatement::~DropStatement() {
-    free(schema);
-    free(name);
+    freeString(schema, arena());
+    freeString(name, arena());
   }
 
   // ExecuteStatement
@@ -77,13 +77,13 @@ namespace hsql {
     parameters(nullptr) {}
 
   ExecuteStatement::~ExecuteStatement() {
-    free(name);
+    freeString(name, arena());
 
     if (parameters != nullptr) {
       for (Expr* param : *parameters) {
         delete param;
       }
-      delete parameters;
+      deleteVector(parameters, arena());
     }
   }
 
@@ -96,9 +96,180 @@ namespace hsql {
     tableName(nullptr) {};
 
   ImportStatement::~ImportStatement() {
-    free(filePath);
-    free(schema);
-    free(tableName);
+    freeString(filePath, arena());
+    freeString(schema, arena());
+    freeString(tableName, arena());
+  }
+
+  // ValuesBlock
+  ValuesBlock::ValuesBlock() :
+    numRows(0),
+    columns(newVector<ValuesColumn>()),
+    nextColumn_(0) {}
+
+  ValuesBlock::~ValuesBlock() {
+    for (ValuesColumn& column : *columns) {
+      for (ValuesCell& cell : column.cells) {
+        if (column.type == kValuesString) freeString(cell.sval, arena());
+        if (column.type == kValuesExpr) delete cell.expr;
+      }
+    }
+    deleteVector(columns, arena());
+  }
+
+  ValuesColumn* ValuesBlock::nextColumn(ValuesType type) {
+    size_t index = nextColumn_++;
+    if (numRows == 0 && index == columns->size()) columns->emplace_back();
+    if (index >= columns->size()) return nullptr;
+
+    ValuesColumn* column = &(*columns)[index];
+    if (type != kValuesNull && type != column->type) {
+      if (column->type == kValuesNull) {
+        column->type = type;
+      } else if (column->type != kValuesExpr) {
+        convertToExprs(column);
+      }
+    }
+    return column;
+  }
+
+  void ValuesBlock::convertToExprs(ValuesColumn* column) {
+    for (size_t row = 0; row < column->cells.size(); ++row) {
+      if (!column->isNull(row)) column->cells[row].expr = takeExpr(column, row);
+    }
+    column->type = kValuesExpr;
+  }
+
+  Expr* ValuesBlock::takeExpr(ValuesColumn* column, size_t row) {
+    ValuesCell& cell = column->cells[row];
+    Expr* expr = nullptr;
+    if (column->isNull(row)) {
+      expr = column->type == kValuesExpr ? nullptr : Expr::makeNullLiteral();
+    } else {
+      switch (column->type) {
+        case kValuesInt:
+          expr = Expr::makeLiteral(cell.ival);
+          break;
+        case kValuesFloat:
+          expr = Expr::makeLiteral(cell.fval);
+          break;
+        case kValuesString:
+          expr = Expr::makeLiteral(cell.sval);
+          break;
+        default:
+          expr = cell.expr;
+          break;
+      }
+    }
+    cell.ival = 0;
+    return expr;
+  }
+
+  void ValuesBlock::addInt(int64_t value) {
+    ValuesColumn* column = nextColumn(kValuesInt);
+    if (column == nullptr) return;
+
+    ValuesCell cell;
+    if (column->type == kValuesExpr) {
+      cell.expr = Expr::makeLiteral(value);
+    } else {
+      cell.ival = value;
+    }
+    column->append(cell);
+  }
+
+  void ValuesBlock::addFloat(double value) {
+    ValuesColumn* column = nextColumn(kValuesFloat);
+    if (column == nullptr) return;
+
+    ValuesCell cell;
+    if (column->type == kValuesExpr) {
+      cell.expr = Expr::makeLiteral(value);
+    } else {
+      cell.fval = value;
+    }
+    column->append(cell);
+  }
+
+  void ValuesBlock::addString(char* value) {
+    ValuesColumn* column = nextColumn(kValuesString);
+    if (column == nullptr) {
+      freeString(value, arena());
+      return;
+    }
+
+    ValuesCell cell;
+    if (column->type == kValuesExpr) {
+      cell.expr = Expr::makeLiteral(value);
+    } else {
+      cell.sval = value;
+    }
+    column->append(cell);
+  }
+
+  void ValuesBlock::addNull() {
+    ValuesColumn* column = nextColumn(kValuesNull);
+    if (column != nullptr) column->appendNull();
+  }
+
+  void ValuesBlock::addExpr(Expr* expr) {
+    switch (expr->type) {
+      case kExprLiteralInt:
+        addInt(expr->ival);
+        break;
+      case kExprLiteralFloat:
+        addFloat(expr->fval);
+        break;
+      case kExprLiteralString:
+        addString(expr->name);
+        expr->name = nullptr;
+        break;
+      case kExprLiteralNull:
+        addNull();
+        break;
+      default: {
+        ValuesColumn* column = nextColumn(kValuesExpr);
+        if (column == nullptr) break;
+
+        ValuesCell cell;
+        cell.expr = expr;
+        column->append(cell);
+        return;
+      }
+    }
+    delete expr;
+  }
+
+  bool ValuesBlock::endRow() {
+    bool complete = nextColumn_ == columns->size();
+    if (complete) ++numRows;
+    nextColumn_ = 0;
+    return complete;
+  }
+
+  size_t ValuesBlock::numColumns() const {
+    return columns->size();
+  }
+
+  Expr* ValuesBlock::makeLiteral(size_t row, size_t column) const {
+    return (*columns)[column].makeLiteral(row);
+  }
+
+  void ValuesBlock::expandColumns() {
+    ArenaScope scope(arena());
+    for (ValuesColumn& column : *columns) {
+      if (column.type != kValuesExpr) convertToExprs(&column);
+    }
+  }
+
+  std::vector<Expr*>* ValuesBlock::releaseRow(size_t row) {
+    std::vector<Expr*>* values = newVector<Expr*>();
+    values->reserve(columns->size());
+    for (ValuesColumn& column : *columns) {
+      Expr* expr = takeExpr(&column, row);
+      values->push_back(expr != nullptr ? expr : Expr::makeNullLiteral());
+    }
+    return values;
   }
 
   // InsertStatement
@@ -109,25 +280,27 @@ namespace hsql {
     tableName(nullptr),
     columns(nullptr),
     values(nullptr),
+    rows(nullptr),
     select(nullptr) {}
 
   InsertStatement::~InsertStatement() {
-    free(schema);
-    free(tableName);
+    freeString(schema, arena());
+    freeString(tableName, arena());
+    delete rows;
     delete select;
 
     if (columns != nullptr) {
       for (char* column : *columns) {
-        free(column);
+        freeString(column, arena());
       }
-      delete columns;
+      deleteVector(columns, arena());
     }
 
     if (values != nullptr) {
       for (Expr* expr : *values) {
         delete expr;
       }
-      delete values;
+      deleteVector(values, arena());
     }
   }
 
@@ -139,8 +312,8 @@ namespace hsql {
     name(nullptr) {}
 
   ShowStatement::~ShowStatement() {
-    free(schema);
-    free(name);
+    freeString(schema, arena());
+    freeString(name, arena());
   }
 
   // SelectStatement.h
@@ -171,7 +344,31 @@ namespace hsql {
       for (Expr* expr : *columns) {
         delete expr;
       }
-      delete columns;
+      deleteVector(columns, arena());
+    }
+  }
+
+  // SetOperation
+  SetOperation::SetOperation() :
+    branches(newVector<SetBranch>()),
+    order(nullptr),
+    limit(nullptr),
+    nested(nullptr) {}
+
+  SetOperation::~SetOperation() {
+    delete limit;
+    delete nested;
+
+    for (SetBranch& branch : *branches) {
+      delete branch.select;
+    }
+    deleteVector(branches, arena());
+
+    if (order != nullptr) {
+      for (OrderDescription* desc : *order) {
+        delete desc;
+      }
+      deleteVector(order, arena());
     }
   }
 
@@ -183,33 +380,42 @@ namespace hsql {
     selectList(nullptr),
     whereClause(nullptr),
     groupBy(nullptr),
-    unionSelect(nullptr),
     order(nullptr),
-    limit(nullptr) {};
+    limit(nullptr),
+    setOperation(nullptr) {};
 
   SelectStatement::~SelectStatement() {
     delete fromTable;
     delete whereClause;
     delete groupBy;
-    delete unionSelect;
     delete limit;
+    delete setOperation;
 
     // Delete each element in the select list.
     if (selectList != nullptr) {
       for (Expr* expr : *selectList) {
         delete expr;
       }
-      delete selectList;
+      deleteVector(selectList, arena());
     }
 
     if (order != nullptr) {
       for (OrderDescription* desc : *order) {
         delete desc;
       }
-      delete order;
+      deleteVector(order, arena());
     }
   }
 
+  void SelectStatement::addSetBranch(SetType type, bool all, SelectStatement* select) {
+    if (setOperation == nullptr) setOperation = new SetOperation();
+    SetBranch branch;
+    branch.type = type;
+    branch.all = all;
+    branch.select = select;
+    setOperation->branches->push_back(branch);
+  }
+
   // UpdateStatement
   UpdateStatement::UpdateStatement() :
     SQLStatement(kStmtUpdate),
@@ -223,11 +429,11 @@ namespace hsql {
 
     if (updates != nullptr) {
       for (UpdateClause* update : *updates) {
-        free(update->column);
+        freeString(update->column, arena());
         delete update->value;
         delete update;
       }
-      delete updates;
+      deleteVector(updates, arena());
     }
   }
 
@@ -241,20 +447,40 @@ namespace hsql {
     list(nullptr),
     join(nullptr) {}
 
+  // Moves the tables joined or listed in the table to the worklist.
+  static void detachTables(TableRef* table, std::vector<TableRef*>* pending) {
+    if (table->join != nullptr) {
+      if (table->join->left != nullptr) pending->push_back(table->join->left);
+      if (table->join->right != nullptr) pending->push_back(table->join->right);
+      table->join->left = table->join->right = nullptr;
+    }
+
+    if (table->list != nullptr) {
+      pending->insert(pending->end(), table->list->begin(), table->list->end());
+      deleteVector(table->list, table->arena());
+      table->list = nullptr;
+    }
+  }
+
   TableRef::~TableRef() {
-    free(schema);
-    free(name);
-    free(alias);
+    freeString(schema, arena());
+    freeString(name, arena());
+    freeString(alias, arena());
 
     delete select;
-    delete join;
 
-    if (list != nullptr) {
-      for (TableRef* table : *list) {
-        delete table;
-      }
-      delete list;
+    // A sequence of joins is a left-deep tree of tables, so they are
+    // destroyed from a worklist instead of recursively.
+    std::vector<TableRef*> pending;
+    detachTables(this, &pending);
+    while (!pending.empty()) {
+      TableRef* table = pending.back();
+      pending.pop_back();
+      detachTables(table, &pending);
+      delete table;
     }
+
+    delete join;
   }
 
   bool TableRef::hasSchema() const {
@@ -0,0 +1,269 @@
+
+#include "arena.h"
+#include <string.h>
+
+namespace hsql {
+
+  // Size of the first block. Following blocks double in size up to kMaxBlockSize.
+  const size_t kInitialBlockSize = 4096;
+  const size_t kMaxBlockSize = 1 << 20;
+
+  // All allocations are rounded up to multiples of this.
+  const size_t kAlignment = 8;
+
+  // Every node is prefixed with a pointer to the arena it was allocated from.
+  const size_t kNodeHeaderSize = sizeof(Arena*);
+
+  static thread_local Arena* currentArena = nullptr;
+
+  // Largest block of the arenas destroyed on this thread. Parsing into a
+  // new result picks it up instead of going back to malloc.
+  struct SpareBlock {
+    void* block = nullptr;
+    ~SpareBlock() { free(block); }
+  };
+  static thread_local SpareBlock spare;
+
+  Arena::Arena() :
+    blocks_(nullptr),
+    cursor_(nullptr),
+    end_(nullptr),
+    nextBlockSize_(kInitialBlockSize),
+    bytesAllocated_(0),
+    finalizers_(nullptr),
+    refCount_(1) {}
+
+  Arena::~Arena() {
+    runFinalizers();
+
+    if (blocks_ != nullptr) {
+      Block* previous = (Block*) spare.block;
+      if (previous == nullptr || previous->size < blocks_->size) {
+        spare.block = blocks_;
+        blocks_ = blocks_->next;
+        free(previous);
+      }
+    }
+    freeBlocks(blocks_);
+  }
+
+  void* Arena::allocate(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (size > (size_t) (end_ - cursor_)) {
+      addBlock(size);
+    }
+
+    void* ptr = cursor_;
+    cursor_ += size;
+    bytesAllocated_ += size;
+    return ptr;
+  }
+
+  void Arena::deallocate(void* ptr, size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if ((char*) ptr + size != cursor_) return;
+    cursor_ = (char*) ptr;
+    bytesAllocated_ -= size;
+  }
+
+  char* Arena::strndup(const char* str, size_t len) {
+    char* copy = (char*) allocate(len + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+  }
+
+  void Arena::addFinalizer(void (*finalizer)(void*), void* object) {
+    Finalizer* entry = (Finalizer*) allocate(sizeof(Finalizer));
+    entry->function = finalizer;
+    entry->object = object;
+    entry->next = finalizers_;
+    finalizers_ = entry;
+  }
+
+  bool Arena::owns(const void* ptr) const {
+    const char* p = (const char*) ptr;
+    for (Block* block = blocks_; block != nullptr; block = block->next) {
+      const char* data = (const char*) (block + 1);
+      if (p >= data && p < data + block->size) return true;
+    }
+    return false;
+  }
+
+  size_t Arena::references() const {
+    return refCount_.load();
+  }
+
+  bool Arena::isShared() const {
+    return refCount_.load() > 1;
+  }
+
+  void Arena::reset() {
+    runFinalizers();
+    if (blocks_ == nullptr) return;
+
+    // Replace the blocks by a single block of their total size, so that
+    // the next input of the same size fits without adding blocks.
+    // Beyond kMaxBlockSize only the most recent block is kept.
+    if (blocks_->next != nullptr) {
+      size_t total = 0;
+      for (Block* block = blocks_; block != nullptr; block = block->next) {
+        total += block->size;
+      }
+
+      if (total <= kMaxBlockSize) {
+        Block* block = (Block*) malloc(sizeof(Block) + total);
+        if (block == nullptr) throw std::bad_alloc();
+        block->size = total;
+        freeBlocks(blocks_);
+        blocks_ = block;
+      } else {
+        freeBlocks(blocks_->next);
+      }
+      blocks_->next = nullptr;
+    }
+
+    cursor_ = (char*) (blocks_ + 1);
+    end_ = cursor_ + blocks_->size;
+    bytesAllocated_ = 0;
+  }
+
+  size_t Arena::bytesAllocated() const {
+    return bytesAllocated_;
+  }
+
+  size_t Arena::bytesReserved() const {
+    size_t total = 0;
+    for (Block* block = blocks_; block != nullptr; block = block->next) {
+      total += block->size;
+    }
+    return total;
+  }
+
+  void Arena::retain() {
+    refCount_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Arena::release() {
+    if (refCount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  // static
+  Arena* Arena::current() {
+    return currentArena;
+  }
+
+  void Arena::reserve(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (size <= (size_t) (end_ - cursor_)) return;
+
+    Block* block = (Block*) malloc(sizeof(Block) + size);
+    if (block == nullptr) throw std::bad_alloc();
+    block->size = size;
+    block->next = blocks_;
+    blocks_ = block;
+    cursor_ = (char*) (block + 1);
+    end_ = cursor_ + block->size;
+  }
+
+  void Arena::addBlock(size_t minSize) {
+    size_t size = nextBlockSize_;
+    while (size < minSize) size *= 2;
+    if (nextBlockSize_ < kMaxBlockSize) nextBlockSize_ *= 2;
+
+    Block* block = (Block*) spare.block;
+    if (block != nullptr && block->size >= size) {
+      spare.block = nullptr;
+    } else {
+      block = (Block*) malloc(sizeof(Block) + size);
+      if (block == nullptr) throw std::bad_alloc();
+      block->size = size;
+    }
+
+    block->next = blocks_;
+    blocks_ = block;
+    cursor_ = (char*) (block + 1);
+    end_ = cursor_ + block->size;
+  }
+
+  void Arena::freeBlocks(Block* block) {
+    while (block != nullptr) {
+      Block* next = block->next;
+      free(block);
+      block = next;
+    }
+  }
+
+  void Arena::runFinalizers() {
+    while (finalizers_ != nullptr) {
+      finalizers_->function(finalizers_->object);
+      finalizers_ = finalizers_->next;
+    }
+  }
+
+  // ArenaScope
+  ArenaScope::ArenaScope(Arena* arena) :
+    previous_(currentArena) {
+    currentArena = arena;
+  }
+
+  ArenaScope::~ArenaScope() {
+    currentArena = previous_;
+  }
+
+  // ArenaAllocated
+  void* ArenaAllocated::operator new(size_t size) {
+    Arena* arena = currentArena;
+    char* memory;
+    if (arena != nullptr) {
+      memory = (char*) arena->allocate(kNodeHeaderSize + size);
+    } else {
+      memory = (char*) malloc(kNodeHeaderSize + size);
+      if (memory == nullptr) throw std::bad_alloc();
+    }
+
+    *(Arena**) memory = arena;
+    return memory + kNodeHeaderSize;
+  }
+
+  void ArenaAllocated::operator delete(void* ptr, size_t size) {
+    if (ptr == nullptr) return;
+
+    // Nodes in an arena are reclaimed when the arena is reset. Only the
+    // thread that allocates from the arena may give memory back early.
+    char* memory = (char*) ptr - kNodeHeaderSize;
+    Arena* arena = *(Arena**) memory;
+    if (arena == nullptr) {
+      free(memory);
+    } else if (arena == currentArena) {
+      arena->deallocate(memory, kNodeHeaderSize + size);
+    }
+  }
+
+  Arena* ArenaAllocated::arena() const {
+    return *(Arena* const*) ((const char*) this - kNodeHeaderSize);
+  }
+
+  char* copyString(const char* str, size_t len) {
+    if (currentArena != nullptr) {
+      return currentArena->strndup(str, len);
+    }
+
+    char* copy = (char*) malloc(len + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+  }
+
+  char* copyString(const char* str) {
+    return copyString(str, strlen(str));
+  }
+
+  void freeString(char* str, const Arena* owner) {
+    if (str == nullptr || owner != nullptr) return;
+    free(str);
+  }
+
+} // namespace hsql
@@ -0,0 +1,198 @@
+#ifndef __SQLPARSER__ARENA_H__
+#define __SQLPARSER__ARENA_H__
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include <vector>
+
+namespace hsql {
+
+  // Bump allocator that owns the memory of all AST nodes, vectors and strings
+  // created while parsing into a SQLParserResult.
+  // Memory is handed out from a list of growing blocks and is only
+  // returned to the system when the arena is reset or destroyed.
+  //
+  // The arena is reference counted: its owner holds one reference and
+  // every statement allocated from it holds another one. This keeps the memory
+  // alive for statements that were released from their result.
+  class Arena {
+   public:
+    Arena();
+
+    // Returns a pointer to size bytes of uninitialized, 8-byte aligned memory.
+    void* allocate(size_t size);
+
+    // Gives the memory of an allocation back if it was the most recent one,
+    // so that the next allocation reuses it. Memory of other allocations is
+    // only reclaimed when the arena is reset.
+    void deallocate(void* ptr, size_t size);
+
+    // Makes sure that the next size bytes can be allocated without adding
+    // a block. Adds a block of just that size if needed, so that contents
+    // of a known size (e.g. copies) do not use more memory than they need.
+    void reserve(size_t size);
+
+    // Copies len characters of the string into the arena and null-terminates them.
+    char* strndup(const char* str, size_t len);
+
+    // Registers a function that is called with the object before the arena
+    // is reset or destroyed. Used for objects that hold memory outside of it.
+    void addFinalizer(void (*finalizer)(void*), void* object);
+
+    // Returns true if ptr points into one of the blocks of this arena.
+    // Walks all blocks, so it is meant for tests and assertions. Nodes know
+    // their arena in constant time (see ArenaAllocated::arena).
+    bool owns(const void* ptr) const;
+
+    // Returns the number of references held on this arena.
+    size_t references() const;
+
+    // Returns true if objects other than the owner hold a reference.
+    bool isShared() const;
+
+    // Runs all finalizers and keeps the memory of the arena for reuse.
+    // Multiple blocks are merged into one. Must not be called while the arena
+    // is shared.
+    void reset();
+
+    // Returns the number of bytes handed out since the last reset.
+    size_t bytesAllocated() const;
+
+    // Returns the number of bytes held in the blocks of this arena.
+    size_t bytesReserved() const;
+
+    void retain();
+
+    // Drops a reference. Deletes the arena once the last one is gone.
+    void release();
+
+    // Returns the arena that nodes created on this thread are allocated from.
+    // Returns nullptr if no arena is active.
+    static Arena* current();
+
+   private:
+    friend class ArenaScope;
+
+    struct Block {
+      Block* next;
+      size_t size;
+    };
+
+    struct Finalizer {
+      void (*function)(void*);
+      void* object;
+      Finalizer* next;
+    };
+
+    ~Arena();
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void addBlock(size_t minSize);
+    void freeBlocks(Block* block);
+    void runFinalizers();
+
+    // Most recently added block. Blocks are linked from newest to oldest.
+    Block* blocks_;
+    char* cursor_;
+    char* end_;
+
+    size_t nextBlockSize_;
+    size_t bytesAllocated_;
+
+    Finalizer* finalizers_;
+
+    std::atomic<size_t> refCount_;
+  };
+
+  // Makes the given arena the current arena of this thread for the lifetime
+  // of the scope. Scopes can be nested.
+  class ArenaScope {
+   public:
+    explicit ArenaScope(Arena* arena);
+    ~ArenaScope();
+
+   private:
+    Arena* previous_;
+  };
+
+  // Base of all AST nodes.
+  // Nodes created while an arena is active are placed in that arena,
+  // all other nodes are allocated on the heap. Each node is prefixed with a
+  // pointer to its arena, so that deleting the node is always safe.
+  // AST nodes must therefore always be created with new.
+  struct ArenaAllocated {
+    static void* operator new(size_t size);
+
+    // Nodes deleted right after they were created on the thread of their
+    // arena (e.g. by the parser) give their memory back to the arena.
+    static void operator delete(void* ptr, size_t size);
+
+    // Returns the arena this node was allocated from or nullptr for heap nodes.
+    Arena* arena() const;
+  };
+
+  // Copies len characters of the string into the current arena, or onto the
+  // heap if there is no current arena. The copy is null-terminated.
+  char* copyString(const char* str, size_t len);
+
+  char* copyString(const char* str);
+
+  // Frees a string of a node. owner is the arena of the node: the strings
+  // of nodes in an arena belong to that arena and are not freed, the
+  // strings of heap nodes are freed.
+  void freeString(char* str, const Arena* owner);
+
+  template <typename T>
+  void destroyObject(void* object) {
+    ((T*) object)->~T();
+  }
+
+  // Creates a default constructed object that is not an AST node (e.g. a
+  // vector) in the current arena, or on the heap if there is no current
+  // arena. Memory the object allocates itself (e.g. the elements of a vector)
+  // is freed by a finalizer.
+  template <typename T>
+  T* newObject() {
+    Arena* arena = Arena::current();
+    if (arena == nullptr) return new T();
+
+    T* object = new (arena->allocate(sizeof(T))) T();
+    arena->addFinalizer(&destroyObject<T>, object);
+    return object;
+  }
+
+  // Deletes an object created by newObject. owner is the arena of the node
+  // that holds the object, see freeString.
+  // Objects in an arena are only reset to their default state, the
+  // finalizer destroys them once the arena is reset.
+  template <typename T>
+  void deleteObject(T* object, const Arena* owner) {
+    if (object == nullptr) return;
+    if (owner != nullptr) {
+      *object = T();
+    } else {
+      delete object;
+    }
+  }
+
+  // Creates an empty vector in the current arena, or on the heap if there is
+  // no current arena. Only the vector object lives in the arena, its elements
+  // are still allocated by std::allocator and are freed by a finalizer.
+  template <typename T>
+  std::vector<T>* newVector() {
+    return newObject<std::vector<T>>();
+  }
+
+  // Deletes a vector created by newVector.
+  // Vectors in an arena are only emptied, the finalizer destroys them once
+  // the arena is reset.
+  template <typename T>
+  void deleteVector(std::vector<T>* vec, const Arena* owner) {
+    deleteObject(vec, owner);
+  }
+
+} // namespace hsql
+
+#endif
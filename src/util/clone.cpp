@@ -0,0 +1,320 @@
+#include "clone.h"
+#include "../SQLParserResult.h"
+#include <utility>
+
+namespace hsql {
+
+  static SelectStatement* cloneSelect(const SelectStatement* select, std::vector<Expr*>* parameters);
+  static SetOperation* cloneSetOperation(const SetOperation* operation, std::vector<Expr*>* parameters);
+
+  static char* cloneString(const char* str) {
+    return str != nullptr ? copyString(str) : nullptr;
+  }
+
+  static std::vector<char*>* cloneStrings(const std::vector<char*>* strings) {
+    if (strings == nullptr) return nullptr;
+    std::vector<char*>* copy = newVector<char*>();
+    copy->reserve(strings->size());
+    for (const char* str : *strings) {
+      copy->push_back(cloneString(str));
+    }
+    return copy;
+  }
+
+  static std::vector<Expr*>* cloneExprs(const std::vector<Expr*>* exprs, std::vector<Expr*>* parameters) {
+    if (exprs == nullptr) return nullptr;
+    std::vector<Expr*>* copy = newVector<Expr*>();
+    copy->reserve(exprs->size());
+    for (const Expr* expr : *exprs) {
+      copy->push_back(cloneExpr(expr, parameters));
+    }
+    return copy;
+  }
+
+  // Copies the cells of a column, including its strings and expressions.
+  static void cloneValues(const ValuesColumn& values, ValuesColumn* copy, std::vector<Expr*>* parameters) {
+    *copy = values;
+    if (copy->type != kValuesString && copy->type != kValuesExpr) return;
+    for (ValuesCell& cell : copy->cells) {
+      if (copy->type == kValuesString) {
+        cell.sval = cloneString(cell.sval);
+      } else if (cell.expr != nullptr) {
+        cell.expr = cloneExpr(cell.expr, parameters);
+      }
+    }
+  }
+
+  Expr* cloneExpr(const Expr* expr, std::vector<Expr*>* parameters) {
+    // Operator chains can be arbitrarily deep, so the tree is copied from a
+    // worklist instead of recursively. Each entry is a node and the field of
+    // the copy that its copy is stored in.
+    Expr* root = nullptr;
+    std::vector<std::pair<const Expr*, Expr**>> pending;
+    if (expr != nullptr) pending.emplace_back(expr, &root);
+
+    while (!pending.empty()) {
+      const Expr* source = pending.back().first;
+      Expr** target = pending.back().second;
+      pending.pop_back();
+
+      Expr* copy = new Expr(source->type);
+      *target = copy;
+      copy->name = cloneString(source->name);
+      copy->table = cloneString(source->table);
+      copy->alias = cloneString(source->alias);
+      copy->ival = source->ival;
+      // The copy of a string has no spare capacity (see Expr::ival2).
+      if (source->type != kExprLiteralString) copy->ival2 = source->ival2;
+      copy->fval = source->fval;
+      copy->opType = source->opType;
+      copy->distinct = source->distinct;
+      copy->select = cloneSelect(source->select, parameters);
+      if (source->type == kExprOperator && source->opType == kOpIn && source->inValues != nullptr) {
+        copy->inValues = newObject<ValuesColumn>();
+        cloneValues(*source->inValues, copy->inValues, parameters);
+      }
+
+      if (source->expr != nullptr) pending.emplace_back(source->expr, &copy->expr);
+      if (source->expr2 != nullptr) pending.emplace_back(source->expr2, &copy->expr2);
+      if (source->expr3 != nullptr) pending.emplace_back(source->expr3, &copy->expr3);
+      if (source->exprList != nullptr) {
+        copy->exprList = newVector<Expr*>();
+        copy->exprList->resize(source->exprList->size());
+        for (size_t i = 0; i < source->exprList->size(); ++i) {
+          pending.emplace_back(source->exprList->at(i), &copy->exprList->at(i));
+        }
+      }
+
+      if (parameters != nullptr && copy->type == kExprParameter) {
+        parameters->push_back(copy);
+      }
+    }
+    return root;
+  }
+
+  static TableRef* cloneTable(const TableRef* table, std::vector<Expr*>* parameters) {
+    // A sequence of joins is a left-deep tree, so it is copied from a
+    // worklist like expressions.
+    TableRef* root = nullptr;
+    std::vector<std::pair<const TableRef*, TableRef**>> pending;
+    if (table != nullptr) pending.emplace_back(table, &root);
+
+    while (!pending.empty()) {
+      const TableRef* source = pending.back().first;
+      TableRef** target = pending.back().second;
+      pending.pop_back();
+
+      TableRef* copy = new TableRef(source->type);
+      *target = copy;
+      copy->schema = cloneString(source->schema);
+      copy->name = cloneString(source->name);
+      copy->alias = cloneString(source->alias);
+      copy->select = cloneSelect(source->select, parameters);
+
+      if (source->list != nullptr) {
+        copy->list = newVector<TableRef*>();
+        copy->list->resize(source->list->size());
+        for (size_t i = 0; i < source->list->size(); ++i) {
+          pending.emplace_back(source->list->at(i), &copy->list->at(i));
+        }
+      }
+
+      if (source->join != nullptr) {
+        copy->join = new JoinDefinition();
+        copy->join->type = source->join->type;
+        copy->join->condition = cloneExpr(source->join->condition, parameters);
+        if (source->join->left != nullptr) pending.emplace_back(source->join->left, &copy->join->left);
+        if (source->join->right != nullptr) pending.emplace_back(source->join->right, &copy->join->right);
+      }
+    }
+    return root;
+  }
+
+  static std::vector<OrderDescription*>* cloneOrder(const std::vector<OrderDescription*>* order, std::vector<Expr*>* parameters) {
+    if (order == nullptr) return nullptr;
+    std::vector<OrderDescription*>* copy = newVector<OrderDescription*>();
+    copy->reserve(order->size());
+    for (const OrderDescription* desc : *order) {
+      copy->push_back(new OrderDescription(desc->type, cloneExpr(desc->expr, parameters)));
+    }
+    return copy;
+  }
+
+  static LimitDescription* cloneLimit(const LimitDescription* limit) {
+    return limit != nullptr ? new LimitDescription(limit->limit, limit->offset) : nullptr;
+  }
+
+  static SelectStatement* cloneSelect(const SelectStatement* select, std::vector<Expr*>* parameters) {
+    if (select == nullptr) return nullptr;
+    SelectStatement* copy = new SelectStatement();
+    copy->hints = cloneExprs(select->hints, parameters);
+    copy->fromTable = cloneTable(select->fromTable, parameters);
+    copy->selectDistinct = select->selectDistinct;
+    copy->selectList = cloneExprs(select->selectList, parameters);
+    copy->whereClause = cloneExpr(select->whereClause, parameters);
+
+    if (select->groupBy != nullptr) {
+      copy->groupBy = new GroupByDescription();
+      copy->groupBy->columns = cloneExprs(select->groupBy->columns, parameters);
+      copy->groupBy->having = cloneExpr(select->groupBy->having, parameters);
+    }
+
+    copy->order = cloneOrder(select->order, parameters);
+    copy->limit = cloneLimit(select->limit);
+
+    copy->setOperation = cloneSetOperation(select->setOperation, parameters);
+    return copy;
+  }
+
+  static SetOperation* cloneSetOperation(const SetOperation* operation, std::vector<Expr*>* parameters) {
+    if (operation == nullptr) return nullptr;
+    SetOperation* copy = new SetOperation();
+    copy->branches->reserve(operation->branches->size());
+    for (const SetBranch& branch : *operation->branches) {
+      copy->branches->push_back({branch.type, branch.all, cloneSelect(branch.select, parameters)});
+    }
+    copy->order = cloneOrder(operation->order, parameters);
+    copy->limit = cloneLimit(operation->limit);
+    copy->nested = cloneSetOperation(operation->nested, parameters);
+    return copy;
+  }
+
+  static ValuesBlock* cloneRows(const ValuesBlock* rows, std::vector<Expr*>* parameters) {
+    if (rows == nullptr) return nullptr;
+    ValuesBlock* copy = new ValuesBlock();
+    copy->numRows = rows->numRows;
+    copy->columns->resize(rows->columns->size());
+    for (size_t i = 0; i < rows->columns->size(); ++i) {
+      cloneValues(rows->columns->at(i), &copy->columns->at(i), parameters);
+    }
+    return copy;
+  }
+
+  static SQLStatement* cloneInsert(const InsertStatement* insert, std::vector<Expr*>* parameters) {
+    InsertStatement* copy = new InsertStatement(insert->type);
+    copy->schema = cloneString(insert->schema);
+    copy->tableName = cloneString(insert->tableName);
+    copy->columns = cloneStrings(insert->columns);
+    copy->values = cloneExprs(insert->values, parameters);
+    copy->rows = cloneRows(insert->rows, parameters);
+    copy->select = cloneSelect(insert->select, parameters);
+    return copy;
+  }
+
+  static SQLStatement* cloneUpdate(const UpdateStatement* update, std::vector<Expr*>* parameters) {
+    UpdateStatement* copy = new UpdateStatement();
+    copy->table = cloneTable(update->table, parameters);
+    copy->where = cloneExpr(update->where, parameters);
+
+    if (update->updates != nullptr) {
+      copy->updates = newVector<UpdateClause*>();
+      copy->updates->reserve(update->updates->size());
+      for (const UpdateClause* clause : *update->updates) {
+        UpdateClause* clauseCopy = new UpdateClause();
+        clauseCopy->column = cloneString(clause->column);
+        clauseCopy->value = cloneExpr(clause->value, parameters);
+        copy->updates->push_back(clauseCopy);
+      }
+    }
+    return copy;
+  }
+
+  static SQLStatement* cloneCreate(const CreateStatement* create, std::vector<Expr*>* parameters) {
+    CreateStatement* copy = new CreateStatement(create->type);
+    copy->ifNotExists = create->ifNotExists;
+    copy->filePath = cloneString(create->filePath);
+    copy->schema = cloneString(create->schema);
+    copy->tableName = cloneString(create->tableName);
+    copy->viewColumns = cloneStrings(create->viewColumns);
+    copy->select = cloneSelect(create->select, parameters);
+
+    if (create->columns != nullptr) {
+      copy->columns = newVector<ColumnDefinition*>();
+      copy->columns->reserve(create->columns->size());
+      for (const ColumnDefinition* column : *create->columns) {
+        copy->columns->push_back(new ColumnDefinition(cloneString(column->name), column->type));
+      }
+    }
+    return copy;
+  }
+
+  SQLStatement* cloneStatement(const SQLStatement* stmt, std::vector<Expr*>* parameters) {
+    SQLStatement* copy = nullptr;
+    switch (stmt->type()) {
+      case kStmtSelect:
+        // Copies the hints of the statement, too.
+        return cloneSelect((const SelectStatement*) stmt, parameters);
+      case kStmtImport: {
+        const ImportStatement* import = (const ImportStatement*) stmt;
+        ImportStatement* importCopy = new ImportStatement(import->type);
+        importCopy->filePath = cloneString(import->filePath);
+        importCopy->schema = cloneString(import->schema);
+        importCopy->tableName = cloneString(import->tableName);
+        copy = importCopy;
+        break;
+      }
+      case kStmtInsert:
+        copy = cloneInsert((const InsertStatement*) stmt, parameters);
+        break;
+      case kStmtUpdate:
+        copy = cloneUpdate((const UpdateStatement*) stmt, parameters);
+        break;
+      case kStmtDelete: {
+        const DeleteStatement* del = (const DeleteStatement*) stmt;
+        DeleteStatement* deleteCopy = new DeleteStatement();
+        deleteCopy->schema = cloneString(del->schema);
+        deleteCopy->tableName = cloneString(del->tableName);
+        deleteCopy->expr = cloneExpr(del->expr, parameters);
+        copy = deleteCopy;
+        break;
+      }
+      case kStmtCreate:
+        copy = cloneCreate((const CreateStatement*) stmt, parameters);
+        break;
+      case kStmtDrop: {
+        const DropStatement* drop = (const DropStatement*) stmt;
+        DropStatement* dropCopy = new DropStatement(drop->type);
+        dropCopy->ifExists = drop->ifExists;
+        dropCopy->schema = cloneString(drop->schema);
+        dropCopy->name = cloneString(drop->name);
+        copy = dropCopy;
+        break;
+      }
+      case kStmtPrepare: {
+        const PrepareStatement* prepare = (const PrepareStatement*) stmt;
+        PrepareStatement* prepareCopy = new PrepareStatement();
+        prepareCopy->name = cloneString(prepare->name);
+        prepareCopy->query = cloneString(prepare->query);
+        if (prepare->prepared != nullptr) {
+          SQLParserResult* prepared = new SQLParserResult();
+          prepare->prepared->clone(prepared);
+          prepareCopy->setPrepared(prepared);
+        }
+        copy = prepareCopy;
+        break;
+      }
+      case kStmtExecute: {
+        const ExecuteStatement* execute = (const ExecuteStatement*) stmt;
+        ExecuteStatement* executeCopy = new ExecuteStatement();
+        executeCopy->name = cloneString(execute->name);
+        executeCopy->parameters = cloneExprs(execute->parameters, parameters);
+        copy = executeCopy;
+        break;
+      }
+      case kStmtShow: {
+        const ShowStatement* show = (const ShowStatement*) stmt;
+        ShowStatement* showCopy = new ShowStatement(show->type);
+        showCopy->schema = cloneString(show->schema);
+        showCopy->name = cloneString(show->name);
+        copy = showCopy;
+        break;
+      }
+      default:
+        return nullptr;
+    }
+
+    copy->hints = cloneExprs(stmt->hints, parameters);
+    return copy;
+  }
+
+} // namespace hsql
@@ -0,0 +1,20 @@
+#ifndef __SQLPARSER__CLONE_H__
+#define __SQLPARSER__CLONE_H__
+
+#include "../sql/statements.h"
+
+namespace hsql {
+
+  // Returns a deep copy of the statement that shares no nodes or strings
+  // with it. Like parsed nodes, the copy is allocated from the current arena
+  // (see ArenaScope), or from the heap if there is none.
+  // The placeholders in the copy are appended to parameters, if given.
+  // Returns nullptr for statement types the parser does not create.
+  SQLStatement* cloneStatement(const SQLStatement* stmt, std::vector<Expr*>* parameters = nullptr);
+
+  // Returns a deep copy of the expression. See cloneStatement.
+  Expr* cloneExpr(const Expr* expr, std::vector<Expr*>* parameters = nullptr);
+
+} // namespace hsql
+
+#endif
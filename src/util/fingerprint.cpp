@@ -0,0 +1,121 @@
+#include "fingerprint.h"
+#include "../parser/bison_parser.h"
+
+namespace hsql {
+
+  const uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+  const uint64_t kFnvPrime = 0x100000001b3ull;
+
+  // All literals and placeholders are hashed as a placeholder.
+  const int kPlaceholder = '?';
+
+  Fingerprint::Fingerprint() :
+    hash_(kFnvOffsetBasis),
+    pendingSemicolon_(false),
+    pendingComma_(false),
+    pendingMinus_(false),
+    previous_(0),
+    depth_(0) {}
+
+  static uint64_t hashText(uint64_t h, const char* text, size_t length, bool foldCase) {
+    for (size_t i = 0; i < length; ++i) {
+      unsigned char c = text[i];
+      if (foldCase && c >= 'A' && c <= 'Z') c |= 0x20;
+      h = (h ^ c) * kFnvPrime;
+    }
+    // Separates the token from the next one.
+    return h * kFnvPrime;
+  }
+
+  void Fingerprint::hash(const char* text, size_t length, bool foldCase) {
+    hash_ = hashText(hash_, text, length, foldCase);
+  }
+
+  void Fingerprint::hashPending(char token) {
+    hash(&token, 1, false);
+    previous_ = token;
+  }
+
+  void Fingerprint::addToken(int token, const char* text, size_t length) {
+    bool number = token == SQL_INTVAL || token == SQL_FLOATVAL;
+    bool constant = number || token == SQL_STRING || token == '?';
+
+    if (token == ';' || token == ',' || token == '-') {
+      // A comma stays pending before a minus, which might start a literal.
+      bool keepComma = token == '-' && pendingComma_ && !pendingMinus_;
+      if (pendingSemicolon_) hashPending(';');
+      if (pendingComma_ && !keepComma) hashPending(',');
+      if (pendingMinus_) hashPending('-');
+      pendingSemicolon_ = pendingMinus_ = false;
+      pendingComma_ = keepComma;
+
+      if (token == ',' && (inLists_.empty() || inLists_.back() != depth_)) {
+        hashPending(',');
+        return;
+      }
+
+      pendingSemicolon_ = token == ';';
+      pendingComma_ = pendingComma_ || token == ',';
+      pendingMinus_ = token == '-';
+      return;
+    }
+
+    // A minus directly before a number is its sign.
+    bool literal = pendingMinus_ ? number : constant;
+
+    if (pendingSemicolon_) hashPending(';');
+    if (pendingComma_) {
+      // Further literals of an IN list are dropped.
+      if (literal && previous_ == kPlaceholder) {
+        pendingComma_ = pendingMinus_ = false;
+        return;
+      }
+      hashPending(',');
+    }
+    if (pendingMinus_ && !number) hashPending('-');
+    pendingSemicolon_ = pendingComma_ = pendingMinus_ = false;
+
+    if (constant) {
+      hash("?", 1, false);
+      previous_ = kPlaceholder;
+      return;
+    }
+
+    if (token == SQL_IDENTIFIER) {
+      // Identifiers are marked, so that they never match a keyword.
+      // Quoted identifiers keep their case.
+      hash_ = (hash_ ^ '"') * kFnvPrime;
+      if (length >= 2 && text[0] == '"') {
+        hash(text + 1, length - 2, false);
+      } else {
+        hash(text, length, true);
+      }
+    } else if (token == SQL_NOTEQUALS) {
+      hash("<>", 2, false);
+    } else {
+      hash(text, length, true);
+    }
+
+    if (token == '(') {
+      ++depth_;
+      if (previous_ == SQL_IN) inLists_.push_back(depth_);
+    } else if (token == ')') {
+      if (!inLists_.empty() && inLists_.back() == depth_) inLists_.pop_back();
+      if (depth_ > 0) --depth_;
+    } else if (token == SQL_SELECT && previous_ == '(' &&
+               !inLists_.empty() && inLists_.back() == depth_) {
+      // IN (SELECT ...) is a subquery, not a list.
+      inLists_.pop_back();
+    }
+    previous_ = token;
+  }
+
+  uint64_t Fingerprint::digest() const {
+    // A trailing comma or minus is hashed, a trailing semicolon is not.
+    uint64_t h = hash_;
+    if (pendingComma_) h = hashText(h, ",", 1, false);
+    if (pendingMinus_) h = hashText(h, "-", 1, false);
+    return h;
+  }
+
+} // namespace hsql
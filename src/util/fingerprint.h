@@ -0,0 +1,60 @@
+#ifndef __SQLPARSER__FINGERPRINT_H__
+#define __SQLPARSER__FINGERPRINT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace hsql {
+
+  // Computes the fingerprint of a query from its tokens, so that queries
+  // that only differ in their literals share a fingerprint.
+  // The token stream is normalized before it is hashed:
+  //  - Literals and placeholders are replaced by a placeholder. A minus
+  //    sign before a number is part of the literal.
+  //  - Lists of literals within IN (...) are collapsed into one placeholder.
+  //  - Unquoted identifiers are compared case-insensitively.
+  //  - A trailing semicolon is ignored.
+  //  - Keywords are compared case-insensitively and != is the same as <>.
+  // Whitespace and comments are not tokens. The digest is a 64-bit FNV-1a
+  // hash of the normalized token texts, so it does not depend on the
+  // platform or on the token numbers of the parser.
+  class Fingerprint {
+   public:
+    Fingerprint();
+
+    // Adds the next token of the query. text points to the length
+    // characters of the token in the query.
+    void addToken(int token, const char* text, size_t length);
+
+    // Returns the digest of the tokens added so far.
+    uint64_t digest() const;
+
+   private:
+    // Hashes the text of a token, followed by a separator.
+    // Letters are lowercased if foldCase is true.
+    void hash(const char* text, size_t length, bool foldCase);
+
+    // Hashes a token that was held back.
+    void hashPending(char token);
+
+    uint64_t hash_;
+
+    // Tokens that are held back until the next token is known. A semicolon
+    // might be the last token, a comma might be followed by a literal that
+    // is collapsed and a minus might be the sign of a number.
+    bool pendingSemicolon_;
+    bool pendingComma_;
+    bool pendingMinus_;
+
+    // Last token that was hashed (a literal if it was replaced).
+    int previous_;
+
+    // Parenthesis depth and the depths at which IN lists of literals are open.
+    size_t depth_;
+    std::vector<size_t> inLists_;
+  };
+
+} // namespace hsql
+
+#endif
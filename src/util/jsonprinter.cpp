@@ -157,11 +157,21 @@ namespace hsql {
       break;
     }
 
-    if (expr->exprList != nullptr) {
-      for (Expr* e : *expr->exprList) {
+    // The operands are printed as a list, whichever fields hold them.
+    for (size_t i = 0; i < expr->numOperands(); ++i) {
+      Json::Value exp;
+      jsonPrintExpression(expr->operand(i), exp);
+      root["exprList"].append(exp);
+    }
+
+    // Typed IN lists are printed like lists of literals.
+    if (expr->opType == kOpIn && expr->exprList == nullptr && expr->inValues != nullptr) {
+      for (size_t i = 0; i < expr->inValues->size(); ++i) {
+        Expr* literal = expr->inValues->makeLiteral(i);
         Json::Value exp;
-        jsonPrintExpression(e, exp);
+        jsonPrintExpression(literal, exp);
         root["exprList"].append(exp);
+        delete literal;
       }
     }
 
@@ -196,6 +206,9 @@ namespace hsql {
       root["type"] = "kExprLiteralString";
       root["name"] = expr->name;
       break;
+    case kExprLiteralNull:
+      root["type"] = "kExprLiteralNull";
+      break;
     case kExprFunctionRef:
       root["type"] = "kExprFunctionRef";
       root["distinct"] = expr->distinct;
@@ -228,11 +241,11 @@ namespace hsql {
       break;
     case kExprArrayIndex:
       root["type"] = "kExprArrayIndex";
-      // jsonPrintExpression(expr->expr, root["expr"]);
+      jsonPrintExpression(expr->expr, root["expr"]);
       root["ival"] = (Json::Value::Int64)expr->ival;
       break;
     default:
-      std::cerr << "Unrecognized expression type " << expr->type << std::endl;
+      std::cerr << "Unrecognized expression type " << (int) expr->type << std::endl;
       return;
     }
     if (expr->alias != nullptr) {
@@ -240,6 +253,25 @@ namespace hsql {
     }
   }
 
+  void jsonPrintOrderAndLimit(const std::vector<OrderDescription*>* order, const LimitDescription* limit, Json::Value& root) {
+    if (order != nullptr) {
+
+      for (OrderDescription* desc : *order) {
+        Json::Value val;
+        jsonPrintExpression(desc->expr, val);
+        if(desc->type == kOrderAsc)
+          val["ascending"] = true;
+        else val["ascending"] = false;
+
+        root["order"].append(val);
+      }
+    }
+
+    if (limit != nullptr) {
+      root["limit"] = (Json::Value::Int64)limit->limit;
+    }
+  }
+
   void jsonPrintSelectStatementInfo(const SelectStatement* stmt, Json::Value& root) {
     root["selectDistinct"] = stmt->selectDistinct;
     for (Expr* expr : *stmt->selectList) {
@@ -267,25 +299,28 @@ namespace hsql {
       }
     }
 
-    if (stmt->unionSelect != nullptr) {
-      jsonPrintSelectStatementInfo(stmt->unionSelect, root["unionSelect"]);
-    }
-
-    if (stmt->order != nullptr) {
+    jsonPrintOrderAndLimit(stmt->order, stmt->limit, root);
 
-      for (OrderDescription* order : *stmt->order) {
-        Json::Value val;
-        jsonPrintExpression(order->expr, val);
-        if(order->type == kOrderAsc)
-          val["ascending"] = true;
-        else val["ascending"] = false;
+    if (stmt->setOperation != nullptr) {
+      jsonPrintSetOperation(stmt->setOperation, root["setOperation"]);
+    }
+  }
 
-        root["order"].append(val);
+  void jsonPrintSetOperation(const SetOperation* operation, Json::Value& root) {
+    for (const SetBranch& branch : *operation->branches) {
+      Json::Value val;
+      switch (branch.type) {
+        case kSetUnion: val["type"] = "UNION"; break;
+        case kSetIntersect: val["type"] = "INTERSECT"; break;
+        case kSetExcept: val["type"] = "EXCEPT"; break;
       }
+      val["all"] = branch.all;
+      jsonPrintSelectStatementInfo(branch.select, val["select"]);
+      root["branches"].append(val);
     }
-
-    if (stmt->limit != nullptr) {
-      root["limit"] = (Json::Value::Int64)stmt->limit->limit;
+    jsonPrintOrderAndLimit(operation->order, operation->limit, root);
+    if (operation->nested != nullptr) {
+      jsonPrintSetOperation(operation->nested, root["nested"]);
     }
   }
 
@@ -311,11 +346,31 @@ namespace hsql {
     }
     switch (stmt->type) {
     case kInsertValues:
-
-      for (Expr* expr : *stmt->values) {
-        Json::Value val;
-        jsonPrintExpression(expr, val);
-        root["values"].append(val);
+      if (stmt->values != nullptr) {
+        for (Expr* expr : *stmt->values) {
+          Json::Value val;
+          jsonPrintExpression(expr, val);
+          root["values"].append(val);
+        }
+      }
+      if (stmt->rows != nullptr) {
+        const ValuesBlock* rows = stmt->rows;
+        for (size_t row = 0; row < rows->numRows; ++row) {
+          Json::Value values;
+          for (size_t column = 0; column < rows->numColumns(); ++column) {
+            const ValuesColumn& cells = rows->columns->at(column);
+            Json::Value val;
+            if (cells.type == kValuesExpr && !cells.isNull(row)) {
+              jsonPrintExpression(cells.cells[row].expr, val);
+            } else {
+              Expr* literal = rows->makeLiteral(row, column);
+              jsonPrintExpression(literal, val);
+              delete literal;
+            }
+            values.append(val);
+          }
+          root["rows"].append(values);
+        }
       }
       break;
     case kInsertSelect:
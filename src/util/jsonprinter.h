@@ -13,6 +13,9 @@ namespace hsql {
   // Prints a summary of the given SelectStatement
   void jsonPrintSelectStatementInfo(const SelectStatement* stmt, Json::Value& root);
 
+  // Prints a summary of the given chain of set operations
+  void jsonPrintSetOperation(const SetOperation* operation, Json::Value& root);
+
   // Prints a summary of the given ImportStatement
   void jsonPrintImportStatementInfo(const ImportStatement* stmt, Json::Value& root);
 
@@ -0,0 +1,218 @@
+#include "parameterize.h"
+
+namespace hsql {
+
+  namespace {
+
+    // Walks the expressions of a statement in the order of the query.
+    // Expressions, selects and tables are kept on one stack, so that nested
+    // queries and long operator chains do not recurse. Children are pushed
+    // in reverse, so that they are visited from left to right.
+    class LiteralParameterizer {
+     public:
+      LiteralParameterizer(size_t firstId, std::vector<Expr*>* parameters, std::vector<Expr*>* literals) :
+        nextId_(firstId),
+        parameters_(parameters),
+        literals_(literals) {}
+
+      void run(SQLStatement* stmt) {
+        pushStatement(stmt);
+
+        while (!pending_.empty()) {
+          Task task = pending_.back();
+          pending_.pop_back();
+          switch (task.kind) {
+            case Task::kExpr:
+              visitExpr(task.expr);
+              break;
+            case Task::kSelect:
+              visitSelect(task.select);
+              break;
+            case Task::kTable:
+              visitTable(task.table);
+              break;
+          }
+        }
+      }
+
+     private:
+      struct Task {
+        enum Kind { kExpr, kSelect, kTable } kind;
+        union {
+          Expr** expr;
+          SelectStatement* select;
+          TableRef* table;
+        };
+      };
+
+      void push(Expr** expr) {
+        if (*expr == nullptr) return;
+        Task task;
+        task.kind = Task::kExpr;
+        task.expr = expr;
+        pending_.push_back(task);
+      }
+
+      void push(std::vector<Expr*>* exprs) {
+        if (exprs == nullptr) return;
+        for (size_t i = exprs->size(); i > 0; --i) push(&exprs->at(i - 1));
+      }
+
+      void push(SelectStatement* select) {
+        if (select == nullptr) return;
+        Task task;
+        task.kind = Task::kSelect;
+        task.select = select;
+        pending_.push_back(task);
+      }
+
+      void push(TableRef* table) {
+        if (table == nullptr) return;
+        Task task;
+        task.kind = Task::kTable;
+        task.table = table;
+        pending_.push_back(task);
+      }
+
+      // Pushes ORDER BY and GROUP BY items, except for plain positions.
+      void pushItem(Expr** expr) {
+        if (*expr != nullptr && (*expr)->type != kExprLiteralInt) push(expr);
+      }
+
+      void pushStatement(SQLStatement* stmt) {
+        switch (stmt->type()) {
+          case kStmtSelect:
+            push((SelectStatement*) stmt);
+            break;
+          case kStmtInsert: {
+            InsertStatement* insert = (InsertStatement*) stmt;
+            push(insert->select);
+            push(insert->values);
+            pushRows(insert->rows);
+            break;
+          }
+          case kStmtUpdate: {
+            UpdateStatement* update = (UpdateStatement*) stmt;
+            push(&update->where);
+            if (update->updates != nullptr) {
+              for (size_t i = update->updates->size(); i > 0; --i) {
+                push(&update->updates->at(i - 1)->value);
+              }
+            }
+            push(update->table);
+            break;
+          }
+          case kStmtDelete:
+            push(&((DeleteStatement*) stmt)->expr);
+            break;
+          case kStmtCreate:
+            push(((CreateStatement*) stmt)->select);
+            break;
+          case kStmtExecute:
+            push(((ExecuteStatement*) stmt)->parameters);
+            break;
+          default:
+            break;
+        }
+      }
+
+      void visitExpr(Expr** slot) {
+        Expr* expr = *slot;
+        switch (expr->type) {
+          case kExprLiteralInt:
+          case kExprLiteralFloat:
+          case kExprLiteralString: {
+            Expr* parameter = Expr::makeParameter(nextId_++);
+            parameter->ival2 = parameter->ival;
+            parameter->alias = expr->alias;
+            expr->alias = nullptr;
+            parameters_->push_back(parameter);
+            literals_->push_back(expr);
+            *slot = parameter;
+            return;
+          }
+          case kExprParameter:
+            // Bound values of placeholders are not part of the query.
+            return;
+          case kExprOperator:
+            // Values of typed IN lists become placeholders one by one.
+            if (expr->opType == kOpIn) expr->expandInList();
+            break;
+          default:
+            break;
+        }
+
+        push(expr->select);
+        push(expr->exprList);
+        push(&expr->expr3);
+        push(&expr->expr2);
+        push(&expr->expr);
+      }
+
+      // Pushes the values of all rows, row by row.
+      void pushRows(ValuesBlock* rows) {
+        if (rows == nullptr) return;
+        rows->expandColumns();
+        for (size_t row = rows->numRows; row > 0; --row) {
+          for (size_t column = rows->numColumns(); column > 0; --column) {
+            push(&rows->columns->at(column - 1).cells[row - 1].expr);
+          }
+        }
+      }
+
+      void pushOrder(std::vector<OrderDescription*>* order) {
+        if (order == nullptr) return;
+        for (size_t i = order->size(); i > 0; --i) pushItem(&order->at(i - 1)->expr);
+      }
+
+      void visitSelect(SelectStatement* select) {
+        // The branches of a chain follow those of the chain nested in it.
+        for (SetOperation* operation = select->setOperation; operation != nullptr;
+             operation = operation->nested) {
+          pushOrder(operation->order);
+          for (size_t i = operation->branches->size(); i > 0; --i) {
+            push(operation->branches->at(i - 1).select);
+          }
+        }
+        pushOrder(select->order);
+        if (select->groupBy != nullptr) {
+          push(&select->groupBy->having);
+          if (select->groupBy->columns != nullptr) {
+            for (size_t i = select->groupBy->columns->size(); i > 0; --i) {
+              pushItem(&select->groupBy->columns->at(i - 1));
+            }
+          }
+        }
+        push(&select->whereClause);
+        push(select->fromTable);
+        push(select->selectList);
+      }
+
+      void visitTable(TableRef* table) {
+        if (table->join != nullptr) {
+          push(&table->join->condition);
+          push(table->join->right);
+          push(table->join->left);
+        }
+        if (table->list != nullptr) {
+          for (size_t i = table->list->size(); i > 0; --i) push(table->list->at(i - 1));
+        }
+        push(table->select);
+      }
+
+      size_t nextId_;
+      std::vector<Expr*>* parameters_;
+      std::vector<Expr*>* literals_;
+      std::vector<Task> pending_;
+    };
+
+  } // namespace
+
+  void parameterizeLiterals(SQLStatement* stmt, size_t firstId, std::vector<Expr*>* parameters,
+                            std::vector<Expr*>* literals) {
+    // New placeholders are allocated like the nodes of the statement.
+    ArenaScope scope(stmt->arena());
+    LiteralParameterizer(firstId, parameters, literals).run(stmt);
+  }
+
+} // namespace hsql
@@ -0,0 +1,24 @@
+#ifndef __SQLPARSER__PARAMETERIZE_H__
+#define __SQLPARSER__PARAMETERIZE_H__
+
+#include "../sql/statements.h"
+
+namespace hsql {
+
+  // Replaces the integer, float and string literals in the statement by
+  // placeholders, so that queries that only differ in their literals share
+  // the same statement template.
+  // Each new placeholder takes over the alias of the literal it replaced,
+  // but not the literal itself. The placeholders are appended to parameters
+  // in the order of the query and numbered from firstId on. The literals
+  // are appended to literals in the same order and are owned by the caller.
+  // Literals in hints and positions in ORDER BY and GROUP BY (ORDER BY 1)
+  // are kept, since they are not values. NULL is kept as well.
+  // The values of inserts of more than one row (InsertStatement::rows)
+  // are moved to expressions first (see ValuesBlock::expandColumns).
+  void parameterizeLiterals(SQLStatement* stmt, size_t firstId, std::vector<Expr*>* parameters,
+                            std::vector<Expr*>* literals);
+
+} // namespace hsql
+
+#endif
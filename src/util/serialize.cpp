@@ -0,0 +1,1260 @@
+#include "serialize.h"
+#include "../SQLParserResult.h"
+#include <string.h>
+#include <unordered_map>
+
+namespace hsql {
+
+  namespace {
+
+    // Writes the records of an image into a buffer.
+    // Leaves (strings, nested selects) are written before the record that
+    // refers to them. Children of expressions and tables are written after
+    // their parent from a worklist, since operator chains and joins can be
+    // arbitrarily deep. References are therefore filled in by their offset
+    // in the buffer, which moves as it grows.
+    class ImageWriter {
+     public:
+      explicit ImageWriter(std::string* buffer) : buffer_(buffer) {}
+
+      // Returns false and clears the buffer if the image is too large.
+      bool writeImage(const SQLParserResult& result) {
+        buffer_->clear();
+        size_t header = allocate(sizeof(binary::Header));
+        size_t encoded = writeResult(result);
+
+        // References of larger images were truncated by link.
+        if (buffer_->size() > binary::kMaxSize) {
+          buffer_->clear();
+          return false;
+        }
+
+        binary::Header* record = at<binary::Header>(header);
+        record->magic = binary::kMagic;
+        record->version = binary::kVersion;
+        record->byteOrder = binary::kByteOrder;
+        record->size = buffer_->size();
+        setRef(record->result, encoded);
+        return true;
+      }
+
+     private:
+      // Appends size zeroed bytes, 8-byte aligned, and returns their offset.
+      size_t allocate(size_t size) {
+        size_t offset = (buffer_->size() + 7) & ~size_t(7);
+        buffer_->resize(offset + size);
+        return offset;
+      }
+
+      // Returns the record at the given offset. Valid until the next allocation.
+      template <typename T>
+      T* at(size_t offset) {
+        return (T*) &(*buffer_)[offset];
+      }
+
+      // Returns the offset of a field of a record in the buffer.
+      size_t field(const void* ref) const {
+        return (const char*) ref - buffer_->data();
+      }
+
+      // Points the reference at offset field to the record at offset target.
+      void link(size_t field, size_t target) {
+        if (target == 0) return;
+        int32_t offset = (int32_t) (target - field);
+        memcpy(&(*buffer_)[field], &offset, sizeof(offset));
+      }
+
+      template <typename T>
+      void setRef(binary::Ref<T>& ref, size_t target) {
+        link(field(&ref), target);
+      }
+
+      // Allocates a list of size items and returns its offset.
+      template <typename T>
+      size_t allocateList(size_t size) {
+        size_t offset = allocate(sizeof(binary::List<T>) + size * sizeof(T));
+        at<binary::List<T>>(offset)->size = size;
+        return offset;
+      }
+
+      // Returns the offset of an item of a list.
+      template <typename T>
+      static size_t item(size_t list, size_t index) {
+        return list + sizeof(binary::List<T>) + index * sizeof(T);
+      }
+
+      size_t writeString(const char* str) {
+        if (str == nullptr) return 0;
+        size_t offset = buffer_->size();
+        buffer_->append(str, strlen(str) + 1);
+        return offset;
+      }
+
+      size_t writeStrings(const std::vector<char*>* strings) {
+        if (strings == nullptr) return 0;
+        size_t list = allocateList<binary::String>(strings->size());
+        for (size_t i = 0; i < strings->size(); ++i) {
+          link(item<binary::String>(list, i), writeString(strings->at(i)));
+        }
+        return list;
+      }
+
+      // Writes the cells of a column into the record at offset column.
+      void writeValues(const ValuesColumn& values, size_t column) {
+        size_t cellsField = field(&at<binary::ValuesColumn>(column)->cells);
+        size_t nullsField = field(&at<binary::ValuesColumn>(column)->nulls);
+        at<binary::ValuesColumn>(column)->type = values.type;
+
+        size_t cells = allocateList<binary::Cell>(values.cells.size());
+        link(cellsField, cells);
+        if (values.type == kValuesString || values.type == kValuesExpr) {
+          for (size_t i = 0; i < values.cells.size(); ++i) {
+            const ValuesCell& cell = values.cells[i];
+            size_t target = values.type == kValuesString ? writeString(cell.sval) : writeExpr(cell.expr);
+            link(item<binary::Cell>(cells, i), target);
+          }
+        } else if (!values.cells.empty()) {
+          memcpy(&(*buffer_)[item<binary::Cell>(cells, 0)], values.cells.data(), values.cells.size() * sizeof(binary::Cell));
+        }
+
+        // The NULL bitmap is left out if there are no NULL values.
+        bool hasNulls = false;
+        for (uint64_t word : values.nulls) hasNulls |= word != 0;
+        if (hasNulls) {
+          size_t nulls = allocateList<uint64_t>(values.nulls.size());
+          link(nullsField, nulls);
+          memcpy(&(*buffer_)[item<uint64_t>(nulls, 0)], values.nulls.data(), values.nulls.size() * sizeof(uint64_t));
+        }
+      }
+
+      size_t writeExpr(const Expr* expr) {
+        if (expr == nullptr) return 0;
+        size_t root = 0;
+        size_t base = pendingExprs_.size();
+        pendingExprs_.emplace_back(expr, 0);
+
+        while (pendingExprs_.size() > base) {
+          const Expr* source = pendingExprs_.back().first;
+          size_t target = pendingExprs_.back().second;
+          pendingExprs_.pop_back();
+
+          size_t name = writeString(source->name);
+          size_t table = writeString(source->table);
+          size_t alias = writeString(source->alias);
+          size_t select = writeSelect(source->select);
+          bool typedIn = source->type == kExprOperator && source->opType == kOpIn && source->inValues != nullptr;
+          // The decoded string has no spare capacity (see Expr::ival2).
+          int64_t ival2 = source->type == kExprLiteralString ? 0 : source->ival2;
+          size_t inValues = 0;
+          if (typedIn) {
+            inValues = allocate(sizeof(binary::ValuesColumn));
+            writeValues(*source->inValues, inValues);
+          }
+
+          size_t offset = allocate(sizeof(binary::Expr));
+          if (target == 0) {
+            root = offset;
+          } else {
+            link(target, offset);
+          }
+          if (source->type == kExprParameter) parameters_[source] = offset;
+
+          binary::Expr* record = at<binary::Expr>(offset);
+          setRef(record->name, name);
+          if (source->type == kExprLiteralFloat) {
+            record->fval = source->fval;
+          } else if (!typedIn) {
+            record->ival = source->ival;
+          }
+          record->type = source->type;
+          record->opType = source->opType;
+          record->distinct = source->distinct;
+          if (source->expr != nullptr) pendingExprs_.emplace_back(source->expr, field(&record->expr));
+          if (source->expr2 != nullptr) pendingExprs_.emplace_back(source->expr2, field(&record->expr2));
+
+          bool hasTail = source->expr3 != nullptr || source->exprList != nullptr || select != 0 || table != 0 ||
+                         alias != 0 || inValues != 0 || ival2 != 0;
+          if (!hasTail) continue;
+          size_t tailField = field(&record->tail);
+          size_t tail = allocate(sizeof(binary::ExprTail));
+          link(tailField, tail);
+
+          binary::ExprTail* tailRecord = at<binary::ExprTail>(tail);
+          setRef(tailRecord->select, select);
+          setRef(tailRecord->table, table);
+          setRef(tailRecord->alias, alias);
+          setRef(tailRecord->inValues, inValues);
+          tailRecord->ival2 = ival2;
+          if (source->expr3 != nullptr) pendingExprs_.emplace_back(source->expr3, field(&tailRecord->expr3));
+          if (source->exprList != nullptr) {
+            size_t listField = field(&tailRecord->exprList);
+            size_t list = allocateList<binary::Ref<binary::Expr>>(source->exprList->size());
+            link(listField, list);
+            for (size_t i = 0; i < source->exprList->size(); ++i) {
+              pendingExprs_.emplace_back(source->exprList->at(i), item<binary::Ref<binary::Expr>>(list, i));
+            }
+          }
+        }
+        return root;
+      }
+
+      size_t writeExprs(const std::vector<Expr*>* exprs) {
+        if (exprs == nullptr) return 0;
+        size_t list = allocateList<binary::Ref<binary::Expr>>(exprs->size());
+        for (size_t i = 0; i < exprs->size(); ++i) {
+          link(item<binary::Ref<binary::Expr>>(list, i), writeExpr(exprs->at(i)));
+        }
+        return list;
+      }
+
+      size_t writeTable(const TableRef* table) {
+        if (table == nullptr) return 0;
+        size_t root = 0;
+        size_t base = pendingTables_.size();
+        pendingTables_.emplace_back(table, 0);
+
+        while (pendingTables_.size() > base) {
+          const TableRef* source = pendingTables_.back().first;
+          size_t target = pendingTables_.back().second;
+          pendingTables_.pop_back();
+
+          size_t schema = writeString(source->schema);
+          size_t name = writeString(source->name);
+          size_t alias = writeString(source->alias);
+          size_t select = writeSelect(source->select);
+
+          size_t offset = allocate(sizeof(binary::TableRef));
+          if (target == 0) {
+            root = offset;
+          } else {
+            link(target, offset);
+          }
+
+          binary::TableRef* record = at<binary::TableRef>(offset);
+          setRef(record->schema, schema);
+          setRef(record->name, name);
+          setRef(record->alias, alias);
+          setRef(record->select, select);
+          record->type = source->type;
+          size_t listField = field(&record->list);
+          size_t joinField = field(&record->join);
+
+          if (source->list != nullptr) {
+            size_t list = allocateList<binary::Ref<binary::TableRef>>(source->list->size());
+            link(listField, list);
+            for (size_t i = 0; i < source->list->size(); ++i) {
+              pendingTables_.emplace_back(source->list->at(i), item<binary::Ref<binary::TableRef>>(list, i));
+            }
+          }
+
+          if (source->join != nullptr) {
+            size_t condition = writeExpr(source->join->condition);
+            size_t join = allocate(sizeof(binary::Join));
+            link(joinField, join);
+            binary::Join* joinRecord = at<binary::Join>(join);
+            setRef(joinRecord->condition, condition);
+            joinRecord->type = source->join->type;
+            if (source->join->left != nullptr) pendingTables_.emplace_back(source->join->left, field(&joinRecord->left));
+            if (source->join->right != nullptr) pendingTables_.emplace_back(source->join->right, field(&joinRecord->right));
+          }
+        }
+        return root;
+      }
+
+      size_t writeOrder(const std::vector<OrderDescription*>* order) {
+        if (order == nullptr) return 0;
+        size_t list = allocateList<binary::Order>(order->size());
+        for (size_t i = 0; i < order->size(); ++i) {
+          size_t expr = writeExpr(order->at(i)->expr);
+          binary::Order* record = at<binary::Order>(item<binary::Order>(list, i));
+          setRef(record->expr, expr);
+          record->type = order->at(i)->type;
+        }
+        return list;
+      }
+
+      size_t writeLimit(const LimitDescription* limit) {
+        if (limit == nullptr) return 0;
+        size_t offset = allocate(sizeof(binary::Limit));
+        at<binary::Limit>(offset)->limit = limit->limit;
+        at<binary::Limit>(offset)->offset = limit->offset;
+        return offset;
+      }
+
+      size_t writeSetOperation(const SetOperation* operation) {
+        if (operation == nullptr) return 0;
+        size_t branches = allocateList<binary::SetBranch>(operation->branches->size());
+        for (size_t i = 0; i < operation->branches->size(); ++i) {
+          const SetBranch& branch = operation->branches->at(i);
+          size_t select = writeSelect(branch.select);
+          binary::SetBranch* record = at<binary::SetBranch>(item<binary::SetBranch>(branches, i));
+          setRef(record->select, select);
+          record->type = branch.type;
+          record->all = branch.all;
+        }
+        size_t order = writeOrder(operation->order);
+        size_t limit = writeLimit(operation->limit);
+        size_t nested = writeSetOperation(operation->nested);
+
+        size_t offset = allocate(sizeof(binary::SetOperation));
+        binary::SetOperation* record = at<binary::SetOperation>(offset);
+        setRef(record->branches, branches);
+        setRef(record->order, order);
+        setRef(record->limit, limit);
+        setRef(record->nested, nested);
+        return offset;
+      }
+
+      size_t writeSelect(const SelectStatement* select) {
+        if (select == nullptr) return 0;
+        size_t hints = writeExprs(select->hints);
+        size_t fromTable = writeTable(select->fromTable);
+        size_t selectList = writeExprs(select->selectList);
+        size_t whereClause = writeExpr(select->whereClause);
+        size_t groupBy = 0;
+        if (select->groupBy != nullptr) {
+          size_t columns = writeExprs(select->groupBy->columns);
+          size_t having = writeExpr(select->groupBy->having);
+          groupBy = allocate(sizeof(binary::GroupBy));
+          setRef(at<binary::GroupBy>(groupBy)->columns, columns);
+          setRef(at<binary::GroupBy>(groupBy)->having, having);
+        }
+        size_t order = writeOrder(select->order);
+        size_t limit = writeLimit(select->limit);
+        size_t setOperation = writeSetOperation(select->setOperation);
+
+        size_t offset = allocate(sizeof(binary::Select));
+        binary::Select* record = at<binary::Select>(offset);
+        record->type = kStmtSelect;
+        setRef(record->hints, hints);
+        setRef(record->fromTable, fromTable);
+        setRef(record->selectList, selectList);
+        setRef(record->whereClause, whereClause);
+        setRef(record->groupBy, groupBy);
+        setRef(record->order, order);
+        setRef(record->limit, limit);
+        setRef(record->setOperation, setOperation);
+        record->selectDistinct = select->selectDistinct;
+        return offset;
+      }
+
+      size_t writeRows(const ValuesBlock* rows) {
+        if (rows == nullptr) return 0;
+        size_t columns = allocateList<binary::ValuesColumn>(rows->columns->size());
+        for (size_t i = 0; i < rows->columns->size(); ++i) {
+          writeValues(rows->columns->at(i), item<binary::ValuesColumn>(columns, i));
+        }
+        size_t offset = allocate(sizeof(binary::ValuesBlock));
+        setRef(at<binary::ValuesBlock>(offset)->columns, columns);
+        at<binary::ValuesBlock>(offset)->numRows = rows->numRows;
+        return offset;
+      }
+
+      // Allocates the record of a statement with the given hints.
+      template <typename T>
+      T* allocateStatement(const SQLStatement* stmt, size_t hints, size_t* offset) {
+        *offset = allocate(sizeof(T));
+        T* record = at<T>(*offset);
+        record->type = stmt->type();
+        setRef(record->hints, hints);
+        return record;
+      }
+
+      size_t writeStatement(const SQLStatement* stmt) {
+        if (stmt->type() == kStmtSelect) return writeSelect((const SelectStatement*) stmt);
+
+        size_t hints = writeExprs(stmt->hints);
+        size_t offset = 0;
+        switch (stmt->type()) {
+          case kStmtImport: {
+            const ImportStatement* import = (const ImportStatement*) stmt;
+            size_t filePath = writeString(import->filePath);
+            size_t schema = writeString(import->schema);
+            size_t tableName = writeString(import->tableName);
+            binary::Import* record = allocateStatement<binary::Import>(stmt, hints, &offset);
+            setRef(record->filePath, filePath);
+            setRef(record->schema, schema);
+            setRef(record->tableName, tableName);
+            record->importType = import->type;
+            break;
+          }
+          case kStmtInsert: {
+            const InsertStatement* insert = (const InsertStatement*) stmt;
+            size_t schema = writeString(insert->schema);
+            size_t tableName = writeString(insert->tableName);
+            size_t columns = writeStrings(insert->columns);
+            size_t values = writeExprs(insert->values);
+            size_t rows = writeRows(insert->rows);
+            size_t select = writeSelect(insert->select);
+            binary::Insert* record = allocateStatement<binary::Insert>(stmt, hints, &offset);
+            setRef(record->schema, schema);
+            setRef(record->tableName, tableName);
+            setRef(record->columns, columns);
+            setRef(record->values, values);
+            setRef(record->rows, rows);
+            setRef(record->select, select);
+            record->insertType = insert->type;
+            break;
+          }
+          case kStmtUpdate: {
+            const UpdateStatement* update = (const UpdateStatement*) stmt;
+            size_t table = writeTable(update->table);
+            size_t where = writeExpr(update->where);
+            size_t updates = 0;
+            if (update->updates != nullptr) {
+              updates = allocateList<binary::UpdateClause>(update->updates->size());
+              for (size_t i = 0; i < update->updates->size(); ++i) {
+                size_t column = writeString(update->updates->at(i)->column);
+                size_t value = writeExpr(update->updates->at(i)->value);
+                binary::UpdateClause* clause = at<binary::UpdateClause>(item<binary::UpdateClause>(updates, i));
+                setRef(clause->column, column);
+                setRef(clause->value, value);
+              }
+            }
+            binary::Update* record = allocateStatement<binary::Update>(stmt, hints, &offset);
+            setRef(record->table, table);
+            setRef(record->updates, updates);
+            setRef(record->where, where);
+            break;
+          }
+          case kStmtDelete: {
+            const DeleteStatement* del = (const DeleteStatement*) stmt;
+            size_t schema = writeString(del->schema);
+            size_t tableName = writeString(del->tableName);
+            size_t expr = writeExpr(del->expr);
+            binary::Delete* record = allocateStatement<binary::Delete>(stmt, hints, &offset);
+            setRef(record->schema, schema);
+            setRef(record->tableName, tableName);
+            setRef(record->expr, expr);
+            break;
+          }
+          case kStmtCreate: {
+            const CreateStatement* create = (const CreateStatement*) stmt;
+            size_t filePath = writeString(create->filePath);
+            size_t schema = writeString(create->schema);
+            size_t tableName = writeString(create->tableName);
+            size_t viewColumns = writeStrings(create->viewColumns);
+            size_t select = writeSelect(create->select);
+            size_t columns = 0;
+            if (create->columns != nullptr) {
+              columns = allocateList<binary::ColumnDefinition>(create->columns->size());
+              for (size_t i = 0; i < create->columns->size(); ++i) {
+                size_t name = writeString(create->columns->at(i)->name);
+                binary::ColumnDefinition* column = at<binary::ColumnDefinition>(item<binary::ColumnDefinition>(columns, i));
+                setRef(column->name, name);
+                column->type = create->columns->at(i)->type;
+              }
+            }
+            binary::Create* record = allocateStatement<binary::Create>(stmt, hints, &offset);
+            setRef(record->filePath, filePath);
+            setRef(record->schema, schema);
+            setRef(record->tableName, tableName);
+            setRef(record->columns, columns);
+            setRef(record->viewColumns, viewColumns);
+            setRef(record->select, select);
+            record->createType = create->type;
+            record->ifNotExists = create->ifNotExists;
+            break;
+          }
+          case kStmtDrop: {
+            const DropStatement* drop = (const DropStatement*) stmt;
+            size_t schema = writeString(drop->schema);
+            size_t name = writeString(drop->name);
+            binary::Drop* record = allocateStatement<binary::Drop>(stmt, hints, &offset);
+            setRef(record->schema, schema);
+            setRef(record->name, name);
+            record->dropType = drop->type;
+            record->ifExists = drop->ifExists;
+            break;
+          }
+          case kStmtPrepare: {
+            const PrepareStatement* prepare = (const PrepareStatement*) stmt;
+            size_t name = writeString(prepare->name);
+            size_t query = writeString(prepare->query);
+            size_t prepared = prepare->prepared != nullptr ? writeResult(*prepare->prepared) : 0;
+            binary::Prepare* record = allocateStatement<binary::Prepare>(stmt, hints, &offset);
+            setRef(record->name, name);
+            setRef(record->query, query);
+            setRef(record->prepared, prepared);
+            break;
+          }
+          case kStmtExecute: {
+            const ExecuteStatement* execute = (const ExecuteStatement*) stmt;
+            size_t name = writeString(execute->name);
+            size_t parameters = writeExprs(execute->parameters);
+            binary::Execute* record = allocateStatement<binary::Execute>(stmt, hints, &offset);
+            setRef(record->name, name);
+            setRef(record->parameters, parameters);
+            break;
+          }
+          case kStmtShow: {
+            const ShowStatement* show = (const ShowStatement*) stmt;
+            size_t schema = writeString(show->schema);
+            size_t name = writeString(show->name);
+            binary::Show* record = allocateStatement<binary::Show>(stmt, hints, &offset);
+            setRef(record->schema, schema);
+            setRef(record->name, name);
+            record->showType = show->type;
+            break;
+          }
+          default:
+            break;
+        }
+        return offset;
+      }
+
+      size_t writeResult(const SQLParserResult& result) {
+        const std::vector<SQLStatement*>& statements = result.getStatements();
+        size_t list = allocateList<binary::Ref<binary::Statement>>(statements.size());
+        for (size_t i = 0; i < statements.size(); ++i) {
+          link(item<binary::Ref<binary::Statement>>(list, i), writeStatement(statements[i]));
+        }
+
+        const std::vector<Expr*>& parameters = result.parameters();
+        size_t parameterList = allocateList<binary::Ref<binary::Expr>>(parameters.size());
+        for (size_t i = 0; i < parameters.size(); ++i) {
+          auto found = parameters_.find(parameters[i]);
+          if (found != parameters_.end()) {
+            link(item<binary::Ref<binary::Expr>>(parameterList, i), found->second);
+          }
+        }
+
+        size_t errorMsg = writeString(result.errorMsg());
+        size_t offset = allocate(sizeof(binary::Result));
+        binary::Result* record = at<binary::Result>(offset);
+        setRef(record->statements, list);
+        setRef(record->parameters, parameterList);
+        setRef(record->errorMsg, errorMsg);
+        record->errorLine = result.errorLine();
+        record->errorColumn = result.errorColumn();
+        record->errorOffset = result.errorOffset();
+        record->isValid = result.isValid();
+        return offset;
+      }
+
+      std::string* buffer_;
+
+      // Nodes whose record still has to be written, with the offset of the
+      // reference to it.
+      std::vector<std::pair<const Expr*, size_t>> pendingExprs_;
+      std::vector<std::pair<const TableRef*, size_t>> pendingTables_;
+
+      // Offsets of the records of placeholders.
+      std::unordered_map<const Expr*, size_t> parameters_;
+    };
+
+    // Decodes the records of an image into AST nodes, like clone.
+    class ImageReader {
+     public:
+      // Appends the statements of the result to statements and its
+      // placeholders to parameters, in the order of the encoded result.
+      void readResult(const binary::Result* encoded, std::vector<SQLStatement*>* statements, std::vector<Expr*>* parameters) {
+        if (encoded->statements) {
+          statements->reserve(statements->size() + encoded->statements->size);
+          for (const binary::Ref<binary::Statement>& statement : *encoded->statements) {
+            if (!statement) continue;
+            SQLStatement* decoded = decodeStatement(statement.get());
+            if (decoded != nullptr) statements->push_back(decoded);
+          }
+        }
+
+        // Placeholders are matched to their records, since numbered
+        // placeholders ($1) can share an id.
+        if (encoded->parameters) {
+          std::unordered_map<const binary::Expr*, Expr*> decoded(parameters_.begin(), parameters_.end());
+          for (const binary::Ref<binary::Expr>& parameter : *encoded->parameters) {
+            auto found = decoded.find(parameter.get());
+            if (found != decoded.end()) parameters->push_back(found->second);
+          }
+        }
+      }
+
+      // Appends the placeholders decoded so far to parameters.
+      void takeParameters(std::vector<Expr*>* parameters) {
+        for (const std::pair<const binary::Expr*, Expr*>& parameter : parameters_) {
+          parameters->push_back(parameter.second);
+        }
+      }
+
+      SQLStatement* decodeStatement(const binary::Statement* stmt);
+
+     private:
+      static char* decodeString(const binary::String& str) {
+        return str ? copyString(str.get()) : nullptr;
+      }
+
+      std::vector<char*>* decodeStrings(const binary::Ref<binary::List<binary::String>>& strings) {
+        if (!strings) return nullptr;
+        std::vector<char*>* copy = newVector<char*>();
+        copy->reserve(strings->size);
+        for (const binary::String& str : *strings) {
+          copy->push_back(decodeString(str));
+        }
+        return copy;
+      }
+
+      std::vector<Expr*>* decodeExprs(const binary::Ref<binary::List<binary::Ref<binary::Expr>>>& exprs) {
+        if (!exprs) return nullptr;
+        std::vector<Expr*>* copy = newVector<Expr*>();
+        copy->reserve(exprs->size);
+        for (const binary::Ref<binary::Expr>& expr : *exprs) {
+          copy->push_back(decodeExpr(expr.get()));
+        }
+        return copy;
+      }
+
+      void decodeValues(const binary::ValuesColumn& values, ValuesColumn* copy) {
+        copy->type = (ValuesType) values.type;
+        size_t size = values.cells->size;
+        copy->cells.resize(size);
+        if (copy->type == kValuesString || copy->type == kValuesExpr) {
+          for (size_t i = 0; i < size; ++i) {
+            const binary::Cell& cell = (*values.cells)[i];
+            if (copy->type == kValuesString) {
+              copy->cells[i].sval = decodeString(cell.sval);
+            } else {
+              copy->cells[i].expr = decodeExpr(cell.expr.get());
+            }
+          }
+        } else if (size > 0) {
+          memcpy(copy->cells.data(), values.cells->begin(), size * sizeof(ValuesCell));
+        }
+
+        if (values.nulls) {
+          copy->nulls.assign(values.nulls->begin(), values.nulls->end());
+        } else {
+          copy->nulls.assign((size + 63) / 64, 0);
+        }
+      }
+
+      Expr* decodeExpr(const binary::Expr* expr) {
+        // Like cloneExpr, from a worklist.
+        Expr* root = nullptr;
+        std::vector<std::pair<const binary::Expr*, Expr**>> pending;
+        if (expr != nullptr) pending.emplace_back(expr, &root);
+
+        while (!pending.empty()) {
+          const binary::Expr* source = pending.back().first;
+          Expr** target = pending.back().second;
+          pending.pop_back();
+
+          Expr* copy = new Expr((ExprType) source->type);
+          *target = copy;
+          const binary::ExprTail& tail = source->rest();
+          copy->name = decodeString(source->name);
+          copy->table = decodeString(tail.table);
+          copy->alias = decodeString(tail.alias);
+          copy->opType = (OperatorType) source->opType;
+          copy->distinct = source->distinct;
+          copy->ival2 = tail.ival2;
+          if (copy->type == kExprLiteralFloat) {
+            copy->fval = source->fval;
+          } else if (copy->type == kExprOperator && copy->opType == kOpIn) {
+            // ival shares its storage with inValues.
+            if (tail.inValues) {
+              copy->inValues = newObject<ValuesColumn>();
+              decodeValues(*tail.inValues, copy->inValues);
+            }
+          } else {
+            copy->ival = source->ival;
+          }
+          copy->select = decodeSelect(tail.select.get());
+
+          if (source->expr) pending.emplace_back(source->expr.get(), &copy->expr);
+          if (source->expr2) pending.emplace_back(source->expr2.get(), &copy->expr2);
+          if (tail.expr3) pending.emplace_back(tail.expr3.get(), &copy->expr3);
+          if (tail.exprList) {
+            const binary::List<binary::Ref<binary::Expr>>& list = *tail.exprList;
+            copy->exprList = newVector<Expr*>();
+            copy->exprList->resize(list.size);
+            for (size_t i = 0; i < list.size; ++i) {
+              pending.emplace_back(list[i].get(), &copy->exprList->at(i));
+            }
+          }
+
+          if (copy->type == kExprParameter) parameters_.emplace_back(source, copy);
+        }
+        return root;
+      }
+
+      TableRef* decodeTable(const binary::TableRef* table) {
+        // Like cloneTable, from a worklist.
+        TableRef* root = nullptr;
+        std::vector<std::pair<const binary::TableRef*, TableRef**>> pending;
+        if (table != nullptr) pending.emplace_back(table, &root);
+
+        while (!pending.empty()) {
+          const binary::TableRef* source = pending.back().first;
+          TableRef** target = pending.back().second;
+          pending.pop_back();
+
+          TableRef* copy = new TableRef((TableRefType) source->type);
+          *target = copy;
+          copy->schema = decodeString(source->schema);
+          copy->name = decodeString(source->name);
+          copy->alias = decodeString(source->alias);
+          copy->select = decodeSelect(source->select.get());
+
+          if (source->list) {
+            const binary::List<binary::Ref<binary::TableRef>>& list = *source->list;
+            copy->list = newVector<TableRef*>();
+            copy->list->resize(list.size);
+            for (size_t i = 0; i < list.size; ++i) {
+              pending.emplace_back(list[i].get(), &copy->list->at(i));
+            }
+          }
+
+          if (source->join) {
+            const binary::Join& join = *source->join;
+            copy->join = new JoinDefinition();
+            copy->join->type = (JoinType) join.type;
+            copy->join->condition = decodeExpr(join.condition.get());
+            if (join.left) pending.emplace_back(join.left.get(), &copy->join->left);
+            if (join.right) pending.emplace_back(join.right.get(), &copy->join->right);
+          }
+        }
+        return root;
+      }
+
+      std::vector<OrderDescription*>* decodeOrder(const binary::Ref<binary::List<binary::Order>>& order) {
+        if (!order) return nullptr;
+        std::vector<OrderDescription*>* copy = newVector<OrderDescription*>();
+        copy->reserve(order->size);
+        for (const binary::Order& desc : *order) {
+          copy->push_back(new OrderDescription((OrderType) desc.type, decodeExpr(desc.expr.get())));
+        }
+        return copy;
+      }
+
+      LimitDescription* decodeLimit(const binary::Ref<binary::Limit>& limit) {
+        return limit ? new LimitDescription(limit->limit, limit->offset) : nullptr;
+      }
+
+      SelectStatement* decodeSelect(const binary::Select* select) {
+        if (select == nullptr) return nullptr;
+        SelectStatement* copy = new SelectStatement();
+        copy->hints = decodeExprs(select->hints);
+        copy->fromTable = decodeTable(select->fromTable.get());
+        copy->selectDistinct = select->selectDistinct;
+        copy->selectList = decodeExprs(select->selectList);
+        copy->whereClause = decodeExpr(select->whereClause.get());
+
+        if (select->groupBy) {
+          copy->groupBy = new GroupByDescription();
+          copy->groupBy->columns = decodeExprs(select->groupBy->columns);
+          copy->groupBy->having = decodeExpr(select->groupBy->having.get());
+        }
+
+        copy->order = decodeOrder(select->order);
+        copy->limit = decodeLimit(select->limit);
+
+        copy->setOperation = decodeSetOperation(select->setOperation.get());
+        return copy;
+      }
+
+      SetOperation* decodeSetOperation(const binary::SetOperation* operation) {
+        if (operation == nullptr) return nullptr;
+        SetOperation* copy = new SetOperation();
+        copy->branches->reserve(operation->branches->size);
+        for (const binary::SetBranch& branch : *operation->branches) {
+          copy->branches->push_back({(SetType) branch.type, (bool) branch.all, decodeSelect(branch.select.get())});
+        }
+        copy->order = decodeOrder(operation->order);
+        copy->limit = decodeLimit(operation->limit);
+        copy->nested = decodeSetOperation(operation->nested.get());
+        return copy;
+      }
+
+      SQLStatement* decodeInsert(const binary::Insert* insert) {
+        InsertStatement* copy = new InsertStatement((InsertType) insert->insertType);
+        copy->schema = decodeString(insert->schema);
+        copy->tableName = decodeString(insert->tableName);
+        copy->columns = decodeStrings(insert->columns);
+        copy->values = decodeExprs(insert->values);
+        copy->select = decodeSelect(insert->select.get());
+
+        if (insert->rows) {
+          const binary::List<binary::ValuesColumn>& columns = *insert->rows->columns;
+          copy->rows = new ValuesBlock();
+          copy->rows->numRows = insert->rows->numRows;
+          copy->rows->columns->resize(columns.size);
+          for (size_t i = 0; i < columns.size; ++i) {
+            decodeValues(columns[i], &copy->rows->columns->at(i));
+          }
+        }
+        return copy;
+      }
+
+      SQLStatement* decodeUpdate(const binary::Update* update) {
+        UpdateStatement* copy = new UpdateStatement();
+        copy->table = decodeTable(update->table.get());
+        copy->where = decodeExpr(update->where.get());
+
+        if (update->updates) {
+          copy->updates = newVector<UpdateClause*>();
+          copy->updates->reserve(update->updates->size);
+          for (const binary::UpdateClause& clause : *update->updates) {
+            UpdateClause* clauseCopy = new UpdateClause();
+            clauseCopy->column = decodeString(clause.column);
+            clauseCopy->value = decodeExpr(clause.value.get());
+            copy->updates->push_back(clauseCopy);
+          }
+        }
+        return copy;
+      }
+
+      SQLStatement* decodeCreate(const binary::Create* create) {
+        CreateStatement* copy = new CreateStatement((CreateType) create->createType);
+        copy->ifNotExists = create->ifNotExists;
+        copy->filePath = decodeString(create->filePath);
+        copy->schema = decodeString(create->schema);
+        copy->tableName = decodeString(create->tableName);
+        copy->viewColumns = decodeStrings(create->viewColumns);
+        copy->select = decodeSelect(create->select.get());
+
+        if (create->columns) {
+          copy->columns = newVector<ColumnDefinition*>();
+          copy->columns->reserve(create->columns->size);
+          for (const binary::ColumnDefinition& column : *create->columns) {
+            copy->columns->push_back(new ColumnDefinition(decodeString(column.name), (ColumnDefinition::DataType) column.type));
+          }
+        }
+        return copy;
+      }
+
+      // Decoded placeholders and their records.
+      std::vector<std::pair<const binary::Expr*, Expr*>> parameters_;
+    };
+
+    SQLStatement* ImageReader::decodeStatement(const binary::Statement* stmt) {
+      SQLStatement* copy = nullptr;
+      switch (stmt->type) {
+        case kStmtSelect:
+          // Decodes the hints of the statement, too.
+          return decodeSelect((const binary::Select*) stmt);
+        case kStmtImport: {
+          const binary::Import* import = (const binary::Import*) stmt;
+          ImportStatement* importCopy = new ImportStatement((ImportType) import->importType);
+          importCopy->filePath = decodeString(import->filePath);
+          importCopy->schema = decodeString(import->schema);
+          importCopy->tableName = decodeString(import->tableName);
+          copy = importCopy;
+          break;
+        }
+        case kStmtInsert:
+          copy = decodeInsert((const binary::Insert*) stmt);
+          break;
+        case kStmtUpdate:
+          copy = decodeUpdate((const binary::Update*) stmt);
+          break;
+        case kStmtDelete: {
+          const binary::Delete* del = (const binary::Delete*) stmt;
+          DeleteStatement* deleteCopy = new DeleteStatement();
+          deleteCopy->schema = decodeString(del->schema);
+          deleteCopy->tableName = decodeString(del->tableName);
+          deleteCopy->expr = decodeExpr(del->expr.get());
+          copy = deleteCopy;
+          break;
+        }
+        case kStmtCreate:
+          copy = decodeCreate((const binary::Create*) stmt);
+          break;
+        case kStmtDrop: {
+          const binary::Drop* drop = (const binary::Drop*) stmt;
+          DropStatement* dropCopy = new DropStatement((DropType) drop->dropType);
+          dropCopy->ifExists = drop->ifExists;
+          dropCopy->schema = decodeString(drop->schema);
+          dropCopy->name = decodeString(drop->name);
+          copy = dropCopy;
+          break;
+        }
+        case kStmtPrepare: {
+          const binary::Prepare* prepare = (const binary::Prepare*) stmt;
+          PrepareStatement* prepareCopy = new PrepareStatement();
+          prepareCopy->name = decodeString(prepare->name);
+          prepareCopy->query = decodeString(prepare->query);
+          if (prepare->prepared) {
+            SQLParserResult* prepared = new SQLParserResult();
+            prepared->deserialize(prepare->prepared.get());
+            prepareCopy->setPrepared(prepared);
+          }
+          copy = prepareCopy;
+          break;
+        }
+        case kStmtExecute: {
+          const binary::Execute* execute = (const binary::Execute*) stmt;
+          ExecuteStatement* executeCopy = new ExecuteStatement();
+          executeCopy->name = decodeString(execute->name);
+          executeCopy->parameters = decodeExprs(execute->parameters);
+          copy = executeCopy;
+          break;
+        }
+        case kStmtShow: {
+          const binary::Show* show = (const binary::Show*) stmt;
+          ShowStatement* showCopy = new ShowStatement((ShowType) show->showType);
+          showCopy->schema = decodeString(show->schema);
+          showCopy->name = decodeString(show->name);
+          copy = showCopy;
+          break;
+        }
+        default:
+          return nullptr;
+      }
+
+      copy->hints = decodeExprs(stmt->hints);
+      return copy;
+    }
+
+    // Checks the references of an image before it is read, see binary::verify.
+    // Follows the records like ImageReader. Every reference it follows is a
+    // distinct field in an image of ImageWriter, so following more references
+    // than fit into the image means that they form a cycle.
+    class ImageVerifier {
+     public:
+      ImageVerifier(const char* data, size_t size) : data_(data), size_(size), budget_(size / sizeof(int32_t)), depth_(0) {}
+
+      bool verifyResult(const binary::Ref<binary::Result>& result) {
+        if (!result || !checkRecord(result) || !checkString(result->errorMsg)) return false;
+        if (!enter()) return false;
+
+        const binary::Result& record = *result;
+        if (!checkList(record.statements) || !checkList(record.parameters)) return false;
+        if (record.statements) {
+          for (const binary::Ref<binary::Statement>& statement : *record.statements) {
+            if (!verifyStatement(statement)) return false;
+          }
+        }
+        if (record.parameters) {
+          // The ids of placeholders index the slots of the result, see
+          // SQLParserResult::addParameter. Unnumbered and parameterized
+          // placeholders count up from the highest numbered one.
+          int64_t maxId = SQLParserResult::kMaxParameterNumber + record.parameters->size;
+          for (const binary::Ref<binary::Expr>& parameter : *record.parameters) {
+            if (!verifyExpr(parameter)) return false;
+            if (parameter && (parameter->ival < 0 || parameter->ival >= maxId)) return false;
+          }
+        }
+        return leave();
+      }
+
+     private:
+      // Nested selects are checked recursively, like they are decoded.
+      // Parsed statements nest far less deeply (see YYMAXDEPTH).
+      static const size_t kMaxDepth = 10000;
+
+      bool enter() {
+        return ++depth_ <= kMaxDepth;
+      }
+
+      bool leave() {
+        --depth_;
+        return true;
+      }
+
+      // Returns the offset of the target of a reference in the image, or
+      // size_ if it is outside of it.
+      size_t target(const void* ref, int32_t offset) {
+        if (budget_ == 0) return size_;
+        --budget_;
+        int64_t position = (int64_t) ((const char*) ref - data_) + offset;
+        return position >= 0 && (uint64_t) position < size_ ? (size_t) position : size_;
+      }
+
+      // Returns whether the record that a non-null reference refers to is
+      // aligned and has size bytes within the image.
+      bool checkRecord(const void* ref, int32_t offset, size_t size) {
+        size_t position = target(ref, offset);
+        return position % 8 == 0 && position <= size_ && size <= size_ - position;
+      }
+
+      template <typename T>
+      bool checkRecord(const binary::Ref<T>& ref) {
+        return !ref || checkRecord(&ref, ref.offset, sizeof(T));
+      }
+
+      template <typename T>
+      bool checkList(const binary::Ref<binary::List<T>>& ref) {
+        if (!checkRecord(ref)) return false;
+        if (!ref) return true;
+        size_t items = (const char*) ref->begin() - data_;
+        return ref->size <= (size_ - items) / sizeof(T);
+      }
+
+      bool checkString(const binary::String& str) {
+        if (!str) return true;
+        size_t position = target(&str, str.offset);
+        return position < size_ && memchr(data_ + position, '\0', size_ - position) != nullptr;
+      }
+
+      bool checkStrings(const binary::Ref<binary::List<binary::String>>& strings) {
+        if (!checkList(strings)) return false;
+        if (!strings) return true;
+        for (const binary::String& str : *strings) {
+          if (!checkString(str)) return false;
+        }
+        return true;
+      }
+
+      // Checks that the column has a NULL bit per cell.
+      bool verifyValues(const binary::ValuesColumn& values) {
+        if (!values.cells || !checkList(values.cells) || !checkList(values.nulls)) return false;
+        if (values.nulls && values.nulls->size != (values.cells->size + 63) / 64) return false;
+        if (values.type == kValuesString || values.type == kValuesExpr) {
+          for (const binary::Cell& cell : *values.cells) {
+            if (values.type == kValuesString ? !checkString(cell.sval) : !verifyExpr(cell.expr)) return false;
+          }
+        }
+        return true;
+      }
+
+      bool verifyExprs(const binary::Ref<binary::List<binary::Ref<binary::Expr>>>& exprs) {
+        if (!checkList(exprs)) return false;
+        if (!exprs) return true;
+        for (const binary::Ref<binary::Expr>& expr : *exprs) {
+          if (!verifyExpr(expr)) return false;
+        }
+        return true;
+      }
+
+      bool verifyExpr(const binary::Ref<binary::Expr>& expr) {
+        // Like ImageReader::decodeExpr, from a worklist.
+        if (!checkRecord(expr)) return false;
+        if (!expr) return true;
+        size_t base = pendingExprs_.size();
+        pendingExprs_.push_back(expr.get());
+
+        while (pendingExprs_.size() > base) {
+          const binary::Expr* source = pendingExprs_.back();
+          pendingExprs_.pop_back();
+          if (!checkString(source->name) || !checkRecord(source->tail)) return false;
+          if (!checkRecord(source->expr) || !checkRecord(source->expr2)) return false;
+          if (source->expr) pendingExprs_.push_back(source->expr.get());
+          if (source->expr2) pendingExprs_.push_back(source->expr2.get());
+          if (!source->tail) continue;
+
+          const binary::ExprTail& tail = *source->tail;
+          if (!checkString(tail.table) || !checkString(tail.alias)) return false;
+          if (!checkRecord(tail.inValues) || !checkRecord(tail.expr3) || !checkList(tail.exprList)) return false;
+          if (tail.inValues && !verifyValues(*tail.inValues)) return false;
+          if (tail.select && !verifySelect(tail.select)) return false;
+          if (tail.expr3) pendingExprs_.push_back(tail.expr3.get());
+          if (tail.exprList) {
+            for (const binary::Ref<binary::Expr>& item : *tail.exprList) {
+              if (!item || !checkRecord(item)) return false;
+              pendingExprs_.push_back(item.get());
+            }
+          }
+        }
+        return true;
+      }
+
+      bool verifyTable(const binary::Ref<binary::TableRef>& table) {
+        // Like ImageReader::decodeTable, from a worklist.
+        if (!checkRecord(table)) return false;
+        if (!table) return true;
+        size_t base = pendingTables_.size();
+        pendingTables_.push_back(table.get());
+
+        while (pendingTables_.size() > base) {
+          const binary::TableRef* source = pendingTables_.back();
+          pendingTables_.pop_back();
+          if (!checkString(source->schema) || !checkString(source->name) || !checkString(source->alias)) return false;
+          if (!checkRecord(source->select) || !checkList(source->list) || !checkRecord(source->join)) return false;
+          if (source->select && !verifySelect(source->select)) return false;
+
+          if (source->list) {
+            for (const binary::Ref<binary::TableRef>& item : *source->list) {
+              if (!item || !checkRecord(item)) return false;
+              pendingTables_.push_back(item.get());
+            }
+          }
+
+          if (source->join) {
+            const binary::Join& join = *source->join;
+            if (!checkRecord(join.left) || !checkRecord(join.right) || !verifyExpr(join.condition)) return false;
+            if (join.left) pendingTables_.push_back(join.left.get());
+            if (join.right) pendingTables_.push_back(join.right.get());
+          }
+        }
+        return true;
+      }
+
+      bool verifyOrder(const binary::Ref<binary::List<binary::Order>>& order) {
+        if (!checkList(order)) return false;
+        if (!order) return true;
+        for (const binary::Order& desc : *order) {
+          if (!verifyExpr(desc.expr)) return false;
+        }
+        return true;
+      }
+
+      bool verifySetOperation(const binary::Ref<binary::SetOperation>& operation) {
+        if (!checkRecord(operation)) return false;
+        if (!operation) return true;
+        if (!enter()) return false;
+        if (!operation->branches || !checkList(operation->branches)) return false;
+        for (const binary::SetBranch& branch : *operation->branches) {
+          if (!verifySelect(branch.select)) return false;
+        }
+        if (!verifyOrder(operation->order) || !checkRecord(operation->limit)) return false;
+        if (!verifySetOperation(operation->nested)) return false;
+        return leave();
+      }
+
+      bool verifySelect(const binary::Ref<binary::Select>& select) {
+        return checkRecord(select) && (!select || verifySelectFields(*select));
+      }
+
+      // Checks the fields of a select whose record has been checked already.
+      bool verifySelectFields(const binary::Select& select) {
+        if (!enter()) return false;
+        if (!verifyExprs(select.hints) || !verifyTable(select.fromTable) || !verifyExprs(select.selectList)) return false;
+        if (!verifyExpr(select.whereClause) || !checkRecord(select.groupBy)) return false;
+        if (select.groupBy && (!verifyExprs(select.groupBy->columns) || !verifyExpr(select.groupBy->having))) return false;
+        if (!verifyOrder(select.order) || !checkRecord(select.limit)) return false;
+        if (!verifySetOperation(select.setOperation)) return false;
+        return leave();
+      }
+
+      // Returns whether the record of a statement of the given type fits
+      // into the image, too. Statements of unknown types are skipped when
+      // they are decoded.
+      bool fits(const binary::Statement* stmt, size_t size) {
+        size_t position = (const char*) stmt - data_;
+        return size <= size_ - position;
+      }
+
+      bool verifyStatement(const binary::Ref<binary::Statement>& statement) {
+        if (!checkRecord(statement)) return false;
+        if (!statement) return true;
+        const binary::Statement* stmt = statement.get();
+        switch (stmt->type) {
+          case kStmtSelect:
+            return fits(stmt, sizeof(binary::Select)) && verifySelectFields(*(const binary::Select*) stmt);
+          case kStmtImport: {
+            if (!fits(stmt, sizeof(binary::Import))) return false;
+            const binary::Import* import = (const binary::Import*) stmt;
+            if (!checkString(import->filePath) || !checkString(import->schema) || !checkString(import->tableName)) return false;
+            break;
+          }
+          case kStmtInsert: {
+            if (!fits(stmt, sizeof(binary::Insert))) return false;
+            const binary::Insert* insert = (const binary::Insert*) stmt;
+            if (!checkString(insert->schema) || !checkString(insert->tableName) || !checkStrings(insert->columns)) return false;
+            if (!verifyExprs(insert->values) || !verifySelect(insert->select) || !checkRecord(insert->rows)) return false;
+            if (insert->rows) {
+              const binary::ValuesBlock& rows = *insert->rows;
+              if (!rows.columns || !checkList(rows.columns)) return false;
+              for (const binary::ValuesColumn& column : *rows.columns) {
+                if (!verifyValues(column) || column.cells->size != rows.numRows) return false;
+              }
+            }
+            break;
+          }
+          case kStmtUpdate: {
+            if (!fits(stmt, sizeof(binary::Update))) return false;
+            const binary::Update* update = (const binary::Update*) stmt;
+            if (!verifyTable(update->table) || !verifyExpr(update->where) || !checkList(update->updates)) return false;
+            if (update->updates) {
+              for (const binary::UpdateClause& clause : *update->updates) {
+                if (!checkString(clause.column) || !verifyExpr(clause.value)) return false;
+              }
+            }
+            break;
+          }
+          case kStmtDelete: {
+            if (!fits(stmt, sizeof(binary::Delete))) return false;
+            const binary::Delete* del = (const binary::Delete*) stmt;
+            if (!checkString(del->schema) || !checkString(del->tableName) || !verifyExpr(del->expr)) return false;
+            break;
+          }
+          case kStmtCreate: {
+            if (!fits(stmt, sizeof(binary::Create))) return false;
+            const binary::Create* create = (const binary::Create*) stmt;
+            if (!checkString(create->filePath) || !checkString(create->schema) || !checkString(create->tableName)) return false;
+            if (!checkStrings(create->viewColumns) || !verifySelect(create->select) || !checkList(create->columns)) return false;
+            if (create->columns) {
+              for (const binary::ColumnDefinition& column : *create->columns) {
+                if (!checkString(column.name)) return false;
+              }
+            }
+            break;
+          }
+          case kStmtDrop: {
+            if (!fits(stmt, sizeof(binary::Drop))) return false;
+            const binary::Drop* drop = (const binary::Drop*) stmt;
+            if (!checkString(drop->schema) || !checkString(drop->name)) return false;
+            break;
+          }
+          case kStmtPrepare: {
+            if (!fits(stmt, sizeof(binary::Prepare))) return false;
+            const binary::Prepare* prepare = (const binary::Prepare*) stmt;
+            if (!checkString(prepare->name) || !checkString(prepare->query)) return false;
+            if (prepare->prepared && !verifyResult(prepare->prepared)) return false;
+            break;
+          }
+          case kStmtExecute: {
+            if (!fits(stmt, sizeof(binary::Execute))) return false;
+            const binary::Execute* execute = (const binary::Execute*) stmt;
+            if (!checkString(execute->name) || !verifyExprs(execute->parameters)) return false;
+            break;
+          }
+          case kStmtShow: {
+            if (!fits(stmt, sizeof(binary::Show))) return false;
+            const binary::Show* show = (const binary::Show*) stmt;
+            if (!checkString(show->schema) || !checkString(show->name)) return false;
+            break;
+          }
+          default:
+            return true;
+        }
+        return verifyExprs(stmt->hints);
+      }
+
+      const char* data_;
+      size_t size_;
+
+      // Number of references that may still be followed.
+      size_t budget_;
+      size_t depth_;
+
+      // Records whose fields still have to be checked.
+      std::vector<const binary::Expr*> pendingExprs_;
+      std::vector<const binary::TableRef*> pendingTables_;
+    };
+
+  } // namespace
+
+  namespace binary {
+
+    const Result* open(const void* data, size_t size) {
+      if (!verify(data, size)) return nullptr;
+      return ((const Header*) data)->result.get();
+    }
+
+    bool verify(const void* data, size_t size) {
+      if (data == nullptr || (uintptr_t) data % 8 != 0 || size < sizeof(Header)) return false;
+      const Header* header = (const Header*) data;
+      if (header->magic != kMagic || header->version != kVersion || header->byteOrder != kByteOrder) return false;
+      if (header->size > size || header->size < sizeof(Header)) return false;
+      return ImageVerifier((const char*) data, header->size).verifyResult(header->result);
+    }
+
+  } // namespace binary
+
+  bool serializeResult(const SQLParserResult& result, std::string* buffer) {
+    return ImageWriter(buffer).writeImage(result);
+  }
+
+  SQLStatement* decodeStatement(const binary::Statement* stmt, std::vector<Expr*>* parameters) {
+    ImageReader reader;
+    SQLStatement* decoded = reader.decodeStatement(stmt);
+    if (parameters != nullptr) reader.takeParameters(parameters);
+    return decoded;
+  }
+
+  void decodeResult(const binary::Result* encoded, std::vector<SQLStatement*>* statements, std::vector<Expr*>* parameters) {
+    ImageReader().readResult(encoded, statements, parameters);
+  }
+
+} // namespace hsql
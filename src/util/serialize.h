@@ -0,0 +1,349 @@
+#ifndef __SQLPARSER__SERIALIZE_H__
+#define __SQLPARSER__SERIALIZE_H__
+
+#include "../sql/statements.h"
+#include <string>
+
+namespace hsql {
+  class SQLParserResult;
+
+  // Compact binary image of a parse result, used to ship statements between
+  // processes. The image mirrors the AST with fixed-size records that refer
+  // to each other through offsets instead of pointers, so it can be read in
+  // place from a received or memory-mapped buffer without allocating.
+  //
+  // Records are 8-byte aligned relative to the start of the image, which
+  // therefore has to be 8-byte aligned in memory as well. Numbers are in the
+  // byte order of the writer, and open rejects images of the other byte
+  // order. open also checks that every reference, list and string stays
+  // within the image, so images of untrusted writers can be opened, too.
+  namespace binary {
+
+    const uint32_t kMagic = 0x4c515348; // "HSQL"
+    const uint16_t kVersion = 2;
+    const uint16_t kByteOrder = 0x0102;
+
+    // Size of the largest image, since references are signed 32-bit offsets.
+    const size_t kMaxSize = 0x7fffffff;
+
+    // Reference to a record, relative to the reference itself.
+    // An offset of zero is a null reference.
+    template <typename T>
+    struct Ref {
+      int32_t offset;
+
+      const T* get() const {
+        return offset != 0 ? (const T*) ((const char*) this + offset) : nullptr;
+      }
+
+      const T* operator->() const {
+        return get();
+      }
+
+      const T& operator*() const {
+        return *get();
+      }
+
+      explicit operator bool() const {
+        return offset != 0;
+      }
+    };
+
+    // Null-terminated string.
+    typedef Ref<char> String;
+
+    // Array of size items that directly follow the header.
+    template <typename T>
+    struct List {
+      uint32_t size;
+      uint32_t unused;
+
+      const T* begin() const {
+        return (const T*) (this + 1);
+      }
+
+      const T* end() const {
+        return begin() + size;
+      }
+
+      const T& operator[](size_t index) const {
+        return begin()[index];
+      }
+    };
+
+    struct Expr;
+    struct ExprTail;
+    struct Select;
+    struct Result;
+
+    // See ValuesCell. Cells of strings and expressions hold a reference.
+    union Cell {
+      int64_t ival;
+      double fval;
+      String sval;
+      Ref<Expr> expr;
+    };
+
+    // See hsql::ValuesColumn.
+    struct ValuesColumn {
+      Ref<List<Cell>> cells;
+      Ref<List<uint64_t>> nulls;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    // See hsql::Expr. Float literals keep their value in fval and all other
+    // expressions in ival. Most expressions are column references, literals
+    // and binary operators, so the record holds only the fields they use,
+    // and the others are moved to a tail that is left out if they are all
+    // null. This keeps the record at 32 bytes.
+    struct Expr {
+      Ref<Expr> expr;
+      Ref<Expr> expr2;
+      String name;
+      Ref<ExprTail> tail;
+      union {
+        int64_t ival;
+        double fval;
+      };
+      uint8_t type;
+      uint8_t opType;
+      uint8_t distinct;
+      uint8_t unused[5];
+
+      // Returns the tail, or an empty one if the expression has none.
+      const ExprTail& rest() const;
+    };
+
+    // Fields of an expression that are rarely set. IN operators with a typed
+    // list keep it in inValues.
+    struct ExprTail {
+      Ref<Expr> expr3;
+      Ref<List<Ref<Expr>>> exprList;
+      Ref<Select> select;
+      String table;
+      String alias;
+      Ref<ValuesColumn> inValues;
+      int64_t ival2;
+    };
+
+    inline const ExprTail& Expr::rest() const {
+      // Null references do not depend on their position, so they can be
+      // shared by all expressions.
+      static const ExprTail kEmpty = {};
+      return tail ? *tail : kEmpty;
+    }
+
+    struct Join;
+
+    struct TableRef {
+      String schema;
+      String name;
+      String alias;
+      Ref<Select> select;
+      Ref<List<Ref<TableRef>>> list;
+      Ref<Join> join;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    struct Join {
+      Ref<TableRef> left;
+      Ref<TableRef> right;
+      Ref<Expr> condition;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    // Common header of all statements. type is the StatementType.
+    struct Statement {
+      Ref<List<Ref<Expr>>> hints;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    struct Order {
+      Ref<Expr> expr;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    struct Limit {
+      int64_t limit;
+      int64_t offset;
+    };
+
+    struct GroupBy {
+      Ref<List<Ref<Expr>>> columns;
+      Ref<Expr> having;
+    };
+
+    struct SetBranch {
+      Ref<Select> select;
+      uint8_t type;
+      uint8_t all;
+      uint8_t unused[2];
+    };
+
+    struct SetOperation {
+      Ref<List<SetBranch>> branches;
+      Ref<List<Order>> order;
+      Ref<Limit> limit;
+      Ref<SetOperation> nested;
+    };
+
+    // Used for nested selects, too, which have no hints.
+    struct Select : Statement {
+      Ref<TableRef> fromTable;
+      Ref<List<Ref<Expr>>> selectList;
+      Ref<Expr> whereClause;
+      Ref<GroupBy> groupBy;
+      Ref<List<Order>> order;
+      Ref<Limit> limit;
+      Ref<SetOperation> setOperation;
+      uint8_t selectDistinct;
+      uint8_t unused[3];
+    };
+
+    struct Import : Statement {
+      String filePath;
+      String schema;
+      String tableName;
+      uint8_t importType;
+      uint8_t unused[3];
+    };
+
+    struct ColumnDefinition {
+      String name;
+      uint8_t type;
+      uint8_t unused[3];
+    };
+
+    struct Create : Statement {
+      String filePath;
+      String schema;
+      String tableName;
+      Ref<List<ColumnDefinition>> columns;
+      Ref<List<String>> viewColumns;
+      Ref<Select> select;
+      uint8_t createType;
+      uint8_t ifNotExists;
+      uint8_t unused[2];
+    };
+
+    struct ValuesBlock {
+      Ref<List<ValuesColumn>> columns;
+      uint32_t numRows;
+    };
+
+    struct Insert : Statement {
+      String schema;
+      String tableName;
+      Ref<List<String>> columns;
+      Ref<List<Ref<Expr>>> values;
+      Ref<ValuesBlock> rows;
+      Ref<Select> select;
+      uint8_t insertType;
+      uint8_t unused[3];
+    };
+
+    struct UpdateClause {
+      String column;
+      Ref<Expr> value;
+    };
+
+    struct Update : Statement {
+      Ref<TableRef> table;
+      Ref<List<UpdateClause>> updates;
+      Ref<Expr> where;
+    };
+
+    struct Delete : Statement {
+      String schema;
+      String tableName;
+      Ref<Expr> expr;
+    };
+
+    struct Drop : Statement {
+      String schema;
+      String name;
+      uint8_t dropType;
+      uint8_t ifExists;
+      uint8_t unused[2];
+    };
+
+    struct Prepare : Statement {
+      String name;
+      String query;
+      Ref<Result> prepared;
+    };
+
+    struct Execute : Statement {
+      String name;
+      Ref<List<Ref<Expr>>> parameters;
+    };
+
+    struct Show : Statement {
+      String schema;
+      String name;
+      uint8_t showType;
+      uint8_t unused[3];
+    };
+
+    // See SQLParserResult. The parameters refer to expressions within the
+    // statements.
+    struct Result {
+      Ref<List<Ref<Statement>>> statements;
+      Ref<List<Ref<Expr>>> parameters;
+      String errorMsg;
+      int32_t errorLine;
+      int32_t errorColumn;
+      int32_t errorOffset;
+      uint8_t isValid;
+      uint8_t unused[3];
+    };
+
+    // Start of an image.
+    struct Header {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t byteOrder;
+
+      // Size of the image in bytes.
+      uint32_t size;
+      Ref<Result> result;
+    };
+
+    // Returns the result in the image, or nullptr if data is not aligned or
+    // does not start with a complete and well-formed image of this version
+    // and byte order (see verify).
+    const Result* open(const void* data, size_t size);
+
+    // Returns whether data holds an image that open accepts. Besides the
+    // header, this checks that all references, lists and strings reachable
+    // from the result lie within the image, that the records they refer to
+    // are aligned and do not form cycles, and what decoding relies on, e.g.
+    // that an inserted column has a cell per row. Walks all records of the
+    // image, so it takes time linear in its size.
+    bool verify(const void* data, size_t size);
+
+  } // namespace binary
+
+  // Sets buffer to the binary image of the result. See SQLParserResult::serialize.
+  // Returns false and clears buffer if the image would be larger than
+  // binary::kMaxSize.
+  bool serializeResult(const SQLParserResult& result, std::string* buffer);
+
+  // Returns a statement decoded from its record. Like parsed nodes, the
+  // statement is allocated from the current arena (see ArenaScope), or from
+  // the heap if there is none. See cloneStatement.
+  // The placeholders in the statement are appended to parameters, if given.
+  SQLStatement* decodeStatement(const binary::Statement* stmt, std::vector<Expr*>* parameters = nullptr);
+
+  // Appends the decoded statements of an encoded result to statements and
+  // their placeholders to parameters, in the order of the encoded result.
+  void decodeResult(const binary::Result* encoded, std::vector<SQLStatement*>* statements, std::vector<Expr*>* parameters);
+
+} // namespace hsql
+
+#endif
@@ -66,9 +66,19 @@ namespace hsql {
       return;
     }
 
+    if (expr->expr != nullptr) printExpression(expr->expr, numIndent + 1);
+    if (expr->expr2 != nullptr) printExpression(expr->expr2, numIndent + 1);
+    if (expr->expr3 != nullptr) printExpression(expr->expr3, numIndent + 1);
     if (expr->exprList != nullptr) {
       for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
     }
+    if (expr->opType == kOpIn && expr->exprList == nullptr && expr->inValues != nullptr) {
+      for (size_t i = 0; i < expr->inValues->size(); ++i) {
+        Expr* literal = expr->inValues->makeLiteral(i);
+        printExpression(literal, numIndent + 1);
+        delete literal;
+      }
+    }
   }
 
   void printExpression(Expr* expr, uintmax_t numIndent) {
@@ -93,6 +103,9 @@ namespace hsql {
     case kExprLiteralString:
       inprint(expr->name, numIndent);
       break;
+    case kExprLiteralNull:
+      inprint("NULL", numIndent);
+      break;
     case kExprFunctionRef:
       inprint(expr->name, numIndent);
       for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
@@ -110,11 +123,11 @@ namespace hsql {
       for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
       break;
     case kExprArrayIndex:
-      //TODO printExpression(expr->exprList, numIndent + 1);
+      printExpression(expr->expr, numIndent + 1);
       inprint(expr->ival, numIndent);
       break;
     default:
-      std::cerr << "Unrecognized expression type " << expr->type << std::endl;
+      std::cerr << "Unrecognized expression type " << (int) expr->type << std::endl;
       return;
     }
     if (expr->alias != nullptr) {
@@ -123,6 +136,20 @@ namespace hsql {
     }
   }
 
+  void printOrderAndLimit(const std::vector<OrderDescription*>* order, const LimitDescription* limit, uintmax_t numIndent) {
+    if (order != nullptr) {
+      inprint("OrderBy:", numIndent + 1);
+      printExpression(order->at(0)->expr, numIndent + 2);
+      if (order->at(0)->type == kOrderAsc) inprint("ascending", numIndent + 2);
+      else inprint("descending", numIndent + 2);
+    }
+
+    if (limit != nullptr) {
+      inprint("Limit:", numIndent + 1);
+      inprint(limit->limit, numIndent + 2);
+    }
+  }
+
   void printSelectStatementInfo(const SelectStatement* stmt, uintmax_t numIndent) {
     inprint("SelectStatement", numIndent);
     inprint("Fields:", numIndent + 1);
@@ -147,22 +174,25 @@ namespace hsql {
       }
     }
 
-    if (stmt->unionSelect != nullptr) {
-      inprint("Union:", numIndent + 1);
-      printSelectStatementInfo(stmt->unionSelect, numIndent + 2);
-    }
+    printOrderAndLimit(stmt->order, stmt->limit, numIndent);
 
-    if (stmt->order != nullptr) {
-      inprint("OrderBy:", numIndent + 1);
-      printExpression(stmt->order->at(0)->expr, numIndent + 2);
-      if (stmt->order->at(0)->type == kOrderAsc) inprint("ascending", numIndent + 2);
-      else inprint("descending", numIndent + 2);
-    }
+    if (stmt->setOperation != nullptr) printSetOperation(stmt->setOperation, numIndent);
+  }
 
-    if (stmt->limit != nullptr) {
-      inprint("Limit:", numIndent + 1);
-      inprint(stmt->limit->limit, numIndent + 2);
+  void printSetOperation(const SetOperation* operation, uintmax_t numIndent) {
+    if (operation->nested != nullptr) {
+      inprint("Nested:", numIndent + 1);
+      printSetOperation(operation->nested, numIndent + 1);
     }
+    for (const SetBranch& branch : *operation->branches) {
+      switch (branch.type) {
+        case kSetUnion: inprint(branch.all ? "Union All:" : "Union:", numIndent + 1); break;
+        case kSetIntersect: inprint(branch.all ? "Intersect All:" : "Intersect:", numIndent + 1); break;
+        case kSetExcept: inprint(branch.all ? "Except All:" : "Except:", numIndent + 1); break;
+      }
+      printSelectStatementInfo(branch.select, numIndent + 2);
+    }
+    printOrderAndLimit(operation->order, operation->limit, numIndent);
   }
 
 
@@ -191,8 +221,26 @@ namespace hsql {
     switch (stmt->type) {
     case kInsertValues:
       inprint("Values", numIndent + 1);
-      for (Expr* expr : *stmt->values) {
-        printExpression(expr, numIndent + 2);
+      if (stmt->values != nullptr) {
+        for (Expr* expr : *stmt->values) {
+          printExpression(expr, numIndent + 2);
+        }
+      }
+      if (stmt->rows != nullptr) {
+        const ValuesBlock* rows = stmt->rows;
+        for (size_t row = 0; row < rows->numRows; ++row) {
+          inprint("Row", numIndent + 2);
+          for (size_t column = 0; column < rows->numColumns(); ++column) {
+            const ValuesColumn& values = rows->columns->at(column);
+            if (values.type == kValuesExpr && !values.isNull(row)) {
+              printExpression(values.cells[row].expr, numIndent + 3);
+            } else {
+              Expr* literal = rows->makeLiteral(row, column);
+              printExpression(literal, numIndent + 3);
+              delete literal;
+            }
+          }
+        }
       }
       break;
     case kInsertSelect:
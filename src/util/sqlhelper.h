@@ -11,6 +11,9 @@ namespace hsql {
   // Prints a summary of the given SelectStatement with the given indentation.
   void printSelectStatementInfo(const SelectStatement* stmt, uintmax_t num_indent);
 
+  // Prints a summary of the given chain of set operations with the given indentation.
+  void printSetOperation(const SetOperation* operation, uintmax_t num_indent);
+
   // Prints a summary of the given ImportStatement with the given indentation.
   void printImportStatementInfo(const ImportStatement* stmt, uintmax_t num_indent);
 
@@ -0,0 +1,111 @@
+#include "statement_splitter.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace hsql {
+
+  static inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n';
+  }
+
+  // Returns the first of the characters a, b, c and d in [p, end), or end.
+  static const char* findAny(const char* p, const char* end, char a, char b, char c, char d) {
+#if defined(__SSE2__)
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    const __m128i vd = _mm_set1_epi8(d);
+    while (end - p >= 16) {
+      __m128i chunk = _mm_loadu_si128((const __m128i*) p);
+      __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)),
+                                   _mm_or_si128(_mm_cmpeq_epi8(chunk, vc), _mm_cmpeq_epi8(chunk, vd)));
+      uint32_t mask = (uint32_t) _mm_movemask_epi8(found);
+      if (mask != 0) return p + __builtin_ctz(mask);
+      p += 16;
+    }
+#endif
+    while (p < end && *p != a && *p != b && *p != c && *p != d) ++p;
+    return p;
+  }
+
+  void splitStatements(const char* data, size_t length, std::vector<StatementRange>* ranges) {
+    const char* p = data;
+    const char* end = data + length;
+
+    // First token of the current statement (nullptr if there is none yet)
+    // and the end of its last token.
+    const char* first = nullptr;
+    const char* last = nullptr;
+
+    // Adds the characters [begin, stop) that contain no separators,
+    // quotes or comments to the current statement.
+    auto addPlain = [&](const char* begin, const char* stop) {
+      const char* tokenEnd = stop;
+      while (tokenEnd > begin && isWhitespace(tokenEnd[-1])) --tokenEnd;
+      if (tokenEnd == begin) return;
+      if (first == nullptr) {
+        while (isWhitespace(*begin)) ++begin;
+        first = begin;
+      }
+      last = tokenEnd;
+    };
+
+    // Adds the token [begin, stop) to the current statement.
+    auto addToken = [&](const char* begin, const char* stop) {
+      if (first == nullptr) first = begin;
+      last = stop;
+    };
+
+    while (p < end) {
+      const char* special = findAny(p, end, ';', '\'', '"', '-');
+      addPlain(p, special);
+      if (special == end) break;
+
+      switch (*special) {
+        case ';':
+          if (first != nullptr) {
+            ranges->push_back({(size_t) (first - data), (size_t) (last - data)});
+            first = nullptr;
+          }
+          p = special + 1;
+          break;
+
+        case '\'':
+        case '"': {
+          // Quoted text ends at the same quote and can not span lines.
+          // Quoted identifiers can not be empty. Otherwise the quote is
+          // a character of its own, which the lexer rejects.
+          const char* close = findAny(special + 1, end, *special, '\n', '\n', '\n');
+          bool quoted = close < end && *close == *special && (*special == '\'' || close > special + 1);
+          p = quoted ? close + 1 : special + 1;
+          addToken(special, p);
+          break;
+        }
+
+        case '-':
+          if (special + 1 < end && special[1] == '-') {
+            // Comments end at the next newline.
+            const char* newline = (const char*) memchr(special + 2, '\n', end - special - 2);
+            p = newline != nullptr ? newline + 1 : end;
+          } else {
+            p = special + 1;
+            addToken(special, p);
+          }
+          break;
+      }
+    }
+
+    if (first != nullptr) {
+      ranges->push_back({(size_t) (first - data), (size_t) (last - data)});
+    }
+  }
+
+  void splitStatements(const std::string& sql, std::vector<StatementRange>* ranges) {
+    splitStatements(sql.data(), sql.size(), ranges);
+  }
+
+} // namespace hsql
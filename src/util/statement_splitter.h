@@ -0,0 +1,30 @@
+#ifndef __SQLPARSER__STATEMENT_SPLITTER_H__
+#define __SQLPARSER__STATEMENT_SPLITTER_H__
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace hsql {
+
+  // Byte range [begin, end) of a statement within a script.
+  struct StatementRange {
+    size_t begin;
+    size_t end;
+  };
+
+  // Splits a script into its statements without parsing it.
+  // Statements are separated by semicolons outside of string literals,
+  // quoted identifiers and comments, following the rules of the lexer.
+  // Each range starts at the first token and ends after the last token of
+  // its statement, so whitespace, comments and the semicolon are not part
+  // of it. Statements without any tokens are skipped.
+  // Characters the lexer does not accept are kept in the statement, so
+  // that parsing the statement reports them.
+  void splitStatements(const char* data, size_t length, std::vector<StatementRange>* ranges);
+
+  void splitStatements(const std::string& sql, std::vector<StatementRange>* ranges);
+
+} // namespace hsql
+
+#endif
@@ -0,0 +1,67 @@
+#include "work_queue.h"
+#include <assert.h>
+
+namespace hsql {
+
+  const size_t WorkQueue::kMaxSize;
+
+  static inline uint64_t packRange(uint64_t begin, uint64_t end) {
+    return begin << 32 | end;
+  }
+
+  static inline uint64_t rangeBegin(uint64_t range) {
+    return range >> 32;
+  }
+
+  static inline uint64_t rangeEnd(uint64_t range) {
+    return range & 0xffffffff;
+  }
+
+  WorkQueue::WorkQueue(size_t size, size_t numWorkers) :
+    ranges_(numWorkers) {
+    assert(size <= kMaxSize);
+    for (size_t i = 0; i < numWorkers; ++i) {
+      ranges_[i].bounds.store(packRange(size * i / numWorkers, size * (i + 1) / numWorkers));
+    }
+  }
+
+  bool WorkQueue::next(size_t worker, size_t* index) {
+    std::atomic<uint64_t>& own = ranges_[worker].bounds;
+    uint64_t range = own.load(std::memory_order_acquire);
+
+    // Other workers might shrink the range at the same time.
+    while (rangeBegin(range) < rangeEnd(range)) {
+      uint64_t begin = rangeBegin(range);
+      if (own.compare_exchange_weak(range, packRange(begin + 1, rangeEnd(range)),
+                                    std::memory_order_acq_rel)) {
+        *index = begin;
+        return true;
+      }
+    }
+
+    return steal(worker, index);
+  }
+
+  bool WorkQueue::steal(size_t worker, size_t* index) {
+    size_t numWorkers = ranges_.size();
+    for (size_t i = 1; i < numWorkers; ++i) {
+      std::atomic<uint64_t>& victim = ranges_[(worker + i) % numWorkers].bounds;
+      uint64_t range = victim.load(std::memory_order_acquire);
+
+      while (rangeBegin(range) < rangeEnd(range)) {
+        uint64_t begin = rangeBegin(range);
+        uint64_t end = rangeEnd(range);
+        uint64_t split = end - (end - begin + 1) / 2;
+        if (victim.compare_exchange_weak(range, packRange(begin, split),
+                                         std::memory_order_acq_rel)) {
+          // The range of this worker is empty, so no other worker changes it.
+          ranges_[worker].bounds.store(packRange(split + 1, end), std::memory_order_release);
+          *index = split;
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+} // namespace hsql
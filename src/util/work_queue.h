@@ -0,0 +1,44 @@
+#ifndef __SQLPARSER__WORK_QUEUE_H__
+#define __SQLPARSER__WORK_QUEUE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+namespace hsql {
+
+  // Hands out the indexes 0 to size - 1 to a fixed number of workers.
+  // Each worker starts with an equal share of the indexes and takes them in
+  // order. Once its share is used up, it steals the upper half of the
+  // remaining indexes of another worker. Each index is handed out exactly once.
+  // Safe to use from one thread per worker.
+  class WorkQueue {
+   public:
+    // Largest number of indexes a queue can hand out, since the bounds of
+    // each range are packed into 32 bits.
+    static const size_t kMaxSize = 0xffffffff;
+
+    // size must not exceed kMaxSize.
+    WorkQueue(size_t size, size_t numWorkers);
+
+    // Sets index to the next index the worker should process.
+    // Returns false once there is no more work for the worker.
+    bool next(size_t worker, size_t* index);
+
+   private:
+    // Remaining indexes [begin, end) of a worker, packed as begin << 32 | end.
+    // Padded to a cache line, since it is updated on every call.
+    struct Range {
+      std::atomic<uint64_t> bounds;
+      char padding[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    bool steal(size_t worker, size_t* index);
+
+    std::vector<Range> ranges_;
+  };
+
+} // namespace hsql
+
+#endif
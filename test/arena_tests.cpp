@@ -0,0 +1,176 @@
+/*
+ * arena_tests.cpp
+ */
+
+#include "thirdparty/microtest/microtest.h"
+
+#include "SQLParser.h"
+#include <thread>
+
+#include "sql_asserts.h"
+
+using namespace hsql;
+
+
+TEST(ArenaOwnsParsedNodesTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT name, city FROM students WHERE grade > 2.0 ORDER BY name;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  Arena* arena = result.arena();
+  ASSERT_EQ(stmt->arena(), arena);
+  ASSERT_EQ(stmt->whereClause->arena(), arena);
+  ASSERT_EQ(stmt->fromTable->arena(), arena);
+  ASSERT(arena->owns(stmt->selectList));
+  ASSERT(arena->owns(stmt->fromTable->name));
+  ASSERT(arena->owns(stmt->whereClause->operand(0)->name));
+  ASSERT(arena->bytesAllocated() > 0);
+}
+
+TEST(ArenaReuseTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT * FROM students;", &result);
+  ASSERT(result.isValid());
+  Arena* arena = result.arena();
+
+  // Parsing into the same result reuses its arena.
+  result.reset();
+  ASSERT_EQ(arena->bytesAllocated(), 0);
+  SQLParser::parse("SELECT a, b FROM t WHERE a = 'x' AND b IN (1, 2, 3);", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.arena(), arena);
+  ASSERT_EQ(result.getStatement(0)->arena(), arena);
+}
+
+TEST(ArenaReleasedStatementsTest) {
+  std::vector<SQLStatement*> statements;
+  {
+    SQLParserResult result;
+    SQLParser::parse("SELECT * FROM students WHERE name = 'Max'; DELETE FROM students;", &result);
+    ASSERT(result.isValid());
+    ASSERT_EQ(result.size(), 2);
+    statements = result.releaseStatements();
+
+    // Parsing into the result again must not touch the released statements.
+    SQLParser::parse("SELECT * FROM teachers;", &result);
+    ASSERT(result.isValid());
+  }
+
+  // The released statements keep their arena alive.
+  const SelectStatement* select = (const SelectStatement*) statements[0];
+  ASSERT_STREQ(select->fromTable->name, "students");
+  ASSERT_STREQ(select->whereClause->operand(1)->name, "Max");
+
+  for (SQLStatement* stmt : statements) {
+    delete stmt;
+  }
+}
+
+TEST(ArenaReleasedStatementsHandOverTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT * FROM students;", &result);
+  Arena* arena = result.arena();
+  std::vector<SQLStatement*> statements = result.releaseStatements();
+  ASSERT_EQ(statements[0]->arena(), arena);
+  ASSERT_EQ(arena->references(), 1);
+
+  // The result parses into a new arena, while the released statement is
+  // deleted on another thread.
+  std::thread deleter([&statements]() {
+    delete statements[0];
+  });
+  for (int i = 0; i < 100; ++i) {
+    SQLParser::parse("SELECT a, b FROM t WHERE a = 'x';", &result);
+    ASSERT(result.isValid());
+    ASSERT(result.arena() != arena);
+    result.reset();
+  }
+  deleter.join();
+}
+
+TEST(HeapAllocatedNodesTest) {
+  // Nodes created outside of the parser live on the heap.
+  SelectStatement* stmt = new SelectStatement();
+  stmt->whereClause = Expr::makeLiteral((int64_t) 1);
+  ASSERT_NULL(stmt->arena());
+  ASSERT_NULL(stmt->whereClause->arena());
+
+  SQLParserResult result(stmt);
+  ASSERT_EQ(result.size(), 1);
+
+  // Literals replaced by placeholders are kept by the result.
+  std::vector<const Expr*> values;
+  result.parameterizeLiterals(&values);
+  ASSERT(stmt->whereClause->isType(kExprParameter));
+  ASSERT_NULL(stmt->whereClause->arena());
+  ASSERT_EQ(values[0]->ival, 1);
+}
+
+TEST(HeapAllocatedNodesMoveTest) {
+  SelectStatement* stmt = new SelectStatement();
+  stmt->whereClause = Expr::makeLiteral((int64_t) 1);
+  SQLParserResult result(stmt);
+  std::vector<const Expr*> values;
+  result.parameterizeLiterals(&values);
+
+  // The replaced literals move with the statements.
+  SQLParserResult moved(std::move(result));
+  ASSERT_EQ(moved.size(), 1);
+  ASSERT_EQ(values.size(), 1);
+  ASSERT(values[0]->isType(kExprLiteralInt));
+  ASSERT_EQ(values[0]->ival, 1);
+}
+
+TEST(ArenaDeallocateTest) {
+  SQLParserResult result;
+  Arena* arena = result.arena();
+  ArenaScope scope(arena);
+
+  Expr* first = Expr::makeLiteral((int64_t) 1);
+  size_t allocated = arena->bytesAllocated();
+  Expr* second = Expr::makeLiteral((int64_t) 2);
+  ASSERT(arena->bytesAllocated() > allocated);
+
+  // Deleting the most recent node gives its memory back, older nodes stay.
+  delete second;
+  ASSERT_EQ(arena->bytesAllocated(), allocated);
+  Expr* third = Expr::makeLiteral((int64_t) 3);
+  ASSERT_EQ(third, second);
+  allocated = arena->bytesAllocated();
+  delete first;
+  ASSERT_EQ(arena->bytesAllocated(), allocated);
+  ASSERT_EQ(third->ival, 3);
+}
+
+TEST(InListMemoryTest) {
+  std::string query = "SELECT * FROM t WHERE a IN (0";
+  for (int i = 1; i < 1000; ++i) query += ", " + std::to_string(i);
+  query += ");";
+
+  // The literals of the list are given back to the arena as they are added.
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  ASSERT(result.isValid());
+  ASSERT(result.arena()->bytesAllocated() < 1000 * sizeof(Expr));
+}
+
+TEST(ZeroCopyIdentifiersTest) {
+  const std::string query = "SELECT name, \"city\" FROM students WHERE name = 'Max';";
+  TEST_PARSE_SINGLE_SQL(query, kStmtSelect, SelectStatement, result, stmt);
+
+  // Identifiers and strings point into a single copy of the query.
+  const char* name = stmt->selectList->at(0)->name;
+  const char* city = stmt->selectList->at(1)->name;
+  const char* table = stmt->fromTable->name;
+  const char* max = stmt->whereClause->operand(1)->name;
+  ASSERT_STREQ(name, "name");
+  ASSERT_STREQ(city, "city");
+  ASSERT_STREQ(table, "students");
+  ASSERT_STREQ(max, "Max");
+  ASSERT_EQ(city - name, (long) (query.find("city") - query.find("name")));
+  ASSERT_EQ(table - name, (long) (query.find("students") - query.find("name")));
+  ASSERT_EQ(max - name, (long) (query.find("Max") - query.find("name")));
+}
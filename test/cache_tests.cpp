@@ -0,0 +1,283 @@
+/*
+ * cache_tests.cpp
+ */
+
+#include "thirdparty/microtest/microtest.h"
+
+#include "SQLParser.h"
+#include "util/jsonprinter.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace hsql;
+
+
+TEST(SQLParserResultCloneTest) {
+  const std::vector<std::string> queries = {
+    "SELECT a, MAX(b), CUSTOM(q, UP(r)) AS f FROM t1 WHERE a BETWEEN 1 AND c OR b IN (1, 2, 3) GROUP BY a HAVING COUNT(*) > 1 ORDER BY a DESC LIMIT 10 OFFSET 5;",
+    "SELECT * FROM t1 UNION (SELECT * FROM t2 UNION SELECT * FROM t3) ORDER BY col1;",
+    "(SELECT a FROM t1 WHERE b = 1 UNION SELECT a FROM t2 LIMIT 5) INTERSECT SELECT a FROM t3 ORDER BY a;",
+    "SELECT t1.a, t2.c FROM \"table\" AS t1 JOIN (SELECT * FROM foo JOIN bar ON foo.id = bar.id) t2 ON t1.a = t2.b, t3 WHERE t2.c = -12.5 AND EXISTS (SELECT 1 FROM t4);",
+    "SELECT a FROM t WHERE x = ? AND y = ? WITH HINT(NO_CACHE, SAMPLE_RATE(10));",
+    "INSERT INTO s.students (name, grade) VALUES ('Max', ?);",
+    "INSERT INTO students VALUES ('Max', 1.3, NULL), (?, 2, 'x'), (NULL, 2.7, 4);",
+    "INSERT INTO students SELECT * FROM old_students WHERE grade < ?;",
+    "IMPORT FROM CSV FILE 'students.csv' INTO s.students;",
+  };
+
+  for (const std::string& query : queries) {
+    SQLParserResult* result = new SQLParserResult();
+    SQLParser::parse(query, result);
+    ASSERT(result->isValid());
+
+    std::vector<std::string> json;
+    for (const SQLStatement* stmt : result->getStatements()) {
+      json.push_back(jsonPrintStatementInfo(stmt, false));
+    }
+
+    SQLParserResult copy;
+    result->clone(&copy);
+    ASSERT(copy.isValid());
+    ASSERT_EQ(copy.size(), result->size());
+    ASSERT_EQ(copy.parameters().size(), result->parameters().size());
+    for (size_t i = 0; i < copy.parameters().size(); ++i) {
+      ASSERT_EQ(copy.parameters()[i]->ival, result->parameters()[i]->ival);
+      ASSERT(copy.arena()->owns(copy.parameters()[i]));
+    }
+
+    // The copy has to outlive the original.
+    delete result;
+    for (size_t i = 0; i < copy.size(); ++i) {
+      ASSERT_EQ(copy.getStatement(i)->arena(), copy.arena());
+      ASSERT_STREQ(jsonPrintStatementInfo(copy.getStatement(i), false), json[i]);
+    }
+  }
+}
+
+TEST(SQLParserResultCloneStatementsTest) {
+  SQLParserResult result;
+  SQLParser::parse("UPDATE students SET grade = 1.3, name = ? WHERE name = 'Max';"
+                   "DELETE FROM s.students WHERE grade > 3.0;"
+                   "DROP TABLE IF EXISTS students;"
+                   "PREPARE prep FROM 'SELECT * FROM t WHERE a = ?';"
+                   "EXECUTE prep(1, 'a');"
+                   "SHOW COLUMNS s.students;"
+                   "CREATE VIEW v (a, b) AS SELECT a, b FROM t;"
+                   "CREATE TABLE IF NOT EXISTS students (name TEXT, grade DOUBLE);", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 8);
+
+  SQLParserResult copy;
+  result.clone(&copy);
+  ASSERT_EQ(copy.size(), 8);
+  ASSERT_EQ(copy.parameters().size(), 1);
+
+  const UpdateStatement* update = (const UpdateStatement*) copy.getStatement(0);
+  ASSERT_EQ(update->type(), kStmtUpdate);
+  ASSERT_STREQ(update->table->name, "students");
+  ASSERT_EQ(update->updates->size(), 2);
+  ASSERT_STREQ(update->updates->at(1)->column, "name");
+  ASSERT_EQ(update->updates->at(1)->value, copy.parameters()[0]);
+  ASSERT_STREQ(update->where->expr2->name, "Max");
+
+  const DeleteStatement* del = (const DeleteStatement*) copy.getStatement(1);
+  ASSERT_EQ(del->type(), kStmtDelete);
+  ASSERT_STREQ(del->schema, "s");
+  ASSERT_STREQ(del->tableName, "students");
+  ASSERT_EQ(del->expr->opType, kOpGreater);
+
+  const DropStatement* drop = (const DropStatement*) copy.getStatement(2);
+  ASSERT_EQ(drop->type, kDropTable);
+  ASSERT(drop->ifExists);
+  ASSERT_STREQ(drop->name, "students");
+
+  const PrepareStatement* prepare = (const PrepareStatement*) copy.getStatement(3);
+  ASSERT_STREQ(prepare->name, "prep");
+  ASSERT_STREQ(prepare->query, ((const PrepareStatement*) result.getStatement(3))->query);
+  ASSERT_NEQ(prepare->query, ((const PrepareStatement*) result.getStatement(3))->query);
+
+  const ExecuteStatement* execute = (const ExecuteStatement*) copy.getStatement(4);
+  ASSERT_STREQ(execute->name, "prep");
+  ASSERT_EQ(execute->parameters->size(), 2);
+  ASSERT_EQ(execute->parameters->at(0)->ival, 1);
+  ASSERT_STREQ(execute->parameters->at(1)->name, "a");
+
+  const ShowStatement* show = (const ShowStatement*) copy.getStatement(5);
+  ASSERT_EQ(show->type, kShowColumns);
+  ASSERT_STREQ(show->schema, "s");
+  ASSERT_STREQ(show->name, "students");
+
+  const CreateStatement* create = (const CreateStatement*) copy.getStatement(6);
+  ASSERT_EQ(create->type, kCreateView);
+  ASSERT_STREQ(create->tableName, "v");
+  ASSERT_EQ(create->viewColumns->size(), 2);
+  ASSERT_STREQ(create->viewColumns->at(1), "b");
+  ASSERT_EQ(create->select->selectList->size(), 2);
+
+  create = (const CreateStatement*) copy.getStatement(7);
+  ASSERT_EQ(create->type, kCreateTable);
+  ASSERT(create->ifNotExists);
+  ASSERT_EQ(create->columns->size(), 2);
+  ASSERT_STREQ(create->columns->at(1)->name, "grade");
+  ASSERT_EQ(create->columns->at(1)->type, ColumnDefinition::DOUBLE);
+}
+
+TEST(SQLParserResultCloneErrorTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT * FROM;", &result);
+  ASSERT_FALSE(result.isValid());
+
+  SQLParserResult copy;
+  SQLParser::parse("SELECT * FROM t;", &copy);
+  result.clone(&copy);
+  ASSERT_FALSE(copy.isValid());
+  ASSERT_EQ(copy.size(), 0);
+  ASSERT_STREQ(copy.errorMsg(), result.errorMsg());
+  ASSERT_EQ(copy.errorLine(), result.errorLine());
+  ASSERT_EQ(copy.errorColumn(), result.errorColumn());
+  ASSERT_EQ(copy.errorOffset(), result.errorOffset());
+}
+
+TEST(SQLParserCacheTest) {
+  SQLParserCache cache(1 << 20);
+  std::shared_ptr<const SQLParserResult> first = cache.parse("SELECT * FROM t WHERE a = ?;");
+  std::shared_ptr<const SQLParserResult> second = cache.parse("SELECT * FROM t WHERE a = ?;");
+  ASSERT(first->isValid());
+  ASSERT_EQ(first.get(), second.get());
+  ASSERT_EQ(first->parameters().size(), 1);
+
+  // Invalid queries are cached as well.
+  std::shared_ptr<const SQLParserResult> invalid = cache.parse("SELECT * FROM;");
+  ASSERT_FALSE(invalid->isValid());
+  std::shared_ptr<const SQLParserResult> cached = cache.parse("SELECT * FROM;");
+  ASSERT_EQ(cached.get(), invalid.get());
+
+  SQLParserCache::Stats stats = cache.stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.misses, 2);
+  ASSERT_EQ(stats.evictions, 0);
+  ASSERT_EQ(stats.entries, 2);
+  ASSERT(stats.bytes > 0);
+
+  // Copies can be changed without affecting the cached result.
+  SQLParserResult copy;
+  ASSERT(cache.parse("SELECT * FROM t WHERE a = ?;", &copy));
+  ASSERT(copy.isValid());
+  SelectStatement* stmt = (SelectStatement*) copy.getMutableStatement(0);
+  stmt->whereClause->expr->name[0] = 'b';
+  ASSERT_STREQ(((const SelectStatement*) first->getStatement(0))->whereClause->expr->name, "a");
+  ASSERT_EQ(cache.stats().hits, 3);
+
+  cache.clear();
+  ASSERT_EQ(cache.stats().entries, 0);
+  ASSERT_EQ(cache.stats().bytes, 0);
+  ASSERT(first->isValid());
+  cached = cache.parse("SELECT * FROM t WHERE a = ?;");
+  ASSERT_NEQ(cached.get(), first.get());
+}
+
+TEST(SQLParserCacheNormalizedKeyTest) {
+  SQLParserCache cache(1 << 20);
+  std::shared_ptr<const SQLParserResult> first = cache.parse("SELECT * FROM t WHERE a = ?;");
+
+  // Whitespace, comments and the case of keywords do not matter.
+  std::shared_ptr<const SQLParserResult> cached = cache.parse("select *\n  from t -- all rows\n where a=? ;");
+  ASSERT_EQ(cached.get(), first.get());
+  ASSERT_EQ(cache.stats().hits, 1);
+
+  // Identifiers, literals and the gap in a numbered placeholder do.
+  cached = cache.parse("SELECT * FROM T WHERE a = ?;");
+  ASSERT_NEQ(cached.get(), first.get());
+  cached = cache.parse("SELECT * FROM t WHERE a = 'a b';");
+  ASSERT_STREQ(((const SelectStatement*) cached->getStatement(0))->whereClause->expr2->name, "a b");
+  cached = cache.parse("SELECT * FROM t WHERE a = 'a  b';");
+  ASSERT_STREQ(((const SelectStatement*) cached->getStatement(0))->whereClause->expr2->name, "a  b");
+  cached = cache.parse("SELECT * FROM t WHERE a = $1;");
+  ASSERT(cached->isValid());
+  cached = cache.parse("SELECT * FROM t WHERE a = $ 1;");
+  ASSERT_FALSE(cached->isValid());
+
+  // Errors keep their position.
+  std::shared_ptr<const SQLParserResult> invalid = cache.parse("SELECT * FROM;");
+  std::shared_ptr<const SQLParserResult> shifted = cache.parse("SELECT *   FROM;");
+  ASSERT_NEQ(shifted.get(), invalid.get());
+  ASSERT_EQ(shifted->errorColumn(), invalid->errorColumn() + 2);
+  cached = cache.parse("SELECT * FROM;");
+  ASSERT_EQ(cached.get(), invalid.get());
+  ASSERT_EQ(cache.stats().hits, 2);
+}
+
+TEST(SQLParserCacheEvictionTest) {
+  const std::string a = "SELECT * FROM a WHERE x = 1;";
+  const std::string b = "SELECT * FROM b WHERE x = 1;";
+  const std::string c = "SELECT * FROM c WHERE x = 1;";
+
+  // Queries of the same shape use the same amount of memory.
+  SQLParserCache sizing(1 << 20);
+  sizing.parse(a);
+  size_t entryBytes = sizing.stats().bytes;
+  sizing.parse(b);
+  ASSERT_EQ(sizing.stats().bytes, 2 * entryBytes);
+
+  SQLParserCache cache(2 * entryBytes);
+  std::shared_ptr<const SQLParserResult> resultB = cache.parse(b);
+  cache.parse(a);
+  cache.parse(b);
+  cache.parse(c);
+
+  // a was the least recently used query.
+  SQLParserCache::Stats stats = cache.stats();
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.entries, 2);
+  ASSERT_EQ(stats.bytes, 2 * entryBytes);
+  std::shared_ptr<const SQLParserResult> cached = cache.parse(b);
+  ASSERT_EQ(cached.get(), resultB.get());
+  ASSERT_EQ(cache.stats().hits, 2);
+
+  // Evicted results stay valid while they are in use.
+  cache.parse(a);
+  cache.parse(c);
+  ASSERT_EQ(cache.stats().evictions, 3);
+  cached = cache.parse(b);
+  ASSERT_NEQ(cached.get(), resultB.get());
+  ASSERT_STREQ(((const SelectStatement*) resultB->getStatement(0))->fromTable->name, "b");
+
+  // Results larger than the cache are not cached.
+  SQLParserCache tiny(entryBytes - 1);
+  ASSERT(tiny.parse(a)->isValid());
+  ASSERT_EQ(tiny.stats().entries, 0);
+  ASSERT_EQ(tiny.stats().bytes, 0);
+}
+
+TEST(SQLParserCacheThreadsTest) {
+  const size_t kThreads = 4;
+  const size_t kQueries = 16;
+  const size_t kRounds = 200;
+
+  SQLParserCache cache(1 << 20);
+  std::atomic<size_t> failures(0);
+
+  auto work = [&](size_t thread) {
+    for (size_t round = 0; round < kRounds; ++round) {
+      size_t query = (round * 7 + thread) % kQueries;
+      std::string sql = "SELECT a FROM t" + std::to_string(query) + " WHERE b = 1;";
+      std::shared_ptr<const SQLParserResult> result = cache.parse(sql);
+      const SelectStatement* stmt = (const SelectStatement*) result->getStatement(0);
+      if (!result->isValid() || std::string(stmt->fromTable->name) != "t" + std::to_string(query)) {
+        ++failures;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back(work, thread);
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  ASSERT_EQ(failures.load(), 0);
+  SQLParserCache::Stats stats = cache.stats();
+  ASSERT_EQ(stats.hits + stats.misses, kThreads * kRounds);
+  ASSERT_EQ(stats.entries, kQueries);
+}
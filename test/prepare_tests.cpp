@@ -2,6 +2,8 @@
 #include "thirdparty/microtest/microtest.h"
 #include "sql_asserts.h"
 #include "SQLParser.h"
+#include "util/jsonprinter.h"
+#include <string.h>
 
 using hsql::kExprParameter;
 using hsql::kExprLiteralInt;
@@ -40,8 +42,8 @@ TEST(PrepareSingleStatementTest) {
     select);
 
   ASSERT_EQ(result2.parameters().size(), 1);
-  ASSERT(select->whereClause->exprList->at(1)->isType(kExprParameter));
-  ASSERT_EQ(select->whereClause->exprList->at(1)->ival, 0);
+  ASSERT(select->whereClause->operand(1)->isType(kExprParameter));
+  ASSERT_EQ(select->whereClause->operand(1)->ival, 0);
 
 }
 
@@ -72,17 +74,17 @@ TEST(StatementWithParameters) {
   ASSERT_EQ(result.parameters().size(), 2);
 
   ASSERT_EQ(eq1->opType, hsql::kOpEquals);
-  ASSERT(eq1->exprList->at(0)->isType(hsql::kExprColumnRef));
-  ASSERT(eq1->exprList->at(1)->isType(kExprParameter));
-  ASSERT_EQ(eq1->exprList->at(1)->ival, 0);
-  ASSERT_EQ(result.parameters()[0], eq1->exprList->at(1))
+  ASSERT(eq1->operand(0)->isType(hsql::kExprColumnRef));
+  ASSERT(eq1->operand(1)->isType(kExprParameter));
+  ASSERT_EQ(eq1->operand(1)->ival, 0);
+  ASSERT_EQ(result.parameters()[0], eq1->operand(1))
 
 
   ASSERT_EQ(eq2->opType, hsql::kOpEquals)
-  ASSERT(eq2->exprList->at(0)->isType(hsql::kExprColumnRef))
-  ASSERT(eq2->exprList->at(1)->isType(kExprParameter))
-  ASSERT_EQ(eq2->exprList->at(1)->ival, 1)
-  ASSERT_EQ(result.parameters()[1], eq2->exprList->at(1));
+  ASSERT(eq2->operand(0)->isType(hsql::kExprColumnRef))
+  ASSERT(eq2->operand(1)->isType(kExprParameter))
+  ASSERT_EQ(eq2->operand(1)->ival, 1)
+  ASSERT_EQ(result.parameters()[1], eq2->operand(1));
 }
 
 TEST(ExecuteStatementTest) {
@@ -96,3 +98,428 @@ TEST(ExecuteStatementTest) {
   ASSERT_STREQ(stmt->name, "test");
   ASSERT_EQ(stmt->parameters->size(), 2);
 }
+
+TEST(ParameterizeLiteralsTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT a, 'x' FROM t WHERE b = ? AND c IN (1, 2.5) AND d = -3 "
+    "GROUP BY 1 ORDER BY 2, a + 7 LIMIT 10;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  std::vector<const hsql::Expr*> values;
+  result.parameterizeLiterals(&values);
+
+  // The placeholder of the query keeps its id, the literals are numbered
+  // after it in the order of the query.
+  ASSERT_EQ(result.parameters().size(), 6);
+  ASSERT_EQ(values.size(), 6);
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT(result.parameters()[i]->isType(kExprParameter));
+    ASSERT_EQ(result.parameters()[i]->ival, (int64_t) i);
+  }
+  ASSERT_NULL(values[0]);
+  ASSERT_STREQ(values[1]->name, "x");
+  ASSERT_EQ(values[2]->ival, 1);
+  ASSERT(values[3]->isType(hsql::kExprLiteralFloat));
+  ASSERT_EQ(values[4]->ival, -3);
+  ASSERT_EQ(values[5]->ival, 7);
+
+  // The placeholders do not keep the literals.
+  ASSERT_EQ(stmt->selectList->at(1), result.parameters()[1]);
+  ASSERT_NULL(stmt->selectList->at(1)->expr);
+  const hsql::Expr* in = stmt->whereClause->exprList->at(1);
+  ASSERT_EQ(in->exprList->at(0), result.parameters()[2]);
+  ASSERT_EQ(stmt->whereClause->exprList->at(2)->expr2, result.parameters()[4]);
+
+  // Positions in GROUP BY and ORDER BY are not values.
+  ASSERT(stmt->groupBy->columns->at(0)->isType(kExprLiteralInt));
+  ASSERT(stmt->order->at(0)->expr->isType(kExprLiteralInt));
+  ASSERT_EQ(stmt->limit->limit, 10);
+
+  // Parameterizing again does not change anything.
+  result.parameterizeLiterals(&values);
+  ASSERT_EQ(result.parameters().size(), 6);
+}
+
+TEST(ParameterizeLiteralsStatementsTest) {
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse(
+    "INSERT INTO t VALUES (1, 'a', ?);"
+    "UPDATE t SET a = 2 WHERE b IN (SELECT c FROM u WHERE d = 3);"
+    "DELETE FROM t WHERE a = 4;"
+    "SELECT * FROM t JOIN u ON t.a = u.a + 5 WITH HINT(SAMPLE_RATE(10));"
+    "(SELECT a FROM t WHERE a = 6 ORDER BY a + 7) UNION SELECT a FROM u WHERE b = 8 ORDER BY a + 9;",
+    &result);
+  ASSERT(result.isValid());
+
+  std::vector<const hsql::Expr*> values;
+  result.parameterizeLiterals(&values);
+  ASSERT_EQ(values.size(), 11);
+  ASSERT_NULL(values[0]);
+  ASSERT_STREQ(values[2]->name, "a");
+  for (int64_t i = 3; i < 11; ++i) {
+    ASSERT_EQ(values[i]->ival, i - 1);
+  }
+
+  // Hints are kept as they are.
+  const SelectStatement* select = (const SelectStatement*) result.getStatement(3);
+  ASSERT(select->hints->at(0)->exprList->at(0)->isType(kExprLiteralInt));
+
+  // Queries that only differ in their literals have the same template.
+  hsql::SQLParserResult first;
+  hsql::SQLParserResult second;
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = 1 AND b = 'x' AND c IN (1, 2) LIMIT 5;", &first);
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = 2 AND b = 'y' AND c IN (3, 4) LIMIT 5;", &second);
+  ASSERT(hsql::jsonPrintStatementInfo(first.getStatement(0), false) !=
+         hsql::jsonPrintStatementInfo(second.getStatement(0), false));
+  first.parameterizeLiterals();
+  second.parameterizeLiterals();
+  ASSERT_EQ(first.parameterCount(), 4);
+  ASSERT_STREQ(hsql::jsonPrintStatementInfo(first.getStatement(0), false),
+               hsql::jsonPrintStatementInfo(second.getStatement(0), false));
+  std::string firstImage;
+  std::string secondImage;
+  first.serialize(&firstImage);
+  second.serialize(&secondImage);
+  ASSERT(firstImage == secondImage);
+}
+
+TEST(ParameterizeLiteralsRowsTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "INSERT INTO t VALUES (1, 'a', NULL), (2, ?, 3.5), (-3, 'c', 4.5);",
+    kStmtInsert,
+    InsertStatement,
+    result,
+    stmt);
+
+  std::vector<const hsql::Expr*> values;
+  result.parameterizeLiterals(&values);
+
+  // The values are numbered row by row, after the placeholder of the query.
+  ASSERT_EQ(result.parameters().size(), 8);
+  ASSERT_EQ(values.size(), 8);
+  ASSERT_NULL(values[0]);
+  ASSERT_EQ(values[1]->ival, 1);
+  ASSERT_STREQ(values[2]->name, "a");
+  ASSERT_EQ(values[3]->ival, 2);
+  ASSERT_EQ(values[4]->fval, 3.5);
+  ASSERT_EQ(values[5]->ival, -3);
+  ASSERT_STREQ(values[6]->name, "c");
+  ASSERT_EQ(values[7]->fval, 4.5);
+
+  // All columns hold expressions now, NULL stays NULL.
+  const hsql::ValuesBlock* rows = stmt->rows;
+  ASSERT_EQ(rows->numRows, 3);
+  for (const hsql::ValuesColumn& column : *rows->columns) {
+    ASSERT_EQ(column.type, hsql::kValuesExpr);
+  }
+  ASSERT_EQ(rows->columns->at(0).cells[0].expr, result.getParameter(1));
+  ASSERT_EQ(rows->columns->at(1).cells[1].expr, result.getParameter(0));
+  ASSERT_EQ(rows->columns->at(2).cells[1].expr, result.getParameter(4));
+  ASSERT(rows->columns->at(2).isNull(0));
+  ASSERT_NULL(rows->columns->at(2).cells[0].expr);
+
+  // Inserts that only differ in their values have the same template.
+  hsql::SQLParserResult other;
+  hsql::SQLParser::parse("INSERT INTO t VALUES (7, 'x', NULL), (8, ?, 0.5), (9, 'y', 1.5);", &other);
+  other.parameterizeLiterals();
+  std::string image;
+  std::string otherImage;
+  result.serialize(&image);
+  other.serialize(&otherImage);
+  ASSERT(image == otherImage);
+}
+
+TEST(BindParametersTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT * FROM students WHERE grade > ? AND name = ? AND city = ?;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  hsql::Expr* grade = hsql::Expr::makeLiteral(2.5);
+  hsql::Expr* name = hsql::Expr::makeLiteral(strdup("Max"));
+  hsql::Expr* city = hsql::Expr::makeNullLiteral();
+  hsql::Expr* column = hsql::Expr::makeColumnRef(strdup("a"));
+
+  // The number and the types of the values are checked first.
+  ASSERT_FALSE(result.bindParameters(std::vector<const hsql::Expr*>{grade, name}));
+  ASSERT_FALSE(result.bindParameters(std::vector<const hsql::Expr*>{grade, name, column}));
+  ASSERT_NULL(result.parameters()[0]->expr);
+
+  ASSERT(result.bindParameters(std::vector<const hsql::Expr*>{grade, name, city}));
+  const hsql::Expr* bound = stmt->whereClause->exprList->at(1)->expr2;
+  ASSERT(bound->isType(kExprParameter));
+  ASSERT(bound->expr->isType(hsql::kExprLiteralString));
+  ASSERT_STREQ(bound->expr->name, "Max");
+  ASSERT_NEQ(bound->expr->name, name->name);
+  ASSERT_EQ(result.parameters()[0]->expr->fval, 2.5);
+  ASSERT(result.parameters()[2]->expr->isType(hsql::kExprLiteralNull));
+
+  // Binding again replaces the values.
+  hsql::Expr* other = hsql::Expr::makeLiteral((int64_t) 3);
+  ASSERT(result.bindParameters(std::vector<const hsql::Expr*>{other, other, other}));
+  ASSERT(bound->expr->isType(kExprLiteralInt));
+  ASSERT_NULL(bound->expr->name);
+  ASSERT_EQ(bound->expr->ival, 3);
+
+  delete grade;
+  delete name;
+  delete city;
+  delete column;
+  delete other;
+}
+
+TEST(BindParametersRebindTest) {
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse("SELECT * FROM students WHERE name = ? AND grade > ?;", &result);
+  ASSERT(result.isValid());
+
+  char name[16];
+  hsql::Expr* nameValue = hsql::Expr::makeLiteral(strdup("Maximilian"));
+  hsql::Expr* gradeValue = hsql::Expr::makeLiteral(1.0);
+  std::vector<const hsql::Expr*> values = {nameValue, gradeValue};
+  ASSERT(result.bindParameters(values));
+  size_t allocated = result.arena()->bytesAllocated();
+
+  // Binding again reuses the memory of the first binding.
+  for (int i = 0; i < 10000; ++i) {
+    snprintf(name, sizeof(name), i % 2 == 0 ? "student%d" : "s%d", i % 100);
+    free(nameValue->name);
+    nameValue->name = strdup(name);
+    gradeValue->fval = i;
+    ASSERT(result.bindParameters(values));
+    ASSERT_STREQ(result.parameters()[0]->expr->name, name);
+  }
+  ASSERT_EQ(result.arena()->bytesAllocated(), allocated);
+  ASSERT_EQ(result.parameters()[1]->expr->fval, 9999.0);
+
+  delete nameValue;
+  delete gradeValue;
+}
+
+TEST(BindParametersRebindCloneTest) {
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse("SELECT * FROM students WHERE name = ?;", &result);
+  ASSERT(result.isValid());
+
+  hsql::Expr* value = hsql::Expr::makeLiteral(strdup("Maximilian"));
+  std::vector<const hsql::Expr*> values = {value};
+  ASSERT(result.bindParameters(values));
+  free(value->name);
+  value->name = strdup("Max");
+  ASSERT(result.bindParameters(values));
+  ASSERT_EQ(result.parameters()[0]->expr->ival2, 11);
+
+  // A copy of the bound string only has room for the string itself.
+  hsql::SQLParserResult copy;
+  result.clone(&copy);
+  ASSERT_EQ(copy.parameters()[0]->expr->ival2, 0);
+  free(value->name);
+  value->name = strdup("Maximilia");
+  ASSERT(copy.bindParameters(values));
+  ASSERT_STREQ(copy.parameters()[0]->expr->name, "Maximilia");
+  ASSERT_STREQ(result.parameters()[0]->expr->name, "Max");
+
+  delete value;
+}
+
+TEST(BindParametersCopyTest) {
+  hsql::SQLParserResult prepared;
+  hsql::SQLParser::parse("INSERT INTO students VALUES (?, ?);", &prepared);
+  ASSERT(prepared.isValid());
+
+  hsql::SQLParserResult execute;
+  hsql::SQLParser::parse("EXECUTE insert_student('Max', 1.3);", &execute);
+  const ExecuteStatement* args = (const ExecuteStatement*) execute.getStatement(0);
+
+  // The arguments of EXECUTE are bound into a copy of the prepared statement.
+  hsql::SQLParserResult bound;
+  std::vector<const hsql::Expr*> values(args->parameters->begin(), args->parameters->end());
+  ASSERT(prepared.bindParameters(values, &bound));
+  const InsertStatement* insert = (const InsertStatement*) bound.getStatement(0);
+  ASSERT_STREQ(insert->values->at(0)->expr->name, "Max");
+  ASSERT_EQ(bound.parameters()[1]->expr, insert->values->at(1)->expr);
+  ASSERT_NULL(prepared.parameters()[0]->expr);
+
+  // Arguments can also be bound in place.
+  ASSERT(prepared.bindParameters(*args->parameters));
+  ASSERT_STREQ(prepared.parameters()[0]->expr->name, "Max");
+
+  // Literals replaced by parameterizeLiterals can be bound as well.
+  hsql::SQLParserResult other;
+  hsql::SQLParser::parse("INSERT INTO students VALUES ('Moritz', 2.0);", &other);
+  std::vector<const hsql::Expr*> otherValues;
+  other.parameterizeLiterals(&otherValues);
+  ASSERT(prepared.bindParameters(otherValues, &bound));
+  ASSERT_STREQ(bound.parameters()[0]->expr->name, "Moritz");
+
+  ASSERT_FALSE(prepared.bindParameters(std::vector<const hsql::Expr*>(), &bound));
+  ASSERT_STREQ(bound.parameters()[0]->expr->name, "Moritz");
+}
+
+TEST(ParameterizeLiteralsAliasTest) {
+  TEST_PARSE_SINGLE_SQL("SELECT 1 AS one FROM t;", kStmtSelect, SelectStatement, result, stmt);
+  std::vector<const hsql::Expr*> values;
+  result.parameterizeLiterals(&values);
+  ASSERT(stmt->selectList->at(0)->isType(kExprParameter));
+  ASSERT_STREQ(stmt->selectList->at(0)->alias, "one");
+  ASSERT_NULL(values[0]->alias);
+}
+
+TEST(PrepareParsedQueryTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "PREPARE prep2 FROM 'INSERT INTO test VALUES (?, 0, 0); INSERT INTO test VALUES (0, ?, 0);';",
+    kStmtPrepare,
+    PrepareStatement,
+    result,
+    prepare);
+
+  // The query is parsed together with the PREPARE statement.
+  const hsql::SQLParserResult* prepared = prepare->prepared;
+  ASSERT_NOTNULL(prepared);
+  ASSERT(prepared->isValid());
+  ASSERT_EQ(prepared->size(), 2);
+  ASSERT_EQ(prepared->getStatement(1)->type(), kStmtInsert);
+  ASSERT_EQ(prepared->parameters().size(), 2);
+  const InsertStatement* insert = (const InsertStatement*) prepared->getStatement(1);
+  ASSERT_EQ(prepared->parameters()[1], insert->values->at(1));
+
+  // EXECUTE binds its arguments into a copy of the prepared statements.
+  hsql::SQLParserResult execute;
+  hsql::SQLParser::parse("EXECUTE prep2(1, 2);", &execute);
+  const ExecuteStatement* args = (const ExecuteStatement*) execute.getStatement(0);
+  hsql::SQLParserResult bound;
+  std::vector<const hsql::Expr*> values(args->parameters->begin(), args->parameters->end());
+  ASSERT(prepared->bindParameters(values, &bound));
+  ASSERT_EQ(bound.parameters()[1]->expr->ival, 2);
+
+  // The prepared result lives as long as the statement, also when the
+  // statement is released from its result.
+  std::vector<hsql::SQLStatement*> statements = result.releaseStatements();
+  result.reset();
+  ASSERT(prepare->prepared->isValid());
+  hsql::SQLParserResult copy;
+  hsql::SQLParserResult owner(statements[0]);
+  owner.clone(&copy);
+  const PrepareStatement* prepareCopy = (const PrepareStatement*) copy.getStatement(0);
+  ASSERT_NEQ(prepareCopy->prepared, prepare->prepared);
+  ASSERT_EQ(prepareCopy->prepared->size(), 2);
+  ASSERT_EQ(prepareCopy->prepared->parameters().size(), 2);
+}
+
+TEST(PrepareInvalidQueryTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "PREPARE prep FROM 'SELECT * FROM';",
+    kStmtPrepare,
+    PrepareStatement,
+    result,
+    prepare);
+
+  ASSERT_NOTNULL(prepare->prepared);
+  ASSERT_FALSE(prepare->prepared->isValid());
+  ASSERT_NOTNULL(prepare->prepared->errorMsg());
+
+  // Statements created outside of the parser own their prepared result.
+  PrepareStatement* statement = new PrepareStatement();
+  hsql::SQLParserResult* prepared = new hsql::SQLParserResult();
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = ?;", prepared);
+  statement->setPrepared(prepared);
+  ASSERT_EQ(statement->prepared->parameters().size(), 1);
+  delete statement;
+}
+
+TEST(NumberedParametersTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT * FROM t WHERE a = $2 AND b = $1 AND c = $2;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  const hsql::Expr* a = stmt->whereClause->exprList->at(0)->expr2;
+  const hsql::Expr* b = stmt->whereClause->exprList->at(1)->expr2;
+  const hsql::Expr* c = stmt->whereClause->exprList->at(2)->expr2;
+  ASSERT(a->isType(kExprParameter));
+  ASSERT_EQ(a->ival, 1);
+  ASSERT_EQ(b->ival, 0);
+  ASSERT_EQ(c->ival, 1);
+
+  // Placeholders are ordered by their ids, each number is one value.
+  ASSERT_EQ(result.parameters().size(), 3);
+  ASSERT_EQ(result.parameters()[0], b);
+  ASSERT_EQ(result.parameters()[1], a);
+  ASSERT_EQ(result.parameters()[2], c);
+  ASSERT_EQ(result.parameterCount(), 2);
+  ASSERT_EQ(result.getParameter(0), b);
+  ASSERT_EQ(result.getParameter(1), a);
+  ASSERT_NULL(result.getParameter(2));
+
+  hsql::Expr* x = hsql::Expr::makeLiteral((int64_t) 1);
+  hsql::Expr* y = hsql::Expr::makeLiteral((int64_t) 2);
+  ASSERT(result.bindParameters(std::vector<const hsql::Expr*>{x, y}));
+  ASSERT_EQ(b->expr->ival, 1);
+  ASSERT_EQ(a->expr->ival, 2);
+  ASSERT_EQ(c->expr->ival, 2);
+  delete x;
+  delete y;
+
+  // Unused numbers still need a value.
+  hsql::SQLParserResult gap;
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = $3;", &gap);
+  ASSERT(gap.isValid());
+  ASSERT_EQ(gap.parameters().size(), 1);
+  ASSERT_EQ(gap.parameterCount(), 3);
+  ASSERT_NULL(gap.getParameter(0));
+  ASSERT_EQ(gap.getParameter(2), gap.parameters()[0]);
+}
+
+TEST(NumberedParametersErrorTest) {
+  const std::vector<std::string> queries = {
+    "SELECT * FROM t WHERE a = $0;",
+    "SELECT * FROM t WHERE a = $65536;",
+    "SELECT * FROM t WHERE a = $ 1;",
+    "SELECT * FROM t WHERE a = ? AND b = $1;",
+    "SELECT * FROM t WHERE a = $1 AND b = ?;",
+  };
+  for (const std::string& query : queries) {
+    hsql::SQLParserResult result;
+    hsql::SQLParser::parse(query, &result);
+    ASSERT_FALSE(result.isValid());
+    ASSERT_NOTNULL(result.errorMsg());
+  }
+
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = $1 AND b = ?;", &result);
+  ASSERT_STREQ(result.errorMsg(), "Numbered and unnumbered placeholders can not be mixed");
+  ASSERT_EQ(result.errorColumn(), 37);
+
+  // The same context can parse unnumbered placeholders afterwards.
+  hsql::SQLParserContext context;
+  context.parse("SELECT * FROM t WHERE a = $1;", &result);
+  context.parse("SELECT * FROM t WHERE a = ?;", &result);
+  ASSERT(result.isValid());
+}
+
+TEST(ParameterLookupTest) {
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = ? AND b = ?;", &result);
+  ASSERT_EQ(result.parameterCount(), 2);
+  for (size_t i = 0; i < result.parameterCount(); ++i) {
+    ASSERT_EQ(result.getParameter(i), result.parameters()[i]);
+  }
+
+  // Literals are numbered after the numbered placeholders.
+  hsql::SQLParserResult numbered;
+  hsql::SQLParser::parse("SELECT * FROM t WHERE a = $2 AND b = 5;", &numbered);
+  std::vector<const hsql::Expr*> values;
+  numbered.parameterizeLiterals(&values);
+  ASSERT_EQ(numbered.parameterCount(), 3);
+  ASSERT_EQ(values.size(), 3);
+  ASSERT_NULL(values[0]);
+  ASSERT_NULL(values[1]);
+  ASSERT_EQ(values[2]->ival, 5);
+}
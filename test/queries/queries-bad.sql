@@ -10,3 +10,9 @@
 !INSERT INTO test_table VALUESd (1, 2, 'test');
 !SELECT * FROM t WHERE a = ? AND b = ?;SELECT 1;
 !SHOW COLUMNS;
+!SELECT * FROM t WHERE a = $0;
+!SELECT * FROM t WHERE a = $ 1;
+!SELECT * FROM t WHERE a = ? AND b = $1;
+!SELECT * FROM t WHERE a = $1 AND b = ?;
+!INSERT INTO test_table VALUES (1, 2), (3);
+!INSERT INTO test_table VALUES (1, 2), ();
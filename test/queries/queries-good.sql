@@ -11,10 +11,14 @@ SELECT * FROM "table" LIMIT 10 OFFSET 10; SELECT * FROM second;
 SELECT * FROM t1 UNION SELECT * FROM t2 ORDER BY col1;
 SELECT * FROM (SELECT * FROM t1);
 SELECT * FROM t1 UNION (SELECT * FROM t2 UNION SELECT * FROM t3) ORDER BY col1;
+SELECT a FROM t1 UNION ALL SELECT a FROM t2 UNION ALL SELECT a FROM t3 LIMIT 10;
+SELECT a FROM t1 INTERSECT SELECT a FROM t2 EXCEPT ALL (SELECT a FROM t3 ORDER BY a) ORDER BY a;
+(SELECT a FROM t1 UNION SELECT a FROM t2) INTERSECT (SELECT a FROM t3 LIMIT 1) ORDER BY a;
 SELECT TOP 10 * FROM t1 ORDER BY col1, col2;
 SELECT a, MAX(b), MAX(c, d), CUSTOM(q, UP(r)) AS f FROM t1;
 SELECT * FROM t WHERE a BETWEEN 1 and c;
 SELECT * FROM t WHERE a = ? AND b = ?;
+SELECT * FROM t WHERE a = $2 AND b = $1 AND c = $2;
 SELECT City.name, Product.category, SUM(price) FROM fact INNER JOIN City ON fact.city_id = City.id INNER JOIN Product ON fact.product_id = Product.id GROUP BY City.name, Product.category;
 # JOIN
 SELECT t1.a, t1.b, t2.c FROM "table" AS t1 JOIN (SELECT * FROM foo JOIN bar ON foo.id = bar.id) t2 ON t1.a = t2.b WHERE (t1.b OR NOT t1.a) AND t2.c = 12.5
@@ -29,6 +33,7 @@ CREATE TABLE "table" FROM TBL FILE 'students.tbl'; SELECT * FROM "table";
 # INSERT
 INSERT INTO test_table VALUES (1, 2, 'test');
 INSERT INTO test_table (id, value, name) VALUES (1, 2, 'test');
+INSERT INTO test_table VALUES (1, 2.5, 'a'), (2, NULL, 'b'), (?, 3, NULL);
 INSERT INTO test_table SELECT * FROM students;
 INSERT INTO some_schema.test_table SELECT * FROM another_schema.students;
 # DELETE
@@ -70,9 +70,10 @@ TEST(SelectHavingTest) {
   ASSERT_NOTNULL(group);
   ASSERT_EQ(group->columns->size(), 1);
   ASSERT_EQ(group->having->opType, kOpLess);
-  ASSERT(group->having->exprList->at(0)->isType(kExprFunctionRef));
-  ASSERT(group->having->exprList->at(1)->isType(kExprLiteralFloat));
-  ASSERT_EQ(group->having->exprList->at(1)->fval, -2.0);
+  ASSERT(group->having->operand(0)->isType(kExprFunctionRef));
+  ASSERT(group->having->operand(1)->isType(kExprLiteralFloat));
+  ASSERT_EQ(group->having->operand(1)->fval, -2.0);
+  ASSERT_EQ(group->having->operand(1)->ival, 0);
 }
 
 
@@ -147,14 +148,14 @@ TEST(SelectBetweenTest) {
   ASSERT(where->isType(kExprOperator));
   ASSERT_EQ(where->opType, kOpBetween);
 
-  ASSERT_STREQ(where->exprList->at(0)->getName(), "grade");
-  ASSERT(where->exprList->at(0)->isType(kExprColumnRef));
+  ASSERT_STREQ(where->operand(0)->getName(), "grade");
+  ASSERT(where->operand(0)->isType(kExprColumnRef));
 
-  ASSERT_EQ(where->exprList->size(), 3);
-  ASSERT(where->exprList->at(1)->isType(kExprLiteralInt));
-  ASSERT_EQ(where->exprList->at(1)->ival, -1);
-  ASSERT(where->exprList->at(2)->isType(kExprColumnRef));
-  ASSERT_STREQ(where->exprList->at(2)->getName(), "c");
+  ASSERT_EQ(where->numOperands(), 3);
+  ASSERT(where->operand(1)->isType(kExprLiteralInt));
+  ASSERT_EQ(where->operand(1)->ival, -1);
+  ASSERT(where->operand(2)->isType(kExprColumnRef));
+  ASSERT_STREQ(where->operand(2)->getName(), "c");
 }
 
 TEST(SelectConditionalSelectTest) {
@@ -171,17 +172,18 @@ TEST(SelectConditionalSelectTest) {
   ASSERT_EQ(where->opType, kOpAnd);
 
   // a = (SELECT ...)
+  ASSERT_EQ(where->exprList->size(), 2);
   Expr* cond1 = where->exprList->at(0);
   ASSERT_NOTNULL(cond1);
-  ASSERT_NOTNULL(cond1->exprList->at(0));
+  ASSERT_NOTNULL(cond1->operand(0));
   ASSERT_EQ(cond1->opType, kOpEquals);
-  ASSERT_STREQ(cond1->exprList->at(0)->getName(), "a");
-  ASSERT(cond1->exprList->at(0)->isType(kExprColumnRef));
+  ASSERT_STREQ(cond1->operand(0)->getName(), "a");
+  ASSERT(cond1->operand(0)->isType(kExprColumnRef));
 
-  ASSERT_NOTNULL(cond1->exprList->at(1));
-  ASSERT(cond1->exprList->at(1)->isType(kExprSelect));
+  ASSERT_NOTNULL(cond1->operand(1));
+  ASSERT(cond1->operand(1)->isType(kExprSelect));
 
-  SelectStatement* select2 = cond1->exprList->at(1)->select;
+  SelectStatement* select2 = cond1->operand(1)->select;
   ASSERT_NOTNULL(select2);
   ASSERT_STREQ(select2->fromTable->getName(), "tt");
 
@@ -214,9 +216,319 @@ TEST(SelectCaseWhen) {
   ASSERT(caseExpr->isType(kExprOperator));
   ASSERT_EQ(caseExpr->opType, kOpCase);
 
-  ASSERT(caseExpr->exprList->at(0)->isType(kExprOperator));
-  ASSERT_EQ(caseExpr->exprList->at(0)->opType, kOpEquals);
-  ASSERT_EQ(caseExpr->exprList->size(), 3);
+  ASSERT(caseExpr->operand(0)->isType(kExprOperator));
+  ASSERT_EQ(caseExpr->operand(0)->opType, kOpEquals);
+  ASSERT_EQ(caseExpr->numOperands(), 3);
+}
+
+TEST(SelectInListTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT * FROM students WHERE grade IN (1, 2, 3);",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  Expr* in = stmt->whereClause;
+  ASSERT(in->isType(kExprOperator));
+  ASSERT_EQ(in->opType, kOpIn);
+  ASSERT_STREQ(in->expr->getName(), "grade");
+  ASSERT_NULL(in->expr2);
+  ASSERT_EQ(in->inListSize(), 3);
+
+  // Lists of literals of one type are kept as plain values.
+  ASSERT_NULL(in->exprList);
+  ASSERT_EQ(in->inValues->type, kValuesInt);
+  ASSERT_EQ(in->inValues->cells[0].ival, 1);
+  ASSERT_EQ(in->inValues->cells[2].ival, 3);
+  InValue value = in->inValue(1);
+  ASSERT_EQ(value.type, kValuesInt);
+  ASSERT_EQ(value.cell.ival, 2);
+
+  // Passes that rewrite the values can expand the list.
+  in->expandInList();
+  ASSERT_NULL(in->inValues);
+  ASSERT_EQ(in->exprList->size(), 3);
+  ASSERT_EQ(in->exprList->at(0)->ival, 1);
+  ASSERT_EQ(in->exprList->at(2)->ival, 3);
+  ASSERT_EQ(in->exprList->at(2)->arena(), result.arena());
+}
+
+TEST(SelectTypedInListTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT * FROM t WHERE a IN ('x', NULL, 'z') AND b NOT IN (1.5, 2.5) AND c IN (1, 'y', d);",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  Expr* in = stmt->whereClause->exprList->at(0);
+  ASSERT_EQ(in->inListSize(), 3);
+  ASSERT_EQ(in->inValues->type, kValuesString);
+  ASSERT_STREQ(in->inValues->cells[0].sval, "x");
+  ASSERT(in->inValues->isNull(1));
+  ASSERT_FALSE(in->inValues->isNull(2));
+  InValue value = in->inValue(1);
+  ASSERT_EQ(value.type, kValuesNull);
+  value = in->inValue(2);
+  ASSERT_EQ(value.type, kValuesString);
+  ASSERT_STREQ(value.cell.sval, "z");
+  Expr* literal = in->inValues->makeLiteral(2);
+  ASSERT_STREQ(literal->name, "z");
+  delete literal;
+
+  in = stmt->whereClause->exprList->at(1);
+  ASSERT_EQ(in->opType, kOpNot);
+  ASSERT_EQ(in->expr->inValues->type, kValuesFloat);
+  ASSERT_EQ(in->expr->inValues->cells[1].fval, 2.5);
+
+  // Lists of other values keep one expression per value.
+  in = stmt->whereClause->exprList->at(2);
+  ASSERT_EQ(in->inListSize(), 3);
+  ASSERT_NULL(in->inValues);
+  ASSERT_EQ(in->exprList->at(0)->ival, 1);
+  ASSERT_STREQ(in->exprList->at(1)->name, "y");
+  ASSERT_STREQ(in->exprList->at(2)->name, "d");
+  value = in->inValue(2);
+  ASSERT_EQ(value.type, kValuesExpr);
+  ASSERT_EQ(value.cell.expr, in->exprList->at(2));
+}
+
+TEST(SelectFlatConjunctionTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT * FROM t WHERE a = 1 AND (b = 2 AND c = 3) AND (d = 4 OR e = 5 OR f = 6);",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  Expr* where = stmt->whereClause;
+  ASSERT_EQ(where->opType, kOpAnd);
+  ASSERT_EQ(where->exprList->size(), 4);
+  ASSERT_STREQ(where->exprList->at(1)->expr->getName(), "b");
+  ASSERT_STREQ(where->exprList->at(2)->expr->getName(), "c");
+
+  Expr* disjunction = where->exprList->at(3);
+  ASSERT_EQ(disjunction->opType, kOpOr);
+  ASSERT_EQ(disjunction->exprList->size(), 3);
+  ASSERT_STREQ(disjunction->exprList->at(2)->expr->getName(), "f");
+}
+
+TEST(SelectLongConjunctionTest) {
+  const size_t numConjuncts = 100000;
+  std::string query = "SELECT * FROM t WHERE a = 0";
+  for (size_t i = 1; i < numConjuncts; ++i) {
+    query += " AND a = " + std::to_string(i);
+  }
+
+  TEST_PARSE_SINGLE_SQL(query, kStmtSelect, SelectStatement, result, stmt);
+  ASSERT_EQ(stmt->whereClause->exprList->size(), numConjuncts);
+  ASSERT_EQ(stmt->whereClause->exprList->back()->expr2->ival, (int64_t) numConjuncts - 1);
+}
+
+TEST(SelectDeepExpressionTeardownTest) {
+  // Arithmetic chains are left-deep trees.
+  const size_t numOperands = 200000;
+  std::string query = "SELECT a0";
+  for (size_t i = 1; i < numOperands; ++i) {
+    query += " + a" + std::to_string(i);
+  }
+  query += " FROM t;";
+
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  ASSERT(result.isValid());
+
+  // Deleting a released statement destroys the tree node by node.
+  std::vector<SQLStatement*> statements = result.releaseStatements();
+  result.reset();
+  for (SQLStatement* stmt : statements) {
+    delete stmt;
+  }
+}
+
+TEST(SelectSetOperationTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT TOP 3 a FROM t1 UNION ALL SELECT a FROM t2 EXCEPT (SELECT a FROM t3 ORDER BY a LIMIT 1) INTERSECT SELECT a FROM t4 ORDER BY a DESC LIMIT 10;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  // The first select keeps its own limit (TOP 3).
+  ASSERT_STREQ(stmt->fromTable->name, "t1");
+  ASSERT_EQ(stmt->limit->limit, 3);
+  ASSERT_NULL(stmt->order);
+
+  const SetOperation* operation = stmt->setOperation;
+  ASSERT_NOTNULL(operation);
+  ASSERT_EQ(operation->branches->size(), 2);
+
+  const SetBranch& first = operation->branches->at(0);
+  ASSERT_EQ(first.type, kSetUnion);
+  ASSERT(first.all);
+  ASSERT_STREQ(first.select->fromTable->name, "t2");
+
+  const SetBranch& second = operation->branches->at(1);
+  ASSERT_EQ(second.type, kSetExcept);
+  ASSERT_FALSE(second.all);
+  ASSERT_STREQ(second.select->fromTable->name, "t3");
+  ASSERT_EQ(second.select->order->size(), 1);
+  ASSERT_EQ(second.select->limit->limit, 1);
+
+  // INTERSECT binds more tightly, so it continues the select in front of it.
+  ASSERT_EQ(second.select->setOperation->branches->size(), 1);
+  const SetBranch& third = second.select->setOperation->branches->at(0);
+  ASSERT_EQ(third.type, kSetIntersect);
+  ASSERT_STREQ(third.select->fromTable->name, "t4");
+  ASSERT_NULL(third.select->setOperation);
+  ASSERT_NULL(second.select->setOperation->order);
+  ASSERT_NULL(second.select->setOperation->limit);
+
+  ASSERT_EQ(operation->order->size(), 1);
+  ASSERT_EQ(operation->order->at(0)->type, kOrderDesc);
+  ASSERT_EQ(operation->limit->limit, 10);
+}
+
+TEST(SelectSetOperationPrecedenceTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "SELECT a FROM t1 INTERSECT SELECT a FROM t2 UNION SELECT a FROM t3 INTERSECT SELECT a FROM t4 "
+    "INTERSECT ALL SELECT a FROM t5 EXCEPT SELECT a FROM t6 INTERSECT (SELECT a FROM t7 UNION SELECT a FROM t8);",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  // (t1 INTERSECT t2) UNION (t3 INTERSECT t4 INTERSECT ALL t5) EXCEPT (t6 INTERSECT (t7 UNION t8))
+  const SetOperation* operation = stmt->setOperation;
+  ASSERT_EQ(operation->branches->size(), 3);
+  ASSERT_EQ(operation->branches->at(0).type, kSetIntersect);
+  ASSERT_STREQ(operation->branches->at(0).select->fromTable->name, "t2");
+  ASSERT_NULL(operation->branches->at(0).select->setOperation);
+
+  const SetBranch& second = operation->branches->at(1);
+  ASSERT_EQ(second.type, kSetUnion);
+  ASSERT_STREQ(second.select->fromTable->name, "t3");
+  const SetOperation* intersect = second.select->setOperation;
+  ASSERT_EQ(intersect->branches->size(), 2);
+  ASSERT_EQ(intersect->branches->at(0).type, kSetIntersect);
+  ASSERT_STREQ(intersect->branches->at(0).select->fromTable->name, "t4");
+  ASSERT_EQ(intersect->branches->at(1).type, kSetIntersect);
+  ASSERT(intersect->branches->at(1).all);
+  ASSERT_STREQ(intersect->branches->at(1).select->fromTable->name, "t5");
+
+  const SetBranch& third = operation->branches->at(2);
+  ASSERT_EQ(third.type, kSetExcept);
+  ASSERT_STREQ(third.select->fromTable->name, "t6");
+  intersect = third.select->setOperation;
+  ASSERT_EQ(intersect->branches->size(), 1);
+  const SelectStatement* group = intersect->branches->at(0).select;
+  ASSERT_STREQ(group->fromTable->name, "t7");
+  ASSERT_EQ(group->setOperation->branches->at(0).type, kSetUnion);
+}
+
+TEST(SelectParenSetOperationTest) {
+  SQLParserResult result;
+  SQLParser::parse(
+    "(SELECT a FROM t1 UNION SELECT a FROM t2) EXCEPT SELECT a FROM t3;"
+    "(SELECT a FROM t1 UNION SELECT a FROM t2) INTERSECT SELECT a FROM t3;"
+    "(SELECT a FROM t1 UNION SELECT a FROM t2 LIMIT 5) UNION SELECT a FROM t3 LIMIT 10;"
+    "SELECT a FROM t1 UNION (SELECT a FROM t2 INTERSECT SELECT a FROM t3);", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 4);
+
+  // The group is extended, since the operators are evaluated from left to right.
+  const SelectStatement* select = (const SelectStatement*) result.getStatement(0);
+  ASSERT_STREQ(select->fromTable->name, "t1");
+  ASSERT_EQ(select->setOperation->branches->size(), 2);
+  ASSERT_EQ(select->setOperation->branches->at(1).type, kSetExcept);
+  ASSERT_NULL(select->setOperation->nested);
+
+  // INTERSECT binds more tightly than the UNION in the group, which is
+  // nested in the INTERSECT chain.
+  select = (const SelectStatement*) result.getStatement(1);
+  ASSERT_STREQ(select->fromTable->name, "t1");
+  ASSERT_EQ(select->setOperation->branches->size(), 1);
+  ASSERT_EQ(select->setOperation->branches->at(0).type, kSetIntersect);
+  ASSERT_STREQ(select->setOperation->branches->at(0).select->fromTable->name, "t3");
+  const SetOperation* nested = select->setOperation->nested;
+  ASSERT_NOTNULL(nested);
+  ASSERT_EQ(nested->branches->size(), 1);
+  ASSERT_EQ(nested->branches->at(0).type, kSetUnion);
+  ASSERT_STREQ(nested->branches->at(0).select->fromTable->name, "t2");
+  ASSERT_NULL(nested->nested);
+
+  // The limit of the group only applies to the group.
+  select = (const SelectStatement*) result.getStatement(2);
+  ASSERT_STREQ(select->fromTable->name, "t1");
+  ASSERT_EQ(select->setOperation->limit->limit, 10);
+  ASSERT_EQ(select->setOperation->nested->limit->limit, 5);
+
+  // Parenthesized groups stay nested.
+  select = (const SelectStatement*) result.getStatement(3);
+  ASSERT_EQ(select->setOperation->branches->size(), 1);
+  const SelectStatement* group = select->setOperation->branches->at(0).select;
+  ASSERT_STREQ(group->fromTable->name, "t2");
+  ASSERT_EQ(group->setOperation->branches->at(0).type, kSetIntersect);
+}
+
+TEST(SelectParenSetOperationTreeTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "(SELECT a FROM t UNION SELECT b FROM u) EXCEPT SELECT c FROM v;",
+    kStmtSelect,
+    SelectStatement,
+    result,
+    stmt);
+
+  // A UNION B EXCEPT C is evaluated from left to right, so the group
+  // becomes the start of one flat chain.
+  ASSERT_EQ(stmt->selectList->size(), 1);
+  ASSERT_STREQ(stmt->selectList->at(0)->name, "a");
+  ASSERT_STREQ(stmt->fromTable->name, "t");
+  ASSERT_NULL(stmt->order);
+  ASSERT_NULL(stmt->limit);
+
+  const SetOperation* operation = stmt->setOperation;
+  ASSERT_NOTNULL(operation);
+  ASSERT_NULL(operation->nested);
+  ASSERT_NULL(operation->order);
+  ASSERT_NULL(operation->limit);
+  ASSERT_EQ(operation->branches->size(), 2);
+
+  const SetBranch& first = operation->branches->at(0);
+  ASSERT_EQ(first.type, kSetUnion);
+  ASSERT_FALSE(first.all);
+  ASSERT_STREQ(first.select->selectList->at(0)->name, "b");
+  ASSERT_STREQ(first.select->fromTable->name, "u");
+  ASSERT_NULL(first.select->setOperation);
+
+  const SetBranch& second = operation->branches->at(1);
+  ASSERT_EQ(second.type, kSetExcept);
+  ASSERT_FALSE(second.all);
+  ASSERT_STREQ(second.select->selectList->at(0)->name, "c");
+  ASSERT_STREQ(second.select->fromTable->name, "v");
+  ASSERT_NULL(second.select->setOperation);
+}
+
+TEST(SelectLongUnionChainTest) {
+  const size_t numSelects = 50000;
+  std::string query = "SELECT a FROM t0";
+  for (size_t i = 1; i < numSelects; ++i) {
+    query += " UNION ALL SELECT a FROM t" + std::to_string(i);
+  }
+
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  ASSERT(result.isValid());
+  const SelectStatement* stmt = (const SelectStatement*) result.getStatement(0);
+  ASSERT_EQ(stmt->setOperation->branches->size(), numSelects - 1);
+  ASSERT_STREQ(stmt->setOperation->branches->back().select->fromTable->name, "t49999");
+
+  std::vector<SQLStatement*> statements = result.releaseStatements();
+  result.reset();
+  for (SQLStatement* released : statements) {
+    delete released;
+  }
 }
 
 TEST(SelectJoin) {
@@ -238,10 +550,10 @@ TEST(SelectJoin) {
   ASSERT_EQ(outer_join->right->type, kTableName);
   ASSERT_STREQ(outer_join->right->name, "Product");
   ASSERT_EQ(outer_join->condition->opType, kOpEquals);
-  ASSERT_STREQ(outer_join->condition->exprList->at(0)->table, "fact");
-  ASSERT_STREQ(outer_join->condition->exprList->at(0)->name, "product_id");
-  ASSERT_STREQ(outer_join->condition->exprList->at(1)->table, "Product");
-  ASSERT_STREQ(outer_join->condition->exprList->at(1)->name, "id");
+  ASSERT_STREQ(outer_join->condition->operand(0)->table, "fact");
+  ASSERT_STREQ(outer_join->condition->operand(0)->name, "product_id");
+  ASSERT_STREQ(outer_join->condition->operand(1)->table, "Product");
+  ASSERT_STREQ(outer_join->condition->operand(1)->name, "id");
 
   // Joins are are left associative.
   // So the second join should be on the left.
@@ -255,8 +567,8 @@ TEST(SelectJoin) {
   ASSERT_STREQ(inner_join->right->name, "City");
 
   ASSERT_EQ(inner_join->condition->opType, kOpEquals);
-  ASSERT_STREQ(inner_join->condition->exprList->at(0)->table, "fact");
-  ASSERT_STREQ(inner_join->condition->exprList->at(0)->name, "city_id");
-  ASSERT_STREQ(inner_join->condition->exprList->at(1)->table, "City");
-  ASSERT_STREQ(inner_join->condition->exprList->at(1)->name, "id");
+  ASSERT_STREQ(inner_join->condition->operand(0)->table, "fact");
+  ASSERT_STREQ(inner_join->condition->operand(0)->name, "city_id");
+  ASSERT_STREQ(inner_join->condition->operand(1)->table, "City");
+  ASSERT_STREQ(inner_join->condition->operand(1)->name, "id");
 }
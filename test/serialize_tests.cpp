@@ -0,0 +1,249 @@
+/*
+ * serialize_tests.cpp
+ */
+
+#include "thirdparty/microtest/microtest.h"
+
+#include "SQLParser.h"
+#include "util/serialize.h"
+
+using namespace hsql;
+
+
+TEST(SerializeReadInPlaceTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT a, b AS c FROM s.t WHERE a IN (1, 2, 3) AND b = ? ORDER BY a DESC LIMIT 5;", &result);
+  ASSERT(result.isValid());
+
+  std::string image;
+  result.serialize(&image);
+  const binary::Result* encoded = binary::open(image.data(), image.size());
+  ASSERT_NOTNULL(encoded);
+  ASSERT(encoded->isValid);
+  ASSERT_EQ(encoded->statements->size, 1);
+
+  const binary::Statement* stmt = (*encoded->statements)[0].get();
+  ASSERT_EQ(stmt->type, kStmtSelect);
+  const binary::Select* select = (const binary::Select*) stmt;
+  ASSERT_EQ(select->selectList->size, 2);
+  ASSERT_STREQ((*select->selectList)[0]->name.get(), "a");
+  ASSERT_STREQ((*select->selectList)[1]->rest().alias.get(), "c");
+  ASSERT_FALSE((*select->selectList)[0]->tail);
+  ASSERT_STREQ(select->fromTable->schema.get(), "s");
+  ASSERT_STREQ(select->fromTable->name.get(), "t");
+  ASSERT_FALSE(select->fromTable->alias);
+
+  const binary::Expr* where = select->whereClause.get();
+  ASSERT_EQ(where->opType, kOpAnd);
+  ASSERT_EQ(where->rest().exprList->size, 2);
+
+  // IN lists of literals stay typed arrays.
+  const binary::Expr* in = (*where->rest().exprList)[0].get();
+  ASSERT_EQ(in->opType, kOpIn);
+  ASSERT_FALSE(in->rest().exprList);
+  ASSERT_EQ(in->rest().inValues->type, kValuesInt);
+  ASSERT_EQ(in->rest().inValues->cells->size, 3);
+  ASSERT_EQ((*in->rest().inValues->cells)[2].ival, 3);
+
+  // The placeholders refer to their records within the statement.
+  ASSERT_EQ(encoded->parameters->size, 1);
+  ASSERT_EQ((*encoded->parameters)[0].get(), (*where->rest().exprList)[1]->expr2.get());
+  ASSERT_EQ((*encoded->parameters)[0]->type, kExprParameter);
+
+  ASSERT_EQ(select->order->size, 1);
+  ASSERT_EQ((*select->order)[0].type, kOrderDesc);
+  ASSERT_EQ(select->limit->limit, 5);
+  ASSERT_FALSE(select->setOperation);
+}
+
+TEST(SerializeStatementsTest) {
+  SQLParserResult result;
+  SQLParser::parse("UPDATE students SET grade = 1.3, name = ? WHERE name = 'Max';"
+                   "DELETE FROM s.students WHERE grade > 3.0;"
+                   "DROP TABLE IF EXISTS students;"
+                   "PREPARE prep FROM 'SELECT * FROM t WHERE a = ?';"
+                   "EXECUTE prep(1, 'a');"
+                   "SHOW COLUMNS s.students;"
+                   "CREATE VIEW v (a, b) AS SELECT a, b FROM t;"
+                   "CREATE TABLE IF NOT EXISTS students (name TEXT, grade DOUBLE);"
+                   "INSERT INTO students (name, grade, city) VALUES ('Max', 1.3, NULL), (?, NULL, 'x');"
+                   "IMPORT FROM CSV FILE 'students.csv' INTO s.students;"
+                   "SELECT a FROM t1 UNION ALL SELECT a FROM t2 ORDER BY a LIMIT 3 WITH HINT(NO_CACHE);", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 11);
+
+  std::string image;
+  result.serialize(&image);
+  SQLParserResult decoded;
+  ASSERT(decoded.deserialize(image.data(), image.size()));
+  ASSERT_EQ(decoded.size(), 11);
+  ASSERT_EQ(decoded.parameters().size(), 2);
+  ASSERT_EQ(decoded.parameters()[1]->ival, 1);
+
+  std::string copy;
+  decoded.serialize(&copy);
+  ASSERT(copy == image);
+
+  const UpdateStatement* update = (const UpdateStatement*) decoded.getStatement(0);
+  ASSERT_STREQ(update->table->name, "students");
+  ASSERT_STREQ(update->updates->at(1)->column, "name");
+  ASSERT_EQ(update->updates->at(1)->value, decoded.parameters()[0]);
+  ASSERT_STREQ(update->where->expr2->name, "Max");
+
+  const DeleteStatement* del = (const DeleteStatement*) decoded.getStatement(1);
+  ASSERT_STREQ(del->schema, "s");
+  ASSERT_EQ(del->expr->expr2->fval, 3.0);
+
+  const DropStatement* drop = (const DropStatement*) decoded.getStatement(2);
+  ASSERT_EQ(drop->type, kDropTable);
+  ASSERT(drop->ifExists);
+
+  // The parsed query of a prepared statement is part of the image.
+  const PrepareStatement* prepare = (const PrepareStatement*) decoded.getStatement(3);
+  ASSERT_STREQ(prepare->name, "prep");
+  ASSERT_NOTNULL(prepare->prepared);
+  ASSERT(prepare->prepared->isValid());
+  ASSERT_EQ(prepare->prepared->parameters().size(), 1);
+
+  const ExecuteStatement* execute = (const ExecuteStatement*) decoded.getStatement(4);
+  ASSERT_EQ(execute->parameters->size(), 2);
+  ASSERT_STREQ(execute->parameters->at(1)->name, "a");
+
+  const ShowStatement* show = (const ShowStatement*) decoded.getStatement(5);
+  ASSERT_EQ(show->type, kShowColumns);
+  ASSERT_STREQ(show->name, "students");
+
+  const CreateStatement* create = (const CreateStatement*) decoded.getStatement(6);
+  ASSERT_EQ(create->type, kCreateView);
+  ASSERT_STREQ(create->viewColumns->at(1), "b");
+  ASSERT_EQ(create->select->selectList->size(), 2);
+
+  create = (const CreateStatement*) decoded.getStatement(7);
+  ASSERT(create->ifNotExists);
+  ASSERT_EQ(create->columns->at(1)->type, ColumnDefinition::DOUBLE);
+
+  const InsertStatement* insert = (const InsertStatement*) decoded.getStatement(8);
+  ASSERT_EQ(insert->columns->size(), 3);
+  ASSERT_EQ(insert->rows->numRows, 2);
+  ASSERT_EQ(insert->rows->columns->at(0).type, kValuesExpr);
+  ASSERT_EQ(insert->rows->columns->at(0).cells[1].expr, decoded.parameters()[1]);
+  ASSERT(insert->rows->columns->at(1).isNull(1));
+  ASSERT_FALSE(insert->rows->columns->at(1).isNull(0));
+  ASSERT_STREQ(insert->rows->columns->at(2).cells[1].sval, "x");
+
+  const ImportStatement* import = (const ImportStatement*) decoded.getStatement(9);
+  ASSERT_EQ(import->type, kImportCSV);
+  ASSERT_STREQ(import->filePath, "students.csv");
+
+  const SelectStatement* select = (const SelectStatement*) decoded.getStatement(10);
+  ASSERT_EQ(select->hints->size(), 1);
+  ASSERT_EQ(select->setOperation->branches->size(), 1);
+  ASSERT(select->setOperation->branches->at(0).all);
+  ASSERT_EQ(select->setOperation->limit->limit, 3);
+}
+
+TEST(SerializeErrorTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT * FROM;", &result);
+  ASSERT_FALSE(result.isValid());
+
+  std::string image;
+  result.serialize(&image);
+  SQLParserResult decoded;
+  ASSERT(decoded.deserialize(image.data(), image.size()));
+  ASSERT_FALSE(decoded.isValid());
+  ASSERT_EQ(decoded.size(), 0);
+  ASSERT_STREQ(decoded.errorMsg(), result.errorMsg());
+  ASSERT_EQ(decoded.errorLine(), result.errorLine());
+  ASSERT_EQ(decoded.errorColumn(), result.errorColumn());
+  ASSERT_EQ(decoded.errorOffset(), result.errorOffset());
+}
+
+TEST(SerializeOpenTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT * FROM t;", &result);
+  std::string image;
+  result.serialize(&image);
+  ASSERT_NOTNULL(binary::open(image.data(), image.size()));
+
+  // Truncated images are rejected.
+  ASSERT_NULL(binary::open(image.data(), image.size() - 1));
+  ASSERT_NULL(binary::open(image.data(), 4));
+
+  // So are unaligned images.
+  std::string shifted = " " + image;
+  ASSERT_NULL(binary::open(shifted.data() + 1, image.size()));
+
+  std::string corrupt = image;
+  corrupt[0] = 'X';
+  ASSERT_NULL(binary::open(corrupt.data(), corrupt.size()));
+
+  SQLParserResult decoded;
+  SQLParser::parse("SELECT * FROM u;", &decoded);
+  ASSERT_FALSE(decoded.deserialize(corrupt.data(), corrupt.size()));
+  ASSERT_FALSE(decoded.isValid());
+  ASSERT_EQ(decoded.size(), 0);
+}
+
+// Returns the first statement of an image, so that tests can corrupt it.
+static binary::Select* firstSelect(std::string* image) {
+  const binary::Result* encoded = binary::open(image->data(), image->size());
+  return (binary::Select*) (*encoded->statements)[0].get();
+}
+
+TEST(SerializeVerifyTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT a, b AS c FROM t WHERE a = 1;", &result);
+  std::string image;
+  result.serialize(&image);
+  ASSERT(binary::verify(image.data(), image.size()));
+
+  // References out of the image.
+  std::string corrupt = image;
+  binary::Expr* where = (binary::Expr*) firstSelect(&corrupt)->whereClause.get();
+  where->expr2.offset = corrupt.size();
+  ASSERT_FALSE(binary::verify(corrupt.data(), corrupt.size()));
+
+  // Cycles.
+  corrupt = image;
+  where = (binary::Expr*) firstSelect(&corrupt)->whereClause.get();
+  where->expr2.offset = (const char*) where - (const char*) &where->expr2;
+  ASSERT_FALSE(binary::verify(corrupt.data(), corrupt.size()));
+
+  // Unaligned records.
+  corrupt = image;
+  binary::Expr* column = (binary::Expr*) (*firstSelect(&corrupt)->selectList)[0].get();
+  column->tail.offset = (const char*) column + 4 - (const char*) &column->tail;
+  ASSERT_FALSE(binary::verify(corrupt.data(), corrupt.size()));
+
+  // Lists that run past the end.
+  corrupt = image;
+  ((binary::List<binary::Ref<binary::Expr>>*) firstSelect(&corrupt)->selectList.get())->size = corrupt.size();
+  ASSERT_FALSE(binary::verify(corrupt.data(), corrupt.size()));
+
+  // Strings that are not terminated.
+  corrupt = image;
+  column = (binary::Expr*) (*firstSelect(&corrupt)->selectList)[0].get();
+  column->name.offset = &corrupt.back() - (const char*) &column->name;
+  corrupt.back() = 'x';
+  ASSERT_FALSE(binary::verify(corrupt.data(), corrupt.size()));
+  ASSERT_NULL(binary::open(corrupt.data(), corrupt.size()));
+
+  SQLParserResult decoded;
+  ASSERT_FALSE(decoded.deserialize(corrupt.data(), corrupt.size()));
+  ASSERT_EQ(decoded.size(), 0);
+}
+
+TEST(SerializeInsertRowsVerifyTest) {
+  SQLParserResult result;
+  SQLParser::parse("INSERT INTO t VALUES (1, 'a'), (NULL, 'b');", &result);
+  std::string image;
+  result.serialize(&image);
+  ASSERT(binary::verify(image.data(), image.size()));
+
+  // Decoding relies on a cell per row.
+  const binary::Result* encoded = binary::open(image.data(), image.size());
+  const binary::Insert* insert = (const binary::Insert*) (*encoded->statements)[0].get();
+  ((binary::ValuesBlock*) insert->rows.get())->numRows = 3;
+  ASSERT_FALSE(binary::verify(image.data(), image.size()));
+}
@@ -26,6 +26,24 @@ TEST(SQLParserTokenizeTest) {
   test_tokens("SELECT a, 'b' FROM test WITH HINT;", { SQL_SELECT, SQL_IDENTIFIER, ',', SQL_STRING, SQL_FROM, SQL_IDENTIFIER, SQL_WITH, SQL_HINT, ';' });
 }
 
+TEST(SQLParserTokenizeCommentTest) {
+  // Comments end at the newline, also if whitespace follows it.
+  test_tokens("SELECT a -- comment\n  FROM test;", { SQL_SELECT, SQL_IDENTIFIER, SQL_FROM, SQL_IDENTIFIER, ';' });
+  test_tokens("SELECT a --\n\tFROM test -- last", { SQL_SELECT, SQL_IDENTIFIER, SQL_FROM, SQL_IDENTIFIER });
+  test_tokens("-- only a comment\n\n-- and another\n", {});
+
+  // The line after a comment is parsed, also after an empty line.
+  SQLParserResult result;
+  SQLParser::parse("SELECT a -- first\n\n  FROM test -- second\n  WHERE b = 1;", &result);
+  ASSERT(result.isValid());
+  ASSERT_NOTNULL(result.getStatement(0));
+  const SelectStatement* stmt = (const SelectStatement*) result.getStatement(0);
+  ASSERT_STREQ(stmt->fromTable->getName(), "test");
+  ASSERT_NOTNULL(stmt->whereClause);
+
+  test_tokens("a-1 1.5.5 -.5 <>>=||", { SQL_IDENTIFIER, SQL_INTVAL, SQL_FLOATVAL, SQL_FLOATVAL, '-', SQL_FLOATVAL, SQL_NOTEQUALS, SQL_GREATEREQ, SQL_CONCAT });
+}
+
 TEST(SQLParserTokenizeStringifyTest) {
   const std::string query = "SELECT * FROM test;";
   std::vector<int16_t> tokens;
@@ -42,3 +60,250 @@ TEST(SQLParserTokenizeStringifyTest) {
   ASSERT(&query != &cache[token_string]);
 }
 
+
+TEST(SQLParserContextReuseTest) {
+  SQLParserContext context;
+
+  for (int i = 0; i < 3; ++i) {
+    SQLParserResult result;
+    ASSERT(context.parse("SELECT a FROM test WHERE b = 'x';", &result));
+    ASSERT(result.isValid());
+    ASSERT_EQ(result.size(), 1);
+  }
+
+  // An invalid query does not affect the following ones.
+  SQLParserResult invalid;
+  context.parse("SELECT FROM WHERE;", &invalid);
+  ASSERT_FALSE(invalid.isValid());
+
+  // Neither does a query that ends within a comment.
+  SQLParserResult comment;
+  context.parse("SELECT * FROM test; -- trailing comment", &comment);
+  ASSERT(comment.isValid());
+
+  SQLParserResult result;
+  context.parse("SELECT * FROM students;", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  std::vector<int16_t> tokens;
+  ASSERT(context.tokenize("SELECT * FROM test;", &tokens));
+  ASSERT_EQ(tokens.size(), 5);
+  tokens.clear();
+  ASSERT(context.tokenize("SELECT a, 'b' FROM test;", &tokens));
+  ASSERT_EQ(tokens.size(), 7);
+}
+
+TEST(SQLParserBufferTest) {
+  // Only the first statement is part of the input.
+  const char* data = "SELECT * FROM students; DELETE FROM students;";
+  SQLParserResult result;
+  ASSERT(SQLParser::parse(data, 23, &result));
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+  ASSERT_EQ(result.getStatement(0)->type(), kStmtSelect);
+}
+
+TEST(SQLParserInPlaceTest) {
+  const std::string query = "SELECT name FROM students WHERE grade > 2;";
+  std::vector<char> buffer(query.begin(), query.end());
+  buffer.resize(query.size() + SQLParserContext::kScanPadding, '\0');
+
+  SQLParserContext context;
+  SQLParserResult result;
+  ASSERT(context.parseInPlace(buffer.data(), query.size(), &result));
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  // The strings of the result point into the buffer.
+  const SelectStatement* stmt = (const SelectStatement*) result.getStatement(0);
+  ASSERT_EQ(stmt->selectList->at(0)->name, buffer.data() + 7);
+  ASSERT_STREQ(stmt->selectList->at(0)->name, "name");
+  ASSERT_EQ(stmt->fromTable->name, buffer.data() + 17);
+  ASSERT_STREQ(stmt->fromTable->name, "students");
+  ASSERT_STREQ(stmt->whereClause->expr->name, "grade");
+
+  // Only the characters following them are overwritten.
+  std::string expected = query;
+  expected[11] = expected[25] = expected[37] = '\0';
+  ASSERT(std::string(buffer.data(), query.size()) == expected);
+
+  // Parse errors are reported at their position in the buffer.
+  const std::string invalid = "SELECT name\nFROM WHERE;";
+  buffer.assign(invalid.begin(), invalid.end());
+  buffer.resize(invalid.size() + SQLParserContext::kScanPadding, '\0');
+  SQLParserResult error;
+  ASSERT(context.parseInPlace(buffer.data(), invalid.size(), &error));
+  ASSERT_FALSE(error.isValid());
+  ASSERT_EQ(error.errorLine(), 1);
+  ASSERT_EQ(error.errorColumn(), 5);
+
+  // Inputs without padding are rejected.
+  std::vector<char> unpadded(query.begin(), query.end());
+  unpadded.push_back('\0');
+  unpadded.push_back(';');
+  SQLParserResult rejected;
+  ASSERT_FALSE(context.parseInPlace(unpadded.data(), query.size(), &rejected));
+}
+
+TEST(SQLParserErrorLocationTest) {
+  const std::string query = "SELECT name\nFROM students\n  WHERE grade >;";
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  ASSERT_FALSE(result.isValid());
+
+  // Lines and columns are counted from 0.
+  ASSERT_EQ(result.errorOffset(), (int) query.find(';'));
+  ASSERT_EQ(result.errorLine(), 2);
+  ASSERT_EQ(result.errorColumn(), 15);
+
+  result.reset();
+  ASSERT_EQ(result.errorOffset(), -1);
+  ASSERT_EQ(result.errorLine(), -1);
+}
+
+TEST(SQLParserResultRecycleTest) {
+  // Large enough to need multiple arena blocks.
+  std::string large = "SELECT * FROM test WHERE a IN (c0";
+  for (int i = 1; i < 2000; ++i) large += ", c" + std::to_string(i);
+  large += ");";
+
+  SQLParserContext context;
+  SQLParserResult result;
+  for (int i = 0; i < 3; ++i) {
+    result.reset();
+    context.parse("SELECT a FROM test WHERE b = ? AND c = ?;", &result);
+    ASSERT(result.isValid());
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(result.parameters().size(), 2);
+    ASSERT_NULL(result.errorMsg());
+
+    result.reset();
+    context.parse(large, &result);
+    ASSERT(result.isValid());
+    ASSERT_EQ(result.getStatement(0)->type(), kStmtSelect);
+
+    // Statements before the error are not part of the result.
+    result.reset();
+    context.parse("SELECT * FROM a; SELECT * FROM b WHERE;", &result);
+    ASSERT_FALSE(result.isValid());
+    ASSERT_EQ(result.size(), 0);
+    ASSERT_NOTNULL(result.errorMsg());
+    ASSERT_EQ(result.errorLine(), 0);
+  }
+
+  result.reset();
+  ASSERT_NULL(result.errorMsg());
+  ASSERT_EQ(result.size(), 0);
+  ASSERT_EQ(result.parameters().size(), 0);
+}
+
+TEST(SQLParserBatchTest) {
+  // Every hundredth query is invalid.
+  std::vector<std::string> queries;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 100 == 99) {
+      queries.push_back("SELECT FROM WHERE;");
+    } else {
+      queries.push_back("SELECT " + std::to_string(i) + " FROM test;");
+    }
+  }
+
+  for (size_t numThreads : {1, 4, 0}) {
+    std::vector<SQLParserResult> results;
+    ASSERT(SQLParser::parseBatch(queries, &results, numThreads));
+    ASSERT_EQ(results.size(), queries.size());
+
+    // Results are in the order of the queries.
+    for (size_t i = 0; i < queries.size(); ++i) {
+      if (i % 100 == 99) {
+        ASSERT_FALSE(results[i].isValid());
+        continue;
+      }
+      ASSERT(results[i].isValid());
+      const SelectStatement* stmt = (const SelectStatement*) results[i].getStatement(0);
+      ASSERT_EQ(stmt->selectList->at(0)->ival, (int64_t) i);
+    }
+
+    // The results are reset before they are reused.
+    std::vector<std::string> head(queries.begin(), queries.begin() + 100);
+    ASSERT(SQLParser::parseBatch(head, &results, numThreads));
+    ASSERT_EQ(results.size(), 100);
+    ASSERT_EQ(results[0].size(), 1);
+    ASSERT_FALSE(results[99].isValid());
+  }
+
+  std::vector<SQLParserResult> results;
+  ASSERT(SQLParser::parseBatch({}, &results));
+  ASSERT_EQ(results.size(), 0);
+}
+
+std::vector<std::string> split_statements(const std::string& script) {
+  std::vector<StatementRange> ranges;
+  splitStatements(script, &ranges);
+
+  std::vector<std::string> statements;
+  for (const StatementRange& range : ranges) {
+    statements.push_back(script.substr(range.begin, range.end - range.begin));
+  }
+  return statements;
+}
+
+TEST(SQLParserSplitStatementsTest) {
+  std::vector<std::string> statements = split_statements(
+    "SELECT * FROM a;\n"
+    "  INSERT INTO b VALUES ('x;y', 1) ; -- comment; not a statement\n"
+    "SELECT \"c;d\" FROM e -- trailing comment\n"
+    ";;  ;\n"
+    "SELECT a - -1, 'it' FROM f");
+  ASSERT_EQ(statements.size(), 4);
+  ASSERT_STREQ(statements[0], "SELECT * FROM a");
+  ASSERT_STREQ(statements[1], "INSERT INTO b VALUES ('x;y', 1)");
+  ASSERT_STREQ(statements[2], "SELECT \"c;d\" FROM e");
+  ASSERT_STREQ(statements[3], "SELECT a - -1, 'it' FROM f");
+
+  // Quotes can not span lines and quoted identifiers can not be empty.
+  statements = split_statements("SELECT 'a\n;b'; SELECT \"\" FROM c; SELECT 1");
+  ASSERT_EQ(statements.size(), 4);
+  ASSERT_STREQ(statements[0], "SELECT 'a");
+  ASSERT_STREQ(statements[1], "b'");
+  ASSERT_STREQ(statements[2], "SELECT \"\" FROM c");
+  ASSERT_STREQ(statements[3], "SELECT 1");
+
+  ASSERT_EQ(split_statements("").size(), 0);
+  ASSERT_EQ(split_statements(" ; -- SELECT;\n").size(), 0);
+}
+
+uint64_t fingerprint(const std::string& query) {
+  uint64_t digest = 0;
+  ASSERT(SQLParser::fingerprint(query, &digest));
+  return digest;
+}
+
+TEST(SQLParserFingerprintTest) {
+  const uint64_t base = fingerprint("SELECT name FROM students WHERE id = 1 AND grade IN (1, 2, 3);");
+
+  // Literals, IN lists of literals, case, whitespace and comments do not matter.
+  ASSERT_EQ(fingerprint("select NAME from Students where ID = 42 and grade in (-1.5, 'x');"), base);
+  ASSERT_EQ(fingerprint("SELECT name FROM students\n  WHERE id = ? -- comment\n  AND grade IN (?)"), base);
+  ASSERT_EQ(fingerprint("SELECT name FROM students WHERE id=-7 AND grade IN (1,- 2,3)"), base);
+
+  // The shape of the query does.
+  ASSERT_NEQ(fingerprint("SELECT name FROM students WHERE id = 1 OR grade IN (1, 2, 3);"), base);
+  ASSERT_NEQ(fingerprint("SELECT name FROM students WHERE id = 1 AND grade IN (1, a, 3);"), base);
+  ASSERT_NEQ(fingerprint("SELECT \"Name\" FROM students WHERE id = 1 AND grade IN (1, 2, 3);"), base);
+  ASSERT_NEQ(fingerprint("SELECT name FROM students WHERE id = 1 AND grade IN (1, 2, 3); SELECT 1;"), base);
+
+  // A minus before anything else than a number is an operator.
+  ASSERT_EQ(fingerprint("SELECT a - 1"), fingerprint("SELECT a -5"));
+  ASSERT_NEQ(fingerprint("SELECT a - b"), fingerprint("SELECT a b"));
+
+  // Quoted identifiers keep their case, and are never keywords.
+  ASSERT_EQ(fingerprint("SELECT \"name\" FROM t"), fingerprint("SELECT NAME FROM t"));
+  ASSERT_NEQ(fingerprint("SELECT \"select\" FROM t"), fingerprint("SELECT SELECT FROM t"));
+
+  // Subqueries in IN are not collapsed.
+  ASSERT_NEQ(fingerprint("SELECT a FROM t WHERE a IN (SELECT 1, 2 FROM u)"),
+             fingerprint("SELECT a FROM t WHERE a IN (SELECT 1 FROM u)"));
+  ASSERT_EQ(fingerprint("SELECT a FROM t WHERE a IN ((1), 2)"), fingerprint("SELECT a FROM t WHERE a IN ((3), 4, 5)"));
+}
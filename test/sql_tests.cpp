@@ -24,8 +24,8 @@ TEST(DeleteStatementTest) {
   ASSERT_STREQ(stmt->tableName, "students");
   ASSERT_NOTNULL(stmt->expr);
   ASSERT(stmt->expr->isType(kExprOperator));
-  ASSERT_STREQ(stmt->expr->exprList->at(0)->name, "grade");
-  ASSERT_EQ(stmt->expr->exprList->at(1)->fval, 2.0);
+  ASSERT_STREQ(stmt->expr->operand(0)->name, "grade");
+  ASSERT_EQ(stmt->expr->operand(1)->fval, 2.0);
 }
 
 TEST(CreateStatementTest) {
@@ -76,8 +76,8 @@ TEST(UpdateStatementTest) {
   ASSERT_NOTNULL(stmt->where);
   ASSERT(stmt->where->isType(kExprOperator));
   ASSERT_EQ(stmt->where->opType, kOpEquals);
-  ASSERT_STREQ(stmt->where->exprList->at(0)->name, "name");
-  ASSERT_STREQ(stmt->where->exprList->at(1)->name, "Max Mustermann");
+  ASSERT_STREQ(stmt->where->operand(0)->name, "name");
+  ASSERT_STREQ(stmt->where->operand(1)->name, "Max Mustermann");
 }
 
 TEST(InsertStatementTest) {
@@ -99,6 +99,76 @@ TEST(InsertStatementTest) {
   ASSERT_EQ(stmt->values->at(3)->fval, 2.0);
 }
 
+TEST(InsertMultipleRowsTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "INSERT INTO students (name, number, grade, note) VALUES "
+    "('Max', 12345, 2.0, NULL), ('Anna', 12346, NULL, 'new'), (NULL, 12347, 1.5, 3)",
+    kStmtInsert,
+    InsertStatement,
+    result,
+    stmt);
+
+  ASSERT_NULL(stmt->values);
+  ASSERT_NOTNULL(stmt->rows);
+  ASSERT_EQ(stmt->rows->numRows, 3);
+  ASSERT_EQ(stmt->rows->numColumns(), 4);
+
+  const ValuesColumn& names = stmt->rows->columns->at(0);
+  ASSERT_EQ(names.type, kValuesString);
+  ASSERT_STREQ(names.cells[0].sval, "Max");
+  ASSERT_STREQ(names.cells[1].sval, "Anna");
+  ASSERT(names.isNull(2));
+  ASSERT_FALSE(names.isNull(0));
+
+  const ValuesColumn& numbers = stmt->rows->columns->at(1);
+  ASSERT_EQ(numbers.type, kValuesInt);
+  ASSERT_EQ(numbers.cells[2].ival, 12347);
+
+  const ValuesColumn& grades = stmt->rows->columns->at(2);
+  ASSERT_EQ(grades.type, kValuesFloat);
+  ASSERT_EQ(grades.cells[2].fval, 1.5);
+  ASSERT(grades.isNull(1));
+
+  // Columns of mixed types keep expressions.
+  const ValuesColumn& notes = stmt->rows->columns->at(3);
+  ASSERT_EQ(notes.type, kValuesExpr);
+  ASSERT_NULL(notes.cells[0].expr);
+  ASSERT(notes.isNull(0));
+  ASSERT_STREQ(notes.cells[1].expr->name, "new");
+  ASSERT_EQ(notes.cells[2].expr->ival, 3);
+
+  Expr* literal = stmt->rows->makeLiteral(1, 0);
+  ASSERT(literal->isType(kExprLiteralString));
+  ASSERT_STREQ(literal->name, "Anna");
+  delete literal;
+  literal = stmt->rows->makeLiteral(2, 0);
+  ASSERT(literal->isType(kExprLiteralNull));
+  delete literal;
+}
+
+TEST(InsertMultipleRowsParametersTest) {
+  TEST_PARSE_SINGLE_SQL(
+    "INSERT INTO students VALUES (?, 1), (?, 2), ('Max', ?)",
+    kStmtInsert,
+    InsertStatement,
+    result,
+    stmt);
+
+  ASSERT_EQ(result.parameters().size(), 3);
+  const ValuesColumn& names = stmt->rows->columns->at(0);
+  ASSERT_EQ(names.type, kValuesExpr);
+  ASSERT_EQ(names.cells[1].expr, result.parameters()[1]);
+  ASSERT_STREQ(names.cells[2].expr->name, "Max");
+  ASSERT_EQ(stmt->rows->columns->at(1).cells[2].expr, result.parameters()[2]);
+
+  SQLParserResult rows;
+  SQLParser::parse("INSERT INTO students VALUES (1, 2), (3);", &rows);
+  ASSERT_FALSE(rows.isValid());
+  ASSERT_STREQ(rows.errorMsg(), "All rows of VALUES must have the same number of values");
+  SQLParser::parse("INSERT INTO students VALUES (1), (2, 3);", &rows);
+  ASSERT_FALSE(rows.isValid());
+}
+
 TEST(DropTableStatementTest) {
   TEST_PARSE_SINGLE_SQL(
     "DROP TABLE students",
@@ -1,6 +1,7 @@
 #include "thirdparty/microtest/microtest.h"
 
 #include "SQLParser.h"
+#include "util/jsonprinter.h"
 #include "util/sqlhelper.h"
 
 #include "sql_asserts.h"
@@ -99,18 +100,16 @@ TEST(TPCHQueryDetailTest) {
   ASSERT(where->isType(kExprOperator));
   ASSERT_EQ(where->opType, kOpAnd);
 
-  Expr* andExpr2 = where->exprList->at(0);
-  ASSERT_NOTNULL(andExpr2);
-  ASSERT(andExpr2->isType(kExprOperator));
-  ASSERT_EQ(andExpr2->opType, kOpAnd);
+  // The conjunctions are merged into a single node.
+  ASSERT_EQ(where->exprList->size(), 3);
 
   // Test IN expression.
-  Expr* inExpr = andExpr2->exprList->at(0);
+  Expr* inExpr = where->exprList->at(0);
   ASSERT_NOTNULL(inExpr);
   ASSERT(inExpr->isType(kExprOperator));
   ASSERT_EQ(inExpr->opType, kOpIn);
 
-  ASSERT_STREQ(inExpr->exprList->at(0)->getName(), "S_SUPPKEY");
+  ASSERT_STREQ(inExpr->operand(0)->getName(), "S_SUPPKEY");
   ASSERT_NOTNULL(inExpr->select);
   ASSERT_EQ(inExpr->select->selectList->size(), 1);
   ASSERT(inExpr->select->selectList->at(0)->isType(kExprColumnRef));
@@ -122,3 +121,52 @@ TEST(TPCHQueryDetailTest) {
   ASSERT(select20->order->at(0)->expr->isType(kExprColumnRef));
   ASSERT_STREQ(select20->order->at(0)->expr->getName(), "S_NAME");
 }
+
+TEST(TPCHSerializeRoundTripTest) {
+  for (int i = 1; i <= 22; ++i) {
+    char file_path[64];
+    snprintf(file_path, sizeof(file_path), "test/queries/tpc-h-%02d.sql", i);
+    std::string query = readFileContents(file_path);
+
+    SQLParserResult result;
+    SQLParser::parse(query, &result);
+    ASSERT(result.isValid());
+
+    std::string image;
+    result.serialize(&image);
+    SQLParserResult decoded;
+    ASSERT(decoded.deserialize(image.data(), image.size()));
+    ASSERT(decoded.isValid());
+    ASSERT_EQ(decoded.size(), result.size());
+
+    // The decoded result encodes to the same image.
+    std::string copy;
+    decoded.serialize(&copy);
+    ASSERT(copy == image);
+
+    for (size_t j = 0; j < result.size(); ++j) {
+      ASSERT_EQ(decoded.getStatement(j)->type(), result.getStatement(j)->type());
+      ASSERT_EQ(decoded.getStatement(j)->arena(), decoded.arena());
+      if (result.getStatement(j)->isType(kStmtSelect)) {
+        ASSERT_STREQ(jsonPrintStatementInfo(decoded.getStatement(j), false),
+                     jsonPrintStatementInfo(result.getStatement(j), false));
+      }
+    }
+  }
+}
+
+TEST(TPCHSplitStatementsTest) {
+  // Q15 creates a view, queries it and drops it again.
+  std::string script = readFileContents("test/queries/tpc-h-15.sql");
+  std::vector<StatementRange> ranges;
+  splitStatements(script, &ranges);
+  ASSERT_EQ(ranges.size(), 3);
+
+  // Each statement parses on its own.
+  for (const StatementRange& range : ranges) {
+    SQLParserResult result;
+    SQLParser::parse(script.data() + range.begin, range.end - range.begin, &result);
+    ASSERT(result.isValid());
+    ASSERT_EQ(result.size(), 1);
+  }
+}